@@ -13,13 +13,29 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11\x65ngine_data.proto\".\n\nEngineData\x12\x0b\n\x03rpm\x18\x01 \x01(\x05\x12\x13\n\x0btemperature\x18\x02 \x01(\x05\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11\x65ngine_data.proto\"\xdb\x02\n\nEngineData\x12\x10\n\x03rpm\x18\x01 \x01(\x05H\x00\x88\x01\x01\x12\x18\n\x0btemperature\x18\x02 \x01(\x05H\x01\x88\x01\x01\x12\x19\n\x0coil_pressure\x18\x03 \x01(\x05H\x02\x88\x01\x01\x12\x12\n\x05speed\x18\x04 \x01(\x05H\x03\x88\x01\x01\x12\x10\n\x08sequence\x18\x05 \x01(\x04\x12\x14\n\x0ctimestamp_ms\x18\x06 \x01(\x03\x12\x1d\n\x07windows\x18\x07 \x03(\x0b\x32\x0c.WindowStats\x12\x16\n\x06\x61lerts\x18\x08 \x03(\x0b\x32\x06.Alert\x12\"\n\x0c\x65xport_chunk\x18\t \x01(\x0b\x32\x0c.ExportChunk\x12\x1a\n\x12\x66ield_timestamp_ms\x18\n \x03(\x03\x12 \n\x08pipeline\x18\x0b \x03(\x0b\x32\x0e.PipelineStageB\x06\n\x04_rpmB\x0e\n\x0c_temperatureB\x0f\n\r_oil_pressureB\x08\n\x06_speed\"\xa7\x01\n\rPipelineStage\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05\x64\x65pth\x18\x02 \x01(\r\x12\x10\n\x08\x63\x61pacity\x18\x03 \x01(\r\x12\x12\n\nhigh_water\x18\x04 \x01(\r\x12\x11\n\tprocessed\x18\x05 \x01(\x04\x12\x0f\n\x07\x64ropped\x18\x06 \x01(\x04\x12\x17\n\x0fmean_latency_us\x18\x07 \x01(\x01\x12\x16\n\x0emax_latency_us\x18\x08 \x01(\x01\"9\n\x0b\x45xportChunk\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x0c\x12\x0c\n\x04last\x18\x02 \x01(\x08\x12\x0e\n\x06\x66\x61iled\x18\x03 \x01(\x08\"%\n\x05\x41lert\x12\x0c\n\x04rule\x18\x01 \x01(\t\x12\x0e\n\x06raised\x18\x02 \x01(\x08\"~\n\x0bSignalStats\x12\x0c\n\x04mean\x18\x01 \x01(\x01\x12\x0b\n\x03min\x18\x02 \x01(\x05\x12\x0b\n\x03max\x18\x03 \x01(\x05\x12\x12\n\nrate_per_s\x18\x04 \x01(\x01\x12\x0c\n\x04\x65wma\x18\x05 \x01(\x01\x12\x0b\n\x03p50\x18\x06 \x01(\x01\x12\x0b\n\x03p90\x18\x07 \x01(\x01\x12\x0b\n\x03p99\x18\x08 \x01(\x01\"\xae\x01\n\x0bWindowStats\x12\x11\n\twindow_ms\x18\x01 \x01(\r\x12\r\n\x05\x63ount\x18\x02 \x01(\r\x12\x19\n\x03rpm\x18\x03 \x01(\x0b\x32\x0c.SignalStats\x12!\n\x0btemperature\x18\x04 \x01(\x0b\x32\x0c.SignalStats\x12\"\n\x0coil_pressure\x18\x05 \x01(\x0b\x32\x0c.SignalStats\x12\x1b\n\x05speed\x18\x06 \x01(\x0b\x32\x0c.SignalStats\"\xa3\x01\n\x07Request\x12\x15\n\rinclude_stats\x18\x01 \x01(\x08\x12\x18\n\x10subscribe_alerts\x18\x02 \x01(\x08\x12&\n\x0e\x65xport_history\x18\x03 \x01(\x0b\x32\x0e.ExportRequest\x12\x1b\n\x0e\x61\x66ter_sequence\x18\x04 \x01(\x04H\x00\x88\x01\x01\x12\x0f\n\x07wait_ms\x18\x05 \x01(\rB\x11\n\x0f_after_sequence\"\x86\x01\n\rExportRequest\x12\x0f\n\x07\x66rom_ms\x18\x01 \x01(\x03\x12\r\n\x05to_ms\x18\x02 \x01(\x03\x12%\n\x06\x66ormat\x18\x03 \x01(\x0e\x32\x15.ExportRequest.Format\x12\x0f\n\x07step_ms\x18\x04 \x01(\x03\"\x1d\n\x06\x46ormat\x12\x07\n\x03\x43SV\x10\x00\x12\n\n\x06\x42INARY\x10\x01\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'engine_data_pb2', globals())
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _ENGINEDATA._serialized_start=21
-  _ENGINEDATA._serialized_end=67
+  _ENGINEDATA._serialized_start=22
+  _ENGINEDATA._serialized_end=369
+  _PIPELINESTAGE._serialized_start=372
+  _PIPELINESTAGE._serialized_end=539
+  _EXPORTCHUNK._serialized_start=541
+  _EXPORTCHUNK._serialized_end=598
+  _ALERT._serialized_start=600
+  _ALERT._serialized_end=637
+  _SIGNALSTATS._serialized_start=639
+  _SIGNALSTATS._serialized_end=765
+  _WINDOWSTATS._serialized_start=768
+  _WINDOWSTATS._serialized_end=942
+  _REQUEST._serialized_start=945
+  _REQUEST._serialized_end=1108
+  _EXPORTREQUEST._serialized_start=1111
+  _EXPORTREQUEST._serialized_end=1245
+  _EXPORTREQUEST_FORMAT._serialized_start=1216
+  _EXPORTREQUEST_FORMAT._serialized_end=1245
 # @@protoc_insertion_point(module_scope)
@@ -0,0 +1,164 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sqlite3.h>
+#include "Signals.h"
+
+// One stored sample, read from either storage layout.
+struct StoredSample {
+    int64_t id = 0;
+    int64_t timestamp_ms = 0;
+    EngineSample values{};
+    // Signals stored for this sample; the others were not sampled (NULL) and are 0.
+    uint8_t present = 0;
+};
+
+// Blocked sample layout: consecutive samples packed into one row of engine_blocks,
+//
+//   id        INTEGER PRIMARY KEY  id of the first sample; the others follow it
+//   samples   INTEGER              number of samples
+//   start_ts  INTEGER              smallest timestamp of the block
+//   end_ts    INTEGER              largest timestamp of the block
+//   timestamp BLOB                 the sample timestamps
+//   rpm, temperature, oil_pressure, speed BLOB (one column per signal)
+//
+// Integers in the blobs are zigzag varints. The timestamp column holds the first
+// timestamp, then the change of each sample-to-sample delta, so a steady sample
+// rate costs one byte per sample. A signal column starts with a byte saying whether
+// all samples, none, or those in the bitmap that follows (one bit per sample, LSB
+// first) stored the signal, then the delta of each stored value from the previous one.
+//
+// Sample ids share the sqlite_sequence entry of engine_values, so rows and blocks
+// in one database never reuse an id and read back in the order they were written.
+
+// Creates engine_blocks and its end_ts index if missing.
+bool initBlockSchema(sqlite3* db);
+
+// The column blobs of one block.
+struct EncodedBlock {
+    int64_t start_ts = 0;
+    int64_t end_ts = 0;
+    std::string timestamps;
+    std::array<std::string, kSignalCount> signals;
+};
+
+void encodeBlock(const StoredSample* samples, size_t count, EncodedBlock& out);
+// Decodes the `count` samples of a block whose first sample has id `first_id`,
+// replacing the contents of `out`. Returns false if a blob is malformed.
+bool decodeBlock(int64_t first_id, size_t count, std::string_view timestamps,
+                 const std::array<std::string_view, kSignalCount>& signals, std::vector<StoredSample>& out);
+
+// Packs samples into engine_blocks rows. A block is written once it holds
+// `block_rows` samples or a sample arrives `block_ms` or more after its first one,
+// in one transaction with the sequence update. Until then the samples are only
+// held in memory: readers do not see them and a crash loses them.
+class BlockWriter {
+public:
+    BlockWriter() = default;
+    BlockWriter(const BlockWriter&) = delete;
+    BlockWriter& operator=(const BlockWriter&) = delete;
+    ~BlockWriter();
+
+    // Creates the schema and continues the id sequence of `db`, which must outlive
+    // close(). Returns false, leaving the writer closed, if that fails.
+    bool open(sqlite3* db, size_t block_rows, int64_t block_ms);
+    // Writes the pending samples and releases the statements.
+    void close();
+    bool isOpen() const { return insert_stmt != nullptr; }
+
+    void add(int64_t timestamp_ms, const EngineSample& values, uint8_t present);
+    // Writes the pending samples as a block now.
+    bool flush();
+    size_t pending() const { return samples.size(); }
+    uint64_t blocksWritten() const { return blocks; }
+
+private:
+    sqlite3* db = nullptr;
+    sqlite3_stmt* insert_stmt = nullptr;
+    sqlite3_stmt* sequence_stmt = nullptr;
+    size_t block_rows = 0;
+    int64_t block_ms = 0;
+    int64_t next_id = 1;
+    std::vector<StoredSample> samples;
+    EncodedBlock encoded;
+    uint64_t blocks = 0;
+};
+
+// Reads the blocks of engine_blocks one at a time, in id order (or reverse id
+// order, samples included), keeping the samples with from_ms <= timestamp < to_ms.
+class BlockCursor {
+public:
+    BlockCursor() = default;
+    BlockCursor(const BlockCursor&) = delete;
+    BlockCursor& operator=(const BlockCursor&) = delete;
+    ~BlockCursor();
+
+    // Prepares the statement on `db`. Returns false if `db` has no engine_blocks.
+    bool open(sqlite3* db, bool descending = false);
+    void close();
+    bool isOpen() const { return stmt != nullptr; }
+    // Starts over with the samples after `id` (before it when descending).
+    void seek(int64_t id, int64_t from_ms, int64_t to_ms);
+    // Replaces `out` with the samples of the next block that has any in range.
+    // Returns false at the end and on errors (see failed()).
+    bool next(std::vector<StoredSample>& out);
+    bool failed() const { return error; }
+
+private:
+    sqlite3* db = nullptr;
+    sqlite3_stmt* stmt = nullptr;
+    bool descending = false;
+    bool stepping = false;
+    bool error = false;
+    int64_t id = 0;
+    int64_t from_ms = 0;
+    int64_t to_ms = 0;
+};
+
+// The samples of engine_values and engine_blocks in one database merged in id
+// order (or reverse id order), so readers do not depend on the layout they were
+// written in. A database without engine_blocks reads its rows only.
+class SampleScan {
+public:
+    SampleScan() = default;
+    SampleScan(const SampleScan&) = delete;
+    SampleScan& operator=(const SampleScan&) = delete;
+    ~SampleScan();
+
+    // Prepares the statements on `db`. Returns false if `db` has no engine_values.
+    bool open(sqlite3* db, bool descending = false);
+    void close();
+    // Starts over with the samples after `id` (before it when descending) with
+    // from_ms <= timestamp < to_ms.
+    void seek(int64_t id, int64_t from_ms, int64_t to_ms);
+    // The next sample; false at the end and on errors (see failed()).
+    bool next(StoredSample& out);
+    // Ends the read transactions; the next next() continues after the last sample.
+    void pause();
+    bool failed() const { return error; }
+
+private:
+    bool fillRow();
+    bool fillBlock();
+
+    sqlite3* db = nullptr;
+    sqlite3_stmt* rows_stmt = nullptr;
+    BlockCursor blocks;
+    bool descending = false;
+    bool error = false;
+    int64_t from_ms = 0;
+    int64_t to_ms = 0;
+    // Id of the last sample returned, where both sources resume.
+    int64_t last_id = 0;
+    bool rows_stepping = false;
+    bool rows_done = false;
+    bool has_row = false;
+    StoredSample row;
+    bool blocks_done = false;
+    std::vector<StoredSample> block;
+    size_t block_pos = 0;
+};
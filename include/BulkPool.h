@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work the pool runs one step at a time, e.g. an export producing one chunk per step.
+class BulkJob {
+public:
+    virtual ~BulkJob() = default;
+    // One bounded piece of work, run on a pool worker.
+    virtual void step() = 0;
+
+    // The owner no longer wants the job; a queued step of it is skipped.
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+    // The step submitted last has run; what it produced may be read until the job
+    // is submitted again.
+    bool ready() const { return ready_.load(std::memory_order_acquire); }
+
+private:
+    friend class BulkPool;
+    std::atomic<bool> cancelled_{false};
+    std::atomic<bool> ready_{false};
+};
+
+// Worker threads for bulk history requests, the second lane next to the poll loop.
+//
+// Jobs are admitted up to max_jobs at once. The owner then submits a job each time
+// it wants its next step, and a worker runs the step and calls `notify` so the owner
+// can collect the result. Submitted steps run in FIFO order and a job has at most
+// one step queued, so jobs take turns step by step: a large job cannot hold up a
+// small one behind it. The workers run at a lower scheduling priority (nice
+// `worker_nice`) so that on a busy machine the live lane gets the CPU first.
+class BulkPool {
+public:
+    BulkPool() = default;
+    BulkPool(const BulkPool&) = delete;
+    BulkPool& operator=(const BulkPool&) = delete;
+    ~BulkPool();
+
+    void start(size_t workers, size_t max_jobs, int worker_nice, std::function<void()> notify);
+    // Joins the workers; steps still queued are dropped.
+    void stop();
+
+    // Reserves a place for a new job; false if max_jobs jobs are admitted already.
+    // Every admitted job is retired once, when it finishes or is cancelled.
+    bool admit();
+    void retire();
+    // Queues the next step of an admitted job.
+    void submit(std::shared_ptr<BulkJob> job);
+
+    size_t admitted() const { return admitted_.load(std::memory_order_relaxed); }
+    uint64_t steps() const { return steps_.load(std::memory_order_relaxed); }
+
+private:
+    void workerLoop(int nice);
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::shared_ptr<BulkJob>> queue;
+    std::vector<std::thread> workers;
+    std::function<void()> notify;
+    bool stopping = false;
+    size_t max_jobs = 0;
+    std::atomic<size_t> admitted_{0};
+    std::atomic<uint64_t> steps_{0};
+};
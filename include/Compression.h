@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Engine.h"
+#include "StorageConfig.h"
+
+// A value to persist and the time it was sampled.
+struct StoredPoint {
+    int64_t timestamp_ms = 0;
+    int value = 0;
+};
+
+// Decides which samples of one signal are stored. Every sampled value lies within
+// the configured deviation of the linear interpolation between the stored points
+// around it, so readers reconstruct the signal by interpolating (HistoryInterpolator).
+//
+// Swinging door keeps the last sample back until the next one shows whether the
+// line from the last stored point can still be extended; a stored point may thus
+// be one sample older than the sample that caused it. Deadband stores a change at
+// once, preceded by the unchanged value at the previous sample so that
+// interpolation holds the old value until the change.
+class SignalCompressor {
+public:
+    // Most points offer() can return at once.
+    static constexpr size_t kMaxPoints = 2;
+
+    SignalCompressor() = default;
+    SignalCompressor(const SignalCompression& config, int64_t max_silence_ms);
+
+    // Feeds one sample; timestamps must increase. Writes the points to store, oldest
+    // first, to `out` and returns how many.
+    size_t offer(int64_t timestamp_ms, int value, StoredPoint* out);
+    // Returns the sample held back, if any, e.g. before shutting down.
+    size_t flush(StoredPoint* out);
+
+private:
+    void archive(const StoredPoint& point);
+
+    SignalCompression config;
+    int64_t max_silence_ms = 0;
+    bool has_archived = false;
+    StoredPoint archived;
+    // Last sample, not yet stored.
+    bool has_pending = false;
+    StoredPoint pending;
+    // Swinging door: the range of slopes from `archived` that pass within the
+    // deviation of every sample since it.
+    double slope_low = 0.0;
+    double slope_high = 0.0;
+};
+
+// A row to insert: the signals in `fresh` hold stored values, the others are NULL.
+struct CompressedRow {
+    int64_t timestamp_ms = 0;
+    EngineSample values;
+    uint8_t fresh = 0;
+};
+
+// Runs the fresh signals of each snapshot through their SignalCompressor and
+// groups the points to store into rows by timestamp. Signals without compression
+// are stored whenever they are sampled.
+class SampleCompressor {
+public:
+    SampleCompressor() = default;
+    explicit SampleCompressor(const CompressionConfig& config);
+
+    bool enabled() const { return active; }
+    // Appends the rows to insert, oldest first.
+    void offer(const EngineSnapshot& snapshot, std::vector<CompressedRow>& rows);
+    void flush(std::vector<CompressedRow>& rows);
+
+    // Signal values offered and stored so far.
+    uint64_t offered() const { return values_offered; }
+    uint64_t stored() const { return values_stored; }
+
+private:
+    void group(const StoredPoint* points, const size_t* counts, std::vector<CompressedRow>& rows);
+
+    bool active = false;
+    SignalCompressor signals[kSignalCount];
+    uint64_t values_offered = 0;
+    uint64_t values_stored = 0;
+};
+
+// Reconstructs every signal at increasing times from stored history by linear
+// interpolation between the stored values of each signal; this undoes
+// SampleCompressor within its deviation and also fills the NULLs of multi-rate
+// rows. After the last stored value of a signal the value is held.
+//
+// Each signal is read in timestamp order through the engine_values timestamp index,
+// merged with the samples of engine_blocks, which are read in id (write) order.
+// Statements are reset by pause(), which ends their read transactions, and resume
+// after the last row or block read. `storage` may be a partition directory.
+class HistoryInterpolator {
+public:
+    HistoryInterpolator();
+    HistoryInterpolator(const HistoryInterpolator&) = delete;
+    HistoryInterpolator& operator=(const HistoryInterpolator&) = delete;
+    ~HistoryInterpolator();
+
+    // Positions the reader at from_ms. Fails if the storage cannot be read.
+    bool open(const std::string& storage, int64_t from_ms);
+    void close();
+    // Values at `timestamp_ms`, which must not decrease between calls. Signals with
+    // no stored value at or before it are 0 and missing from `known`. Returns false
+    // on a read error.
+    bool at(int64_t timestamp_ms, EngineSample& values, uint8_t& known);
+    // Ends the read transactions until the next at().
+    void pause();
+    // Oldest and newest stored timestamps seen by open(); empty() when there are none.
+    bool empty() const { return !has_rows; }
+    int64_t firstTimestamp() const { return first_ms; }
+    int64_t lastTimestamp() const { return last_ms; }
+
+private:
+    struct Track;
+
+    std::vector<std::string> databases;
+    std::unique_ptr<Track[]> tracks;
+    bool has_rows = false;
+    int64_t first_ms = 0;
+    int64_t last_ms = 0;
+};
@@ -1,10 +1,35 @@
 #pragma once
 
 
+#include "BlockStore.h"
 #include "Receiver.h"
+#include "Signals.h"
+#include "PartitionedStore.h"
+#include "StorageConfig.h"
 #include <sqlite3.h>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
+class SampleCompressor;
+struct CompressedRow;
+
+// A sample as published by Server: the values plus a monotonically increasing
+// sequence number and the wall-clock time it was taken.
+//
+// With multi-rate sampling only the signals in `fresh` were read at timestamp_ms;
+// the others carry their last sampled value, taken at field_timestamp_ms.
+struct EngineSnapshot {
+    EngineSample values;
+    uint64_t sequence = 0;
+    int64_t timestamp_ms = 0;
+    uint8_t fresh = kAllSignals;
+    std::array<int64_t, kSignalCount> field_timestamp_ms{};
+};
 
 class Engine {
 public:
@@ -13,21 +38,94 @@ public:
     virtual int getTemperature()  = 0;
     virtual int getOilPressure() = 0;
     virtual int getSpeed() = 0;
+    // Reads all signals at once. Preferred on hot paths over the per-signal getters.
+    virtual EngineSample sample() = 0;
     virtual void storeCurrentValues(int rpm, int temperature, int oil_pressure, int speed) = 0;
 };
 
-class EngineImpl : public Engine {
+// Advisory lock (flock) on `<db_path>-lock` that keeps bulk imports out of a
+// database the server is storing into: storage holds it shared, importHistory()
+// exclusively. Released when destroyed.
+class WriterLock {
+public:
+    WriterLock() = default;
+    WriterLock(const WriterLock&) = delete;
+    WriterLock& operator=(const WriterLock&) = delete;
+    ~WriterLock();
+    // Returns false, without waiting, if the lock is held in the other mode. A lock
+    // file that cannot be created is logged and does not stop the caller.
+    bool acquire(const std::string& db_path, bool exclusive);
+
+private:
+    int fd = -1;
+};
+
+// EngineImpl is final so calls through a concrete EngineImpl (as held by Server)
+// are devirtualized and can be inlined.
+class EngineImpl final : public Engine {
 public:
     EngineImpl();
     EngineImpl(const std::string& db_path);
+    // Partitioned storage writes into config.path as a directory of per-hour or
+    // per-day files and applies config.retention_ms when a new partition starts.
+    // With config.compression, only the samples SampleCompressor selects are stored.
+    // With config.block_rows, samples are packed into engine_blocks (BlockWriter).
+    // A single database file is write-locked (WriterLock); while an import holds it,
+    // samples are not stored.
+    explicit EngineImpl(const StorageConfig& config);
     ~EngineImpl();
     int getRpm() override;
     int getTemperature() override;
     int getOilPressure() override;
     int getSpeed() override;
+    EngineSample sample() override;
+    // Reads only the signals in `signals`; the other fields are left 0.
+    EngineSample sample(uint8_t signals);
     void storeCurrentValues(int rpm, int temperature, int oil_pressure, int speed) override;
+    // Stores the fresh signals of `snapshot` at its timestamp; the others are
+    // stored as NULL (or repeated, in databases created before NULLs were allowed).
+    void storeSample(const EngineSnapshot& snapshot);
+    // Records a rule raising or clearing in the alert_events table.
+    void storeAlertEvent(const std::string& rule, bool raised, int64_t timestamp_ms, const EngineSample& values);
+    // Signal values offered to and stored by compression; both 0 without it.
+    uint64_t valuesOffered() const;
+    uint64_t valuesStored() const;
 private:
     Receiver receiver;
     sqlite3* db;
+    PartitionedStore partitions;
+    int64_t retention_ms = 0;
+    // engine_values accepts NULL signal values; false for databases created by
+    // older versions, whose columns are NOT NULL.
+    bool sparse_rows = true;
+    std::unique_ptr<SampleCompressor> compressor;
+    std::vector<CompressedRow> compressed_rows;
+    BlockWriter blocks;
+    WriterLock writer_lock;
     void initDatabase(const std::string& db_path);
+    void enableCompression(const CompressionConfig& config);
+    void insertRow(int64_t timestamp_ms, const EngineSample& values, uint8_t fresh);
+    void applyRetention(int64_t now_ms);
+};
+
+// Creates the engine_values and alert_events tables in `db` if missing and adds
+// columns older database files lack. Shared by single-file and partitioned storage.
+bool initEngineSchema(sqlite3* db);
+// INSERT INTO engine_values binding the signals at 1..kSignalCount and the
+// timestamp at kSignalCount + 1.
+const std::string& engineValuesInsertSql();
+// INSERT INTO alert_events binding rule and raised at 1 and 2, the signals from 3
+// and the timestamp last.
+const std::string& alertEventsInsertSql();
+// Whether engine_values in `db` accepts NULL signal values (rows of multi-rate
+// samples store unsampled signals as NULL).
+bool engineValuesNullable(sqlite3* db);
+
+// Compile-time engine policy used by BasicServer. Any type providing a whole-tuple
+// sample() and a storage hook qualifies; it does not have to derive from Engine.
+// storeAlertEvent() is optional; alerts are only pushed to clients without it.
+template <typename T>
+concept EngineSource = requires(T engine, int value) {
+    { engine.sample() } -> std::same_as<EngineSample>;
+    engine.storeCurrentValues(value, value, value, value);
 };
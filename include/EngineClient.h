@@ -0,0 +1,187 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "engine_data.pb.h"
+
+// Client connection settings. A non-empty unix_path connects over AF_UNIX
+// (SOCK_STREAM) instead of TCP.
+struct ClientConfig {
+    std::string host = "127.0.0.1";
+    uint16_t port = 5555;
+    std::string unix_path;
+    // Connections requests are spread over.
+    size_t pool_size = 1;
+    // Requests written to one connection before its earlier responses arrive.
+    size_t max_in_flight = 32;
+    // Requests waiting for a connection; more are rejected.
+    size_t max_queued = 4096;
+    // Reconnect delay: doubles per failed attempt from min to max, with jitter.
+    std::chrono::milliseconds reconnect_min{50};
+    std::chrono::milliseconds reconnect_max{5000};
+};
+
+enum class ClientStatus {
+    Ok,
+    // The connection carrying the request broke before the response arrived.
+    Disconnected,
+    // The client stopped.
+    Closed,
+    // Not started, or too many requests queued.
+    Rejected,
+};
+
+// Invoked on the client's I/O thread. The message is the connection's reused
+// receive message and is only valid during the call; it is empty unless Ok.
+using ResponseCallback = std::function<void(ClientStatus, const EngineData&)>;
+
+struct ClientResponse {
+    ClientStatus status = ClientStatus::Rejected;
+    EngineData data;
+};
+
+struct EngineClientCounters {
+    uint64_t requests = 0;
+    uint64_t frames = 0;
+    // Connections lost or refused.
+    uint64_t disconnects = 0;
+    uint64_t connected = 0;
+};
+
+class EngineClient;
+
+// co_await client.asyncPoll() suspends until the response arrives and continues
+// on the client's I/O thread with a copy of it.
+class ResponseAwaiter {
+public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    ClientResponse await_resume() { return std::move(response); }
+
+private:
+    friend class EngineClient;
+    ResponseAwaiter(EngineClient& client, std::string frame, bool stream)
+        : client(client), frame(std::move(frame)), stream(stream) {}
+
+    EngineClient& client;
+    std::string frame;
+    bool stream;
+    ClientResponse response;
+};
+
+// Fire-and-forget coroutine return type for code driven by ResponseAwaiter.
+struct ClientTask {
+    struct promise_type {
+        ClientTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// Asynchronous client for the server's socket protocol.
+//
+// One I/O thread polls a pool of connections. Requests may be submitted from any
+// thread; each goes to the connected pool member with the fewest outstanding
+// requests, up to max_in_flight written back to back (pipelined) before their
+// responses, which the server answers in order. Broken connections are
+// reconnected with exponential backoff; their outstanding requests complete with
+// Disconnected and queued requests wait for a connection.
+//
+// Frames are parsed straight out of each connection's receive buffer into a
+// message reused for every frame, so a warm connection receives without
+// allocating. Callbacks run on the I/O thread and must not block it.
+//
+// Alert subscriptions use one more connection that stays subscribed: after every
+// (re)connect subscribers get the snapshot that acknowledges the subscription,
+// then one frame per alert batch, and Disconnected when the connection breaks.
+class EngineClient {
+public:
+    explicit EngineClient(ClientConfig config = {});
+    EngineClient(const EngineClient&) = delete;
+    EngineClient& operator=(const EngineClient&) = delete;
+    ~EngineClient();
+
+    // Starts the I/O thread; fails on an invalid address or missing eventfd.
+    bool start();
+    // Completes outstanding requests with Closed and joins the I/O thread. Not
+    // from a callback.
+    void stop();
+
+    // Snapshot poll. Returns false, without calling back, if rejected.
+    bool poll(ResponseCallback callback);
+    // Structured request. Exports call back once per chunk until the last one.
+    bool request(const Request& request, ResponseCallback callback);
+    ResponseAwaiter asyncPoll();
+    // Awaits one response; not for exports.
+    ResponseAwaiter asyncRequest(const Request& request);
+
+    // Returns the subscription id, or 0 if the client is not running.
+    uint64_t subscribeAlerts(ResponseCallback callback);
+    void unsubscribe(uint64_t id);
+
+    EngineClientCounters getCounters() const;
+
+private:
+    friend class ResponseAwaiter;
+    struct Connection;
+    struct Pending {
+        ResponseCallback callback;
+        // Export: the callback takes every frame up to the last chunk.
+        bool stream = false;
+    };
+    struct Submission {
+        enum Kind { kRequest, kSubscribe, kUnsubscribe } kind = kRequest;
+        std::string frame;
+        Pending pending;
+        uint64_t id = 0;
+    };
+
+    bool submit(Submission submission);
+    static std::string encode(const Request& request);
+    void run();
+    void takeSubmissions();
+    void dispatch();
+    void connect(Connection& c);
+    void finishConnect(Connection& c);
+    void disconnect(Connection& c, ClientStatus status);
+    bool flush(Connection& c);
+    bool receive(Connection& c);
+    void deliver(Connection& c);
+    Connection* streamConnection();
+
+    ClientConfig config;
+    std::atomic<bool> running{false};
+    std::thread io_thread;
+    int wake_fd = -1;
+
+    // Guards submissions and wake_pending; everything below them is owned by
+    // io_thread.
+    std::mutex submit_mutex;
+    std::vector<Submission> submissions;
+    bool wake_pending = false;
+    // Requests submitted and not yet written to a connection.
+    std::atomic<size_t> waiting{0};
+    std::atomic<uint64_t> next_subscription{1};
+
+    std::vector<std::unique_ptr<Connection>> connections;
+    std::deque<Submission> backlog;
+    std::vector<std::pair<uint64_t, ResponseCallback>> subscribers;
+    std::vector<Submission> taken;
+
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> disconnects{0};
+    std::atomic<uint64_t> connected{0};
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include "Signals.h"
+
+// Aggregates of one signal over its stored values in a range. NULLs (signals not
+// sampled in a row, see multi-rate sampling and compression) are not counted.
+struct SignalAggregate {
+    uint64_t count = 0;
+    int64_t sum = 0;
+    // 0 when count is 0.
+    int min = 0;
+    int max = 0;
+    double mean = 0.0;
+    // Exact nearest-rank quantiles: the smallest stored value with at least
+    // ceil(q * count) values at or below it.
+    int p50 = 0;
+    int p90 = 0;
+    int p99 = 0;
+};
+
+struct AggregateResult {
+    // Rows with from_ms <= timestamp < to_ms.
+    uint64_t rows = 0;
+    std::array<SignalAggregate, kSignalCount> signals{};
+    double seconds = 0.0;
+    // Threads that read the range, and whether they used the AVX2 kernels.
+    size_t threads = 0;
+    bool simd = false;
+};
+
+struct AggregateOptions {
+    // Threads reading the range; 0 uses one per hardware thread.
+    size_t threads = 0;
+    // Rows read into the column buffers before the kernels run over them.
+    size_t block_rows = 16384;
+    // Use the AVX2 kernels when the CPU has them; false forces the scalar ones.
+    bool simd = true;
+};
+
+// Computes count, min, max, mean and exact p50/p90/p99 of every signal over the
+// samples with from_ms <= timestamp < to_ms, stored as engine_values rows or packed
+// into engine_blocks (BlockWriter).
+//
+// SQLite's aggregate functions run row at a time and quantiles need an ORDER BY
+// per signal. Here each reader instead copies the signal values into int32 column
+// blocks and reduces a block at a time (sum, min and max with AVX2 when available)
+// into per-signal counting histograms over the kSignalFields ranges, which give
+// exact quantiles in bounded memory. Values outside a range are kept aside.
+//
+// The range is cut into time slices, per partition when `db_path` is a partition
+// directory (see PartitionedStore), and the slices are read in parallel, each on
+// its own read-only connection through the timestamp index. The database may be
+// written meanwhile (WAL). Returns false if a database cannot be read.
+bool aggregateHistory(const std::string& db_path, int64_t from_ms, int64_t to_ms, AggregateResult& result,
+                      const AggregateOptions& options = {});
+
+// The block kernels, exposed for tests.
+namespace aggregate {
+
+struct BlockStats {
+    int64_t sum = 0;
+    int min = std::numeric_limits<int>::max();
+    int max = std::numeric_limits<int>::min();
+};
+
+BlockStats scanScalar(const int32_t* values, size_t n);
+// Requires avx2Available().
+BlockStats scanAvx2(const int32_t* values, size_t n);
+bool avx2Available();
+
+} // namespace aggregate
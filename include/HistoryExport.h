@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sqlite3.h>
+#include "BlockStore.h"
+#include "Signals.h"
+
+class HistoryInterpolator;
+
+// Output formats of a history export.
+enum class ExportFormat {
+    // Header line "id,timestamp_ms,rpm,temperature,oil_pressure,speed" (one column
+    // per signal, in signal order), one row per line.
+    // Signals a row did not sample (multi-rate sampling) are empty fields.
+    Csv,
+    // Columnar blocks, all integers little-endian:
+    //   file header: "MWCB", uint32 version (1)
+    //   block:       uint32 rows, int64 id[rows], int64 timestamp_ms[rows],
+    //                then int32 <signal>[rows] per signal in signal order
+    //                (rpm, temperature, oil_pressure, speed)
+    // A block with 0 rows ends the stream. Signals a row did not sample repeat the
+    // previous row's value (0 before the first).
+    Binary,
+};
+
+// Streams the samples with from_ms <= timestamp < to_ms in chunks, in id order,
+// from engine_values rows and engine_blocks alike (SampleScan).
+//
+// The cursor has its own read-only connection and resumes each chunk after the last
+// id it returned, so each chunk is one short read transaction. Memory stays bounded
+// by the chunk size however large the range is, and with the database in WAL mode
+// the exporter never blocks the writer.
+//
+// `db_path` may also be a partition directory (see PartitionedStore): only the
+// partitions overlapping the range are opened, one after another, and ids are then
+// unique per partition only.
+//
+// With a step, the cursor instead writes one row every step_ms, with each signal
+// reconstructed by interpolating between its stored values (HistoryInterpolator).
+// This undoes compression and multi-rate NULLs. The rows start at from_ms or the
+// first stored sample, whichever is later, and end at to_ms or the last stored
+// sample. Their ids number them from 1. Signals with no stored value yet are
+// treated like NULLs.
+class HistoryCursor {
+public:
+    static constexpr size_t kDefaultChunkRows = 1024;
+
+    HistoryCursor();
+    HistoryCursor(const HistoryCursor&) = delete;
+    HistoryCursor& operator=(const HistoryCursor&) = delete;
+    ~HistoryCursor();
+
+    bool open(const std::string& db_path, int64_t from_ms = 0,
+              int64_t to_ms = std::numeric_limits<int64_t>::max(), ExportFormat format = ExportFormat::Csv,
+              int64_t step_ms = 0);
+    void close();
+    // Appends the next chunk of at most `max_rows` rows to `out`; the first call also
+    // writes the format header and the last one the terminator. Returns false once
+    // the export is finished (nothing was appended) or failed.
+    bool next(std::string& out, size_t max_rows = kDefaultChunkRows);
+    bool done() const { return finished; }
+    bool failed() const { return error; }
+    uint64_t rowsExported() const { return rows; }
+
+private:
+    bool openPartition(const std::string& path);
+    void closePartition();
+    bool nextStored(std::string& out, size_t max_rows);
+    bool nextInterpolated(std::string& out, size_t max_rows);
+    void finish(std::string& out);
+
+    std::vector<std::string> partitions;
+    size_t next_partition = 0;
+    sqlite3* db = nullptr;
+    SampleScan scan;
+    ExportFormat format = ExportFormat::Csv;
+    int64_t from_ms = 0;
+    int64_t to_ms = 0;
+    int64_t last_id = 0;
+    // Interpolated exports: the time of the next row.
+    int64_t step_ms = 0;
+    int64_t next_ms = 0;
+    std::unique_ptr<HistoryInterpolator> interpolator;
+    uint64_t rows = 0;
+    // Last value of each signal, repeated for unsampled (NULL) binary values.
+    int32_t carried[kSignalCount] = {};
+    bool started = false;
+    // Nothing to read until open() succeeds.
+    bool finished = true;
+    bool error = false;
+};
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Result of a bulk import.
+struct ImportStats {
+    uint64_t rows = 0;
+    // CSV lines that could not be parsed.
+    uint64_t skipped = 0;
+    double seconds = 0.0;
+    double rowsPerSecond() const { return seconds > 0.0 ? rows / seconds : 0.0; }
+};
+
+struct ImportOptions {
+    // Rows inserted per transaction.
+    size_t chunk_rows = 100000;
+};
+
+// Bulk-loads a CSV or binary history file (the formats written by HistoryCursor,
+// detected from the file's first bytes) into engine_values of `db_path`.
+//
+// Unlike storeCurrentValues(), which commits every row, the importer inserts
+// through one reused prepared statement in one transaction per chunk, with
+// synchronous=OFF for the duration of the load. Secondary indexes on engine_values
+// are dropped first and rebuilt once at the end. CSV files need a header naming
+// the columns (timestamp_ms or timestamp, rpm, temperature, oil_pressure, speed;
+// others such as id are ignored) or must use the export column order; empty signal
+// fields (unsampled in multi-rate exports) are stored as NULL. Imported rows
+// get new ids.
+//
+// The server must not be storing into the database meanwhile: the import takes
+// the WriterLock exclusively and fails if a server holds it. Partition directories
+// are rejected. Returns false if the file or database cannot be used; rows committed
+// before a failure stay in the database.
+bool importHistory(const std::string& db_path, const std::string& file_path, ImportStats& stats,
+                   const ImportOptions& options = {});
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "Engine.h"
+
+// HTTP/1.1 and WebSocket (RFC 6455) pieces of the browser gateway. BasicServer
+// serves the gateway from its poll loop; these helpers only parse and encode
+// buffers and keep no state.
+namespace http {
+
+// Longest request head accepted; larger ones are answered with 431.
+constexpr size_t kMaxHeadBytes = 8192;
+
+enum class ParseStatus {
+    // Not enough bytes yet.
+    Incomplete,
+    Ok,
+    Malformed,
+};
+
+// One parsed request head. The views point into the parsed buffer.
+struct RequestHead {
+    std::string_view method;
+    // Path without the query string.
+    std::string_view path;
+    std::string_view websocket_key;
+    // Bytes taken by the head, including the blank line.
+    size_t length = 0;
+    // HTTP/1.1 unless "Connection: close"; HTTP/1.0 only with "Connection: keep-alive".
+    bool keep_alive = true;
+    // "Upgrade: websocket" with "Connection: Upgrade".
+    bool upgrade_websocket = false;
+    int websocket_version = 0;
+    // Content-Length > 0 or Transfer-Encoding: the gateway takes no request bodies.
+    bool has_body = false;
+};
+
+ParseStatus parseRequestHead(std::string_view buffer, RequestHead& head);
+
+// Appends a complete response with Content-Length and, unless keep_alive, Connection: close.
+void appendResponse(std::string& out, int status, std::string_view content_type, std::string_view body,
+                    bool keep_alive);
+// Appends the 101 response accepting a WebSocket handshake.
+void appendUpgradeResponse(std::string& out, std::string_view websocket_key);
+// Sec-WebSocket-Accept value: base64(SHA-1(key + RFC 6455 GUID)).
+std::string websocketAccept(std::string_view key);
+
+// {"sequence":..,"timestamp_ms":..,"rpm":..,"temperature":..,"oil_pressure":..,"speed":..}
+// (one key per signal) and, with field_timestamps, "field_timestamp_ms":[..] in
+// signal order.
+void appendSnapshotJson(std::string& out, const EngineSnapshot& snapshot, bool field_timestamps);
+
+enum WebSocketOpcode : uint8_t {
+    kContinuation = 0x0,
+    kText = 0x1,
+    kBinary = 0x2,
+    kClose = 0x8,
+    kPing = 0x9,
+    kPong = 0xA,
+};
+
+// Appends an unmasked (server to client), unfragmented frame.
+void appendWebSocketFrame(std::string& out, uint8_t opcode, std::string_view payload);
+
+struct WebSocketFrame {
+    uint8_t opcode = 0;
+    bool fin = false;
+    // Unmasked in place.
+    std::string_view payload;
+    // Bytes taken by the frame.
+    size_t length = 0;
+};
+
+// Parses one client frame from the front of `buffer` and unmasks its payload in
+// place. Client frames must be masked; control frames must be final and at most
+// 125 bytes, and no payload may exceed max_payload.
+ParseStatus parseWebSocketFrame(char* buffer, size_t size, size_t max_payload, WebSocketFrame& frame);
+
+} // namespace http
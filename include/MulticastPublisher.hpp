@@ -0,0 +1,117 @@
+#pragma once
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <netinet/in.h>
+#include <string>
+#include <spdlog/spdlog.h>
+#include "Engine.h"
+#include "SignalProto.h"
+#include "Transport.h"
+#include "engine_data.pb.h"
+
+// Sends every snapshot once as a UDP multicast datagram, so the cost no longer
+// grows with the number of subscribers. Each datagram is one serialized EngineData
+// (no size prefix) carrying `sequence` and `timestamp_ms`; receivers detect loss
+// from gaps in the sequence.
+//
+// Templated on the server's transport so tests can capture datagrams in memory.
+template <SocketTransport TransportT>
+class MulticastPublisher {
+public:
+    explicit MulticastPublisher(TransportT& transport) : transport(transport) {}
+    MulticastPublisher(const MulticastPublisher&) = delete;
+    MulticastPublisher& operator=(const MulticastPublisher&) = delete;
+    ~MulticastPublisher() { close(); }
+
+    // `interface_address` selects the outgoing interface (e.g. "127.0.0.1" for
+    // loopback tests); empty lets the routing table decide.
+    bool open(const std::string& group, uint16_t port, const std::string& interface_address, int ttl, bool loopback)
+    {
+        close();
+        sockaddr_in dest{};
+        dest.sin_family = AF_INET;
+        dest.sin_port = htons(port);
+        if (inet_pton(AF_INET, group.c_str(), &dest.sin_addr) != 1 || !IN_MULTICAST(ntohl(dest.sin_addr.s_addr)))
+        {
+            spdlog::error("Invalid multicast group '{}'", group);
+            return false;
+        }
+        in_addr iface{};
+        iface.s_addr = htonl(INADDR_ANY);
+        if (!interface_address.empty() && inet_pton(AF_INET, interface_address.c_str(), &iface) != 1)
+        {
+            spdlog::error("Invalid multicast interface '{}'", interface_address);
+            return false;
+        }
+
+        int sock = transport.socket(AF_INET, SOCK_DGRAM, 0);
+        if (sock < 0)
+        {
+            spdlog::error("multicast socket failed: {}", std::strerror(errno));
+            return false;
+        }
+        const unsigned char ttl_value = static_cast<unsigned char>(ttl);
+        const unsigned char loop_value = loopback ? 1 : 0;
+        if (transport.setsockopt(sock, IPPROTO_IP, IP_MULTICAST_TTL, &ttl_value, sizeof(ttl_value)) < 0 ||
+            transport.setsockopt(sock, IPPROTO_IP, IP_MULTICAST_LOOP, &loop_value, sizeof(loop_value)) < 0 ||
+            (!interface_address.empty() &&
+             transport.setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &iface, sizeof(iface)) < 0))
+        {
+            spdlog::error("multicast setsockopt failed: {}", std::strerror(errno));
+            transport.close(sock);
+            return false;
+        }
+        fd = sock;
+        destination = dest;
+        send_failing = false;
+        spdlog::info("Multicast publisher sending to {}:{}", group, port);
+        return true;
+    }
+
+    void close()
+    {
+        if (fd >= 0)
+        {
+            transport.close(fd);
+            fd = -1;
+        }
+    }
+
+    bool isOpen() const { return fd >= 0; }
+
+    void publish(const EngineSnapshot& snapshot)
+    {
+        if (fd < 0)
+            return;
+        // Only the signals sampled for this snapshot go out; receivers keep the rest.
+        setSignals(msg, snapshot.values, snapshot.fresh);
+        msg.set_sequence(snapshot.sequence);
+        msg.set_timestamp_ms(snapshot.timestamp_ms);
+        // Reuse the datagram buffer; its capacity settles after the first sample.
+        datagram.resize(msg.ByteSizeLong());
+        msg.SerializeToArray(datagram.data(), static_cast<int>(datagram.size()));
+        ssize_t sent = transport.sendto(fd, datagram.data(), datagram.size(), MSG_DONTWAIT,
+                                        reinterpret_cast<const sockaddr*>(&destination), sizeof(destination));
+        // Log state changes only: a persistent failure would otherwise log every tick.
+        if (sent < 0 && !send_failing)
+        {
+            spdlog::error("multicast sendto failed: {}", std::strerror(errno));
+            send_failing = true;
+        }
+        else if (sent >= 0 && send_failing)
+        {
+            spdlog::info("multicast sendto recovered");
+            send_failing = false;
+        }
+    }
+
+private:
+    TransportT& transport;
+    int fd = -1;
+    sockaddr_in destination{};
+    bool send_failing = false;
+    EngineData msg;
+    std::string datagram;
+};
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <sqlite3.h>
+#include "StorageConfig.h"
+
+struct EngineSample;
+
+// One partition file and the half-open UTC time range [start_ms, end_ms) it covers.
+struct PartitionInfo {
+    std::string path;
+    int64_t start_ms = 0;
+    int64_t end_ms = 0;
+};
+
+// Time-partitioned storage: one SQLite file per UTC hour or day in a directory,
+// named engine_values_YYYYMMDD.db or engine_values_YYYYMMDDHH.db, each with the
+// regular schema plus a timestamp index.
+//
+// Only the live partition is written, so its tables and index stay small and stay in
+// the page cache. Retention unlinks whole files instead of running DELETE.
+// Readers either walk the partitions of a time range one after another (see
+// HistoryCursor) or ATTACH them and query a combined view (attach()).
+class PartitionedStore {
+public:
+    PartitionedStore() = default;
+    PartitionedStore(const PartitionedStore&) = delete;
+    PartitionedStore& operator=(const PartitionedStore&) = delete;
+    ~PartitionedStore();
+
+    bool open(const std::string& directory, Partitioning granularity);
+    void close();
+    bool isOpen() const { return !directory.empty(); }
+
+    // Appends to the partition covering `timestamp_ms`, switching files when the
+    // sample falls into a new hour or day.
+    bool insert(int64_t timestamp_ms, int rpm, int temperature, int oil_pressure, int speed);
+    // As above, storing the signals missing from `fresh` as NULL.
+    bool insert(int64_t timestamp_ms, const EngineSample& values, uint8_t fresh);
+    bool insertAlert(const std::string& rule, bool raised, int64_t timestamp_ms, const EngineSample& values);
+    // Deletes partitions that ended at or before `cutoff_ms`, except the live one.
+    // Returns the number of partitions removed.
+    size_t dropBefore(int64_t cutoff_ms);
+    // Path of the partition currently written, empty before the first insert.
+    const std::string& livePath() const { return live.path; }
+    // Start of the live partition's range; changes when insert() switches files.
+    int64_t liveStartMs() const { return live.start_ms; }
+
+    // Partition files in `directory`, oldest first.
+    static std::vector<PartitionInfo> list(const std::string& directory);
+    // Partitions overlapping [from_ms, to_ms), oldest first.
+    static std::vector<PartitionInfo> overlapping(const std::string& directory, int64_t from_ms, int64_t to_ms);
+    // ATTACHes the partitions overlapping [from_ms, to_ms) to `db` and creates the
+    // TEMP view engine_values_all over their engine_values tables. Returns the
+    // number attached, or -1 if they exceed SQLite's attach limit or fail.
+    static int attach(sqlite3* db, const std::string& directory, int64_t from_ms, int64_t to_ms);
+
+private:
+    bool roll(int64_t timestamp_ms);
+    bool prepare(sqlite3_stmt** stmt, const char* sql);
+    void closeLive();
+
+    std::string directory;
+    Partitioning granularity = Partitioning::Day;
+    PartitionInfo live;
+    sqlite3* db = nullptr;
+    sqlite3_stmt* insert_stmt = nullptr;
+    sqlite3_stmt* alert_stmt = nullptr;
+};
@@ -1,18 +1,20 @@
 #pragma once
+#include <array>
+#include <cstddef>
 #include <random>
+#include "Signals.h"
 
 
+// Simulated sensors: each signal is uniform over its kSignalFields range.
 class Receiver {
 public:
     Receiver();
-    int GetRpm();
-    int GetTemperature();
-    int GetOilPressure(); // psi, range 0-200
-    int GetSpeed(); // km/h, range 0-500
+    int read(size_t signal);
+    int GetRpm() { return read(signals::rpm); }
+    int GetTemperature() { return read(signals::temperature); }
+    int GetOilPressure() { return read(signals::oil_pressure); } // psi, range 0-200
+    int GetSpeed() { return read(signals::speed); } // km/h, range 0-500
 private:
     std::mt19937 rng;
-    std::uniform_int_distribution<int> rpmDist;
-    std::uniform_int_distribution<int> tempDist{-50, 500};
-    std::uniform_int_distribution<int> oilPressureDist{0, 200};
-    std::uniform_int_distribution<int> speedDist{0, 500};
+    std::array<std::uniform_int_distribution<int>, kSignalCount> dists;
 };
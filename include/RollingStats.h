@@ -0,0 +1,80 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "Engine.h"
+
+struct SignalSummary {
+    double mean = 0.0;
+    int min = 0;
+    int max = 0;
+    double rate_per_s = 0.0;
+    double ewma = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+};
+
+struct WindowSummary {
+    int64_t window_ms = 0;
+    uint32_t count = 0;
+    // In the signal order of kSignalFields.
+    std::array<SignalSummary, kSignalCount> signals{};
+};
+
+// Time-based sliding window over all signals, updated incrementally:
+//  - mean from a running sum,
+//  - min/max from monotonic deques (amortized O(1) per sample),
+//  - rate of change from the oldest and newest sample in the window,
+//  - an EWMA whose time constant is the window length,
+//  - approximate quantiles from a fixed-bin histogram over each signal's range.
+// Samples older than `window_ms` relative to the newest one are evicted on add().
+class RollingWindow {
+public:
+    explicit RollingWindow(int64_t window_ms);
+    void add(int64_t timestamp_ms, const EngineSample& sample);
+    WindowSummary summary() const;
+    int64_t windowMs() const { return window_ms; }
+
+    static constexpr size_t kHistogramBins = 128;
+
+private:
+    struct Entry {
+        uint64_t n;
+        int64_t timestamp_ms;
+        std::array<int, kSignalCount> values;
+    };
+    struct Extremum {
+        uint64_t n;
+        int value;
+    };
+    struct SignalState {
+        int64_t sum = 0;
+        std::deque<Extremum> min_queue; // values increasing from front to back
+        std::deque<Extremum> max_queue; // values decreasing from front to back
+        std::array<uint32_t, kHistogramBins> histogram{};
+        double ewma = 0.0;
+    };
+
+    void evictOlderThan(int64_t cutoff_ms);
+    double quantile(size_t signal, double q) const;
+
+    int64_t window_ms;
+    uint64_t next_n = 0;
+    std::deque<Entry> entries;
+    std::array<SignalState, kSignalCount> signals;
+};
+
+// The set of configured windows, e.g. 1 s, 10 s and 60 s.
+class RollingStats {
+public:
+    explicit RollingStats(const std::vector<int64_t>& windows_ms);
+    void add(int64_t timestamp_ms, const EngineSample& sample);
+    std::vector<WindowSummary> summary() const;
+    bool empty() const { return windows.empty(); }
+
+private:
+    std::vector<RollingWindow> windows;
+};
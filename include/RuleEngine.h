@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Engine.h"
+
+// A rule changing state: raised once its condition has held for the hold time,
+// cleared when the condition stops holding.
+struct AlertEvent {
+    std::string rule;
+    bool raised = false;
+    uint64_t sequence = 0;
+    int64_t timestamp_ms = 0;
+    EngineSample values;
+};
+
+// Threshold/alert rules compiled once into stack-machine bytecode and evaluated for
+// every sample.
+//
+// Rule syntax (one rule per line):
+//   name: <condition> [for <duration>]
+// Conditions combine signals (rpm, temperature, oil_pressure, speed), rate(<signal>)
+// (change per second between the signal's last two fresh samples, held while the
+// signal is not resampled) and numbers with
+//   + - * /   < <= > >= == !=   ! && ||   and parentheses.
+// `and`, `while` and `or` are accepted as keywords. Durations take ms or s.
+// Example:
+//   low_oil_under_load: oil_pressure < 10 while rpm > 4000 for 500ms
+//   overheating: rate(temperature) > 5
+class RuleEngine {
+public:
+    // Compiles and adds a rule. On failure returns false and describes the problem in
+    // `error` (when given); the engine is left unchanged.
+    bool addRule(const std::string& text, std::string* error = nullptr);
+    size_t size() const { return rules.size(); }
+    // Evaluates every rule against `snapshot` and appends state changes to `events`.
+    void evaluate(const EngineSnapshot& snapshot, std::vector<AlertEvent>& events);
+
+    enum class Op : uint8_t {
+        PushConst,
+        LoadSignal,
+        LoadRate,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Neg,
+        Not,
+        Lt,
+        Le,
+        Gt,
+        Ge,
+        Eq,
+        Ne,
+        And,
+        Or,
+    };
+
+    struct Instr {
+        Op op;
+        uint8_t signal = 0;
+        double constant = 0.0;
+    };
+
+    // Deepest operand stack any rule may need; longer expressions are rejected.
+    static constexpr size_t kMaxStackDepth = 32;
+
+private:
+    struct Rule {
+        std::string name;
+        uint32_t code_begin;
+        uint32_t code_end;
+        int64_t hold_ms;
+        int64_t true_since_ms = -1;
+        bool active = false;
+    };
+
+    std::vector<Instr> code;
+    std::vector<Rule> rules;
+    // Last fresh value of each signal and when it was sampled (for the signals in
+    // `sampled`), and the rate between its last two fresh samples.
+    double previous[kSignalCount] = {};
+    int64_t previous_timestamp_ms[kSignalCount] = {};
+    uint8_t sampled = 0;
+    double rates[kSignalCount] = {};
+};
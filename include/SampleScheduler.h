@@ -0,0 +1,29 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "Engine.h"
+
+// Fixed-rate deadlines for each signal. due() returns the signals whose deadline
+// has passed and moves those deadlines forward by whole periods, so a late tick
+// skips missed samples instead of bursting to catch up and rates do not drift.
+class SampleScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // One period per signal in EngineSample field order; all signals start due at `start`.
+    SampleScheduler(const std::array<Clock::duration, kSignalCount>& periods, Clock::time_point start);
+    uint8_t due(Clock::time_point now);
+    // Earliest deadline of any signal: when the caller should wake next.
+    Clock::time_point nextDeadline() const;
+    // True when the signals do not all share one period.
+    bool multiRate() const { return multi_rate; }
+
+    // Period for a rate in Hz; rates <= 0 fall back to `fallback`.
+    static Clock::duration periodFor(double rate_hz, Clock::duration fallback);
+
+private:
+    std::array<Clock::duration, kSignalCount> periods;
+    std::array<Clock::time_point, kSignalCount> deadlines;
+    bool multi_rate = false;
+};
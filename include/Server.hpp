@@ -2,33 +2,1876 @@
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <cerrno>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <google/protobuf/arena.h>
+#include <spdlog/spdlog.h>
+#include "BulkPool.h"
 #include "Engine.h"
+#include "HistoryExport.h"
+#include "HttpGateway.h"
+#include "MulticastPublisher.hpp"
+#include "RollingStats.h"
+#include "RuleEngine.h"
+#include "SampleScheduler.h"
+#include "ServerConfig.h"
+#include "ShmPublisher.h"
+#include "SignalProto.h"
+#include "SlabPool.h"
+#include "SpscQueue.hpp"
+#include "Trace.h"
+#include "Transport.h"
+#include "WarmStart.h"
 #include "engine_data.pb.h"
 
-class Server {
+// Per-client counters as published by the server thread (refreshed every poll
+// timeout, so up to 100 ms old).
+struct ClientCounters {
+    uint64_t id = 0;
+    int fd = -1;
+    uint64_t requests = 0;
+    // Times the client ran out of tokens and its reads were deferred.
+    uint64_t throttled = 0;
+    uint64_t bytes_received = 0;
+    uint64_t bytes_sent = 0;
+};
+
+// Server-wide admission counters.
+struct ServerCounters {
+    uint64_t accepted = 0;
+    // Clients closed on accept because max_connections was reached.
+    uint64_t refused = 0;
+    uint64_t throttled = 0;
+    size_t active = 0;
+    // Long-poll requests parked until the next sample.
+    size_t waiting = 0;
+    // WebSocket clients of the HTTP gateway receiving the sample stream.
+    size_t streaming = 0;
+    // Samples encoded for the stream; each encoding is sent to every streaming client.
+    uint64_t stream_updates = 0;
+    // Exports admitted to the bulk workers, those refused because max_jobs were
+    // running, and those abandoned by their client.
+    size_t exports = 0;
+    uint64_t exports_refused = 0;
+    uint64_t exports_cancelled = 0;
+};
+
+// Counters of one sampling pipeline stage (acquire, transform, publish, persist).
+struct StageStats {
+    const char* name = "";
+    // Samples waiting in the queue in front of the stage; the acquire stage has none.
+    size_t depth = 0;
+    size_t capacity = 0;
+    size_t high_water = 0;
+    uint64_t processed = 0;
+    // Samples the queue dropped under its overflow policy.
+    uint64_t dropped = 0;
+    // From acquisition until the stage finished with a sample.
+    double mean_latency_us = 0.0;
+    double max_latency_us = 0.0;
+};
+
+// The server is parameterized on its engine and socket transport so the per-tick
+// sampling and the request path are resolved at compile time. Production code uses
+// the `Server` alias below; tests and benchmarks can plug in fake engines and
+// in-memory transports without touching libc.
+template <EngineSource EngineT = EngineImpl, SocketTransport TransportT = PosixTransport>
+class BasicServer {
 
 public: // Methods
-    Server();
+    explicit BasicServer(ServerConfig config = {});
     void start(int updateIntervalMs);
     void stop();
     int getLatestRpm();
     int getLatestTemperature();
     int getLatestOilPressure();
     int getLatestSpeed();
+    EngineSample getLatestSample();
+    EngineSnapshot getLatestSnapshot();
+    // Rolling-window statistics as of the latest sample, one entry per configured window.
+    std::vector<WindowSummary> getLatestStats();
+    std::vector<ClientCounters> getClientCounters();
+    ServerCounters getCounters();
+    // Connection and I/O buffer pools: connections, buffers, large buffers.
+    std::vector<SlabStats> getMemoryStats();
+    // One entry per stage, in pipeline order.
+    std::vector<StageStats> getPipelineStats();
+    EngineT& engine() { return engine_; }
+    TransportT& transport() { return transport_; }
+
+private: // Types
+    // A sample on its way through the pipeline.
+    struct StagedSample {
+        EngineSnapshot snapshot;
+        // steady_clock nanoseconds when the tick that acquired it started.
+        int64_t acquired_ns = 0;
+        // The transform stage raised alerts on it; the persist stage stores them.
+        bool alerts = false;
+    };
+    enum Stage { kAcquire, kTransform, kPublish, kPersist, kStageCount };
+    struct StageCounters {
+        std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> latency_total_ns{0};
+        std::atomic<uint64_t> latency_max_ns{0};
+    };
+    using StageQueue = SpscQueue<StagedSample>;
+    struct Listener {
+        int fd;
+        bool seqpacket;
+        bool tcp;
+        // The HTTP gateway's listener.
+        bool http;
+    };
+    // An export on the bulk lane. Each step reads the next chunk on the job's own
+    // read-only connection and encodes it as a complete frame for server_thread to
+    // copy out; the first step opens the cursor.
+    struct ExportJob : BulkJob {
+        std::string db_path;
+        int64_t from_ms = 0;
+        int64_t to_ms = 0;
+        int64_t step_ms = 0;
+        ExportFormat format = ExportFormat::Csv;
+        size_t chunk_rows = HistoryCursor::kDefaultChunkRows;
+        HistoryCursor cursor;
+        bool opened = false;
+        // Output of the last step, read by server_thread once ready().
+        std::string frame;
+        bool last = false;
+        bool failed = false;
+
+        void step() override
+        {
+            data.clear();
+            if (!opened)
+            {
+                opened = true;
+                failed = !cursor.open(db_path, from_ms, to_ms, format, step_ms);
+            }
+            if (!failed)
+            {
+                cursor.next(data, chunk_rows);
+                failed = cursor.failed();
+            }
+            last = failed || cursor.done();
+            msg.Clear();
+            ExportChunk* chunk = msg.mutable_export_chunk();
+            chunk->set_data(data);
+            chunk->set_last(last);
+            chunk->set_failed(failed);
+            const size_t payload_size = msg.ByteSizeLong();
+            frame.resize(sizeof(uint32_t) + payload_size);
+            const uint32_t size = htonl(static_cast<uint32_t>(payload_size));
+            std::memcpy(frame.data(), &size, sizeof(size));
+            msg.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(frame.data() + sizeof(size)));
+        }
+
+    private:
+        std::string data;
+        EngineData msg;
+    };
+    // What a connection speaks: the framed socket protocol, HTTP/1.1 requests, or a
+    // WebSocket upgraded from HTTP.
+    enum class Protocol { Frames, Http, WebSocket };
+    // Lives in connection_pool; its buffers draw on buffer_resource.
+    struct Connection {
+        explicit Connection(std::pmr::memory_resource* buffers) : in(buffers), out(buffers), out_frames(buffers) {}
+
+        int fd = -1;
+        Protocol protocol = Protocol::Frames;
+        bool seqpacket = false;
+        // TCP_QUICKACK is re-armed after every read.
+        bool quickack = false;
+        bool closing = false;
+        // Closed once its output is sent (HTTP Connection: close, WebSocket close);
+        // nothing more is read meanwhile.
+        bool close_when_flushed = false;
+        // Subscribed to pushed alert frames (Request.subscribe_alerts).
+        bool alerts = false;
+        // Parked long poll: answered once the sequence passes wait_after or at
+        // wait_deadline. Nothing more is read from the connection meanwhile.
+        bool waiting = false;
+        bool wait_stats = false;
+        uint64_t wait_after = 0;
+        std::chrono::steady_clock::time_point wait_deadline;
+        // WebSocket: sequence of the last sample streamed to the client.
+        uint64_t streamed_sequence = 0;
+        // Partially received structured request, HTTP request head or WebSocket frame.
+        std::pmr::string in;
+        // Encoded frames the socket has not accepted yet: out[out_offset, end). The
+        // buffers keep their capacity, so a warmed-up connection does not allocate.
+        std::pmr::string out;
+        size_t out_offset = 0;
+        // SOCK_SEQPACKET only: sizes of the queued frames, each sent as one record.
+        std::pmr::vector<uint32_t> out_frames;
+        size_t out_frame_head = 0;
+        // Token bucket; may go negative when one read carries several requests.
+        double tokens = 0.0;
+        std::chrono::steady_clock::time_point refilled;
+        bool throttled = false;
+        ClientCounters counters;
+        // Export in progress, advanced one chunk at a time while output has room.
+        // export_queued: a step of it is with the bulk workers.
+        std::shared_ptr<ExportJob> export_job;
+        bool export_queued = false;
+
+        size_t pendingBytes() const { return out.size() - out_offset; }
+    };
+    // Per-client output backlog above which the server stops reading its requests.
+    static constexpr size_t kMaxPendingBytes = 64 * 1024;
+    // First byte of a structured request frame (marker, 4-byte size, Request).
+    static constexpr unsigned char kRequestMarker = 0xA5;
+    static constexpr size_t kRequestHeaderBytes = 1 + sizeof(uint32_t);
+    static constexpr uint32_t kMaxRequestBytes = 4096;
+    // Alert events waiting for server_thread; older ones are dropped beyond this.
+    static constexpr size_t kMaxPendingAlerts = 1024;
+    // Response messages are built in this much preallocated arena space.
+    static constexpr size_t kArenaBlockBytes = 16 * 1024;
 
 private: // Methods
     void run();
+    int openTcpListener(uint16_t port);
+    bool setSocketOption(int fd, int level, int name, int value, const char* label);
+    void tuneTcpListener(int fd);
+    int openUnixListener();
+    void acceptClients(const Listener& listener);
+    bool mayRead(Connection& c, std::chrono::steady_clock::time_point now, int& timeout_ms);
+    void chargeRequest(Connection& c);
+    void publishCounters();
+    void handleReadable(Connection& c);
+    void appendInput(Connection& c, const char* data, size_t size);
+    void processRequests(Connection& c);
+    void handleRequest(Connection& c, const Request& request);
+    void processHttp(Connection& c);
+    void handleHttpRequest(Connection& c, const http::RequestHead& head);
+    void respondHttp(Connection& c, int status, std::string_view body, bool keep_alive);
+    void processWebSocket(Connection& c);
+    bool refreshStreamFrame();
+    void broadcastStream();
+    bool parkRequest(Connection& c, const Request& request);
+    void releaseWaiters(std::chrono::steady_clock::time_point now);
+    void startExport(Connection& c, const ExportRequest& request);
+    void pumpExports();
+    void cancelExport(Connection& c);
+    void initPools();
+    void releaseConnection(Connection& c);
+    void appendExportChunk(Connection& c, const std::string& data, bool last, bool failed);
+    void appendLatest(Connection& c, bool include_stats = false);
+    void appendMessage(Connection& c, const EngineData& msg);
+    void appendFrame(Connection& c, const char* frame, size_t size);
+    void pushAlerts();
+    void flush(Connection& c);
+    void closeConnection(Connection& c);
     void updateDataLoop();
+    void transformLoop();
+    void publishLoop();
+    void persistLoop();
+    void finishStage(Stage stage, const StagedSample& item);
+    StageStats stageStats(Stage stage) const;
+    void storeAlerts();
+    void publish(const EngineSnapshot& snapshot);
+    void publishShm(const EngineSnapshot& snapshot);
+    void warmStart();
+    void raiseAlerts(const std::vector<AlertEvent>& events);
+    EngineSample sampleSignals(uint8_t signals);
+    void store(const EngineSnapshot& snapshot);
+    static EngineT makeEngine(const StorageConfig& storage);
 
 private: // Data members
-    EngineImpl engine;
+    EngineT engine_;
+    TransportT transport_;
+    ServerConfig config;
+    ShmPublisher shm_publisher;
+    MulticastPublisher<TransportT> multicast_publisher;
     std::mutex data_mutex;
     int updateIntervalMs;
-    int latest_rpm;
-    int latest_temperature;
-    int latest_oil_pressure;
-    int latest_speed;
+    EngineSample latest;
+    uint64_t latest_sequence;
+    int64_t latest_timestamp_ms;
+    std::array<int64_t, kSignalCount> latest_field_timestamp_ms{};
+    // Set by start(). With signals at different rates responses carry field timestamps.
+    std::array<SampleScheduler::Clock::duration, kSignalCount> sampling_periods{};
+    bool multi_rate = false;
+    // Updated by data_thread only; the summary below is what readers see.
+    RollingStats stats;
+    std::vector<WindowSummary> latest_stats;
+    // Compiled alert rules and their per-sample output; data_thread only.
+    RuleEngine rule_engine;
+    std::vector<AlertEvent> alert_events;
+    // Alert events handed to server_thread, guarded by data_mutex.
+    std::deque<AlertEvent> pending_alerts;
+    // Alert events handed to persist_thread, guarded by data_mutex.
+    std::deque<AlertEvent> unstored_alerts;
+    // Queues in front of the transform, publish and persist stages; created by start().
+    std::unique_ptr<StageQueue> transform_queue;
+    std::unique_ptr<StageQueue> publish_queue;
+    std::unique_ptr<StageQueue> persist_queue;
+    std::array<StageCounters, kStageCount> stage_counters;
+    // Lets data_thread and the bulk workers interrupt server_thread's poll(); -1 if
+    // unavailable.
+    int wake_fd = -1;
+    // The bulk lane: exports run here so the poll loop only copies their frames.
+    BulkPool bulk;
+    std::atomic<uint64_t> exports_refused{0};
+    std::atomic<uint64_t> exports_cancelled{0};
     std::atomic<bool> running;
     std::thread server_thread;
     std::thread data_thread;
+    std::thread transform_thread;
+    std::thread publish_thread;
+    std::thread persist_thread;
+    // Owned by server_thread. Connection objects and their buffers come from slab
+    // pools sized by config.memory and set up by start().
+    SlabObjectPool<Connection> connection_pool;
+    SlabPool buffer_pool;
+    SlabPool large_buffer_pool;
+    SlabResource buffer_resource{&buffer_pool, &large_buffer_pool};
+    std::vector<Listener> listeners;
+    std::vector<std::reference_wrapper<Connection>> connections;
+    uint64_t next_client_id = 1;
+    bool refusing = false;
+    std::atomic<uint64_t> accepted_clients{0};
+    std::atomic<uint64_t> refused_clients{0};
+    std::atomic<uint64_t> throttled_reads{0};
+    // Parked long polls. Written by server_thread; data_thread wakes it only while
+    // this is non-zero.
+    std::atomic<size_t> waiting_clients{0};
+    // WebSocket clients. Written by server_thread; data_thread wakes it after each
+    // sample while this is non-zero.
+    std::atomic<size_t> stream_clients{0};
+    std::atomic<uint64_t> stream_updates{0};
+    // Copy of the per-client counters and pool usage for other threads.
+    std::mutex counters_mutex;
+    std::vector<ClientCounters> client_counters;
+    std::vector<SlabStats> memory_stats;
+    // Reused for every request so the steady-state request path does not allocate.
+    Request request_;
+    alignas(std::max_align_t) char arena_block[kArenaBlockBytes];
+    google::protobuf::Arena arena{arena_block, sizeof(arena_block)};
+    std::string alert_frame;
+    // The latest sample as a WebSocket text frame, encoded once per sample and
+    // copied to every streaming client; server_thread only.
+    std::string stream_json;
+    std::string stream_frame;
+    uint64_t stream_sequence = 0;
+    std::string http_body;
+    // HTTP and WebSocket output is built here, then copied to the connection.
+    std::string http_out;
 };
+
+using Server = BasicServer<>;
+
+// The default instantiation is compiled once in Server.cpp.
+extern template class BasicServer<EngineImpl, PosixTransport>;
+
+// Engines that accept a StorageConfig are built from config.storage; others (test
+// fakes) are default-constructed. Returned as a prvalue, so EngineT need not be movable.
+template <EngineSource EngineT, SocketTransport TransportT>
+EngineT BasicServer<EngineT, TransportT>::makeEngine(const StorageConfig& storage)
+{
+    if constexpr (std::constructible_from<EngineT, const StorageConfig&>)
+        return EngineT(storage);
+    else
+        return EngineT();
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+BasicServer<EngineT, TransportT>::BasicServer(ServerConfig config)
+    : engine_(makeEngine(config.storage)), config(std::move(config)), multicast_publisher(transport_), updateIntervalMs(200), latest{}, latest_sequence(0), latest_timestamp_ms(0),
+      stats(this->config.stats.windows_ms), running(true)
+{
+    for (const std::string& rule : this->config.alerts.rules)
+    {
+        std::string error;
+        if (!rule_engine.addRule(rule, &error))
+            spdlog::error("Ignoring alert rule '{}': {}", rule, error);
+    }
+    if (rule_engine.size() > 0)
+        spdlog::info("{} alert rules compiled", rule_engine.size());
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::start(int updateIntervalMs)
+{
+    this->updateIntervalMs = updateIntervalMs;
+    for (size_t i = 0; i < kSignalCount; ++i)
+        sampling_periods[i] = SampleScheduler::periodFor(config.sampling.rate_hz[i], std::chrono::milliseconds(updateIntervalMs));
+    multi_rate = SampleScheduler(sampling_periods, SampleScheduler::Clock::now()).multiRate();
+    if (config.shm.enabled && !shm_publisher.open(config.shm.name, config.shm.ring_capacity))
+        spdlog::error("Shared-memory snapshot disabled");
+    const MulticastConfig& mcast = config.multicast;
+    if (mcast.enabled && !multicast_publisher.open(mcast.group, mcast.port, mcast.interface_address, mcast.ttl, mcast.loopback))
+        spdlog::error("Multicast publisher disabled");
+    warmStart();
+    initPools();
+    wake_fd = transport_.openWakeFd();
+    if (wake_fd < 0)
+        spdlog::warn("Wake-up descriptor unavailable, alerts are delivered on the poll timeout");
+    const HistoryConfig& history = config.history;
+    bulk.start(std::max<size_t>(1, history.workers), history.max_jobs, history.worker_nice, [this] {
+        if (wake_fd >= 0)
+            transport_.wake(wake_fd);
+    });
+    const PipelineConfig& pipeline = config.pipeline;
+    transform_queue = std::make_unique<StageQueue>(pipeline.transform.capacity, pipeline.transform.overflow);
+    publish_queue = std::make_unique<StageQueue>(pipeline.publish.capacity, pipeline.publish.overflow);
+    persist_queue = std::make_unique<StageQueue>(pipeline.persist.capacity, pipeline.persist.overflow);
+    server_thread = std::thread(&BasicServer::run, this);
+    persist_thread = std::thread(&BasicServer::persistLoop, this);
+    publish_thread = std::thread(&BasicServer::publishLoop, this);
+    transform_thread = std::thread(&BasicServer::transformLoop, this);
+    data_thread = std::thread(&BasicServer::updateDataLoop, this);
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::stop()
+{
+    running = false;
+    spdlog::info("Server::stop");
+    if (server_thread.joinable())
+        server_thread.join();
+    spdlog::info("server_thread stopped");
+    bulk.stop();
+    if (data_thread.joinable())
+        data_thread.join();
+    spdlog::info("data_thread stopped");
+    // Each stage drains its queue, then closes the next one.
+    for (std::thread* stage : {&transform_thread, &publish_thread, &persist_thread})
+    {
+        if (stage->joinable())
+            stage->join();
+    }
+    spdlog::info("pipeline stopped");
+    shm_publisher.close();
+    multicast_publisher.close();
+    if (wake_fd >= 0)
+    {
+        transport_.close(wake_fd);
+        wake_fd = -1;
+    }
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+int BasicServer<EngineT, TransportT>::getLatestRpm()
+{
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return latest.rpm;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+int BasicServer<EngineT, TransportT>::getLatestTemperature()
+{
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return latest.temperature;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+int BasicServer<EngineT, TransportT>::getLatestOilPressure()
+{
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return latest.oil_pressure;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+int BasicServer<EngineT, TransportT>::getLatestSpeed()
+{
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return latest.speed;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+EngineSample BasicServer<EngineT, TransportT>::getLatestSample()
+{
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return latest;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+EngineSnapshot BasicServer<EngineT, TransportT>::getLatestSnapshot()
+{
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return EngineSnapshot{latest, latest_sequence, latest_timestamp_ms, kAllSignals, latest_field_timestamp_ms};
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+std::vector<WindowSummary> BasicServer<EngineT, TransportT>::getLatestStats()
+{
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return latest_stats;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+std::vector<ClientCounters> BasicServer<EngineT, TransportT>::getClientCounters()
+{
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    return client_counters;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+ServerCounters BasicServer<EngineT, TransportT>::getCounters()
+{
+    ServerCounters counters;
+    counters.accepted = accepted_clients.load();
+    counters.refused = refused_clients.load();
+    counters.waiting = waiting_clients.load();
+    counters.streaming = stream_clients.load();
+    counters.stream_updates = stream_updates.load();
+    counters.exports = bulk.admitted();
+    counters.exports_refused = exports_refused.load();
+    counters.exports_cancelled = exports_cancelled.load();
+    counters.throttled = throttled_reads.load();
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    counters.active = client_counters.size();
+    return counters;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+std::vector<SlabStats> BasicServer<EngineT, TransportT>::getMemoryStats()
+{
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    return memory_stats;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+std::vector<StageStats> BasicServer<EngineT, TransportT>::getPipelineStats()
+{
+    std::vector<StageStats> stages;
+    for (int stage = kAcquire; stage < kStageCount; ++stage)
+        stages.push_back(stageStats(static_cast<Stage>(stage)));
+    return stages;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+StageStats BasicServer<EngineT, TransportT>::stageStats(Stage stage) const
+{
+    static constexpr const char* kNames[kStageCount] = {"acquire", "transform", "publish", "persist"};
+    const StageQueue* queues[kStageCount] = {nullptr, transform_queue.get(), publish_queue.get(), persist_queue.get()};
+    StageStats out;
+    out.name = kNames[stage];
+    if (const StageQueue* queue = queues[stage])
+    {
+        out.depth = queue->size();
+        out.capacity = queue->capacity();
+        out.high_water = queue->highWater();
+        out.dropped = queue->dropped();
+    }
+    const StageCounters& counters = stage_counters[stage];
+    out.processed = counters.processed.load(std::memory_order_relaxed);
+    if (out.processed > 0)
+        out.mean_latency_us = counters.latency_total_ns.load(std::memory_order_relaxed) / 1000.0 / out.processed;
+    out.max_latency_us = counters.latency_max_ns.load(std::memory_order_relaxed) / 1000.0;
+    return out;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+bool BasicServer<EngineT, TransportT>::setSocketOption(int fd, int level, int name, int value, const char* label)
+{
+    if (transport_.setsockopt(fd, level, name, &value, sizeof(value)) == 0)
+        return true;
+    spdlog::warn("setsockopt {}={} failed: {}", label, value, std::strerror(errno));
+    return false;
+}
+
+// Applies the socket profile to the TCP listener before listen(); accepted
+// connections inherit these options.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::tuneTcpListener(int fd)
+{
+    const SocketConfig& cfg = config.socket;
+    if (cfg.send_buffer_bytes > 0)
+        setSocketOption(fd, SOL_SOCKET, SO_SNDBUF, cfg.send_buffer_bytes, "SO_SNDBUF");
+    if (cfg.receive_buffer_bytes > 0)
+        setSocketOption(fd, SOL_SOCKET, SO_RCVBUF, cfg.receive_buffer_bytes, "SO_RCVBUF");
+    if (cfg.tcp_nodelay)
+        setSocketOption(fd, IPPROTO_TCP, TCP_NODELAY, 1, "TCP_NODELAY");
+    if (cfg.busy_poll_us > 0)
+        setSocketOption(fd, SOL_SOCKET, SO_BUSY_POLL, cfg.busy_poll_us, "SO_BUSY_POLL");
+    if (cfg.keepalive)
+    {
+        setSocketOption(fd, SOL_SOCKET, SO_KEEPALIVE, 1, "SO_KEEPALIVE");
+        setSocketOption(fd, IPPROTO_TCP, TCP_KEEPIDLE, cfg.keepalive_idle_s, "TCP_KEEPIDLE");
+        setSocketOption(fd, IPPROTO_TCP, TCP_KEEPINTVL, cfg.keepalive_interval_s, "TCP_KEEPINTVL");
+        setSocketOption(fd, IPPROTO_TCP, TCP_KEEPCNT, cfg.keepalive_count, "TCP_KEEPCNT");
+    }
+    if (cfg.user_timeout_ms > 0)
+        setSocketOption(fd, IPPROTO_TCP, TCP_USER_TIMEOUT, cfg.user_timeout_ms, "TCP_USER_TIMEOUT");
+    if (cfg.incoming_cpu >= 0)
+        setSocketOption(fd, SOL_SOCKET, SO_INCOMING_CPU, cfg.incoming_cpu, "SO_INCOMING_CPU");
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+int BasicServer<EngineT, TransportT>::openTcpListener(uint16_t port)
+{
+    int server_fd;
+    struct sockaddr_in address;
+
+    if ((server_fd = transport_.socket(AF_INET, SOCK_STREAM, 0)) < 0)
+    {
+        spdlog::error("socket failed");
+        return -1;
+    }
+    // Set server_fd to non-blocking
+    if (!transport_.setNonBlocking(server_fd)) {
+        spdlog::error("fcntl O_NONBLOCK");
+        transport_.close(server_fd);
+        return -1;
+    }
+    spdlog::info("Socket server created");
+    if (!setSocketOption(server_fd, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR") ||
+        !setSocketOption(server_fd, SOL_SOCKET, SO_REUSEPORT, 1, "SO_REUSEPORT"))
+    {
+        transport_.close(server_fd);
+        return -1;
+    }
+    tuneTcpListener(server_fd);
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = INADDR_ANY;
+    address.sin_port = htons(port);
+    if (transport_.bind(server_fd, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        spdlog::error("bind failed");
+        transport_.close(server_fd);
+        return -1;
+    }
+    if (transport_.listen(server_fd, config.socket.backlog) < 0)
+    {
+        spdlog::error("listen failed");
+        transport_.close(server_fd);
+        return -1;
+    }
+    spdlog::info("Socket server started on port {} (backlog {})", port, config.socket.backlog);
+    return server_fd;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+int BasicServer<EngineT, TransportT>::openUnixListener()
+{
+    const UnixSocketConfig& cfg = config.unix_socket;
+    struct sockaddr_un address{};
+    if (cfg.path.empty() || cfg.path.size() >= sizeof(address.sun_path))
+    {
+        spdlog::error("Invalid unix socket path '{}'", cfg.path);
+        return -1;
+    }
+    const int type = cfg.seqpacket ? SOCK_SEQPACKET : SOCK_STREAM;
+    int fd = transport_.socket(AF_UNIX, type, 0);
+    if (fd < 0)
+    {
+        spdlog::error("unix socket failed");
+        return -1;
+    }
+    if (!transport_.setNonBlocking(fd))
+    {
+        spdlog::error("fcntl O_NONBLOCK (unix socket)");
+        transport_.close(fd);
+        return -1;
+    }
+    // A stale socket file from a previous run would make bind() fail.
+    ::unlink(cfg.path.c_str());
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, cfg.path.c_str(), cfg.path.size() + 1);
+    if (transport_.bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        spdlog::error("bind failed for unix socket {}", cfg.path);
+        transport_.close(fd);
+        return -1;
+    }
+    if (transport_.listen(fd, config.socket.backlog) < 0)
+    {
+        spdlog::error("listen failed for unix socket {}", cfg.path);
+        transport_.close(fd);
+        ::unlink(cfg.path.c_str());
+        return -1;
+    }
+    spdlog::info("Unix socket server started on {} ({})", cfg.path, cfg.seqpacket ? "SOCK_SEQPACKET" : "SOCK_STREAM");
+    return fd;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::run()
+{
+    Trace::setThreadName("server");
+    listeners.clear();
+    connections.clear();
+    // The arena hands out memory from the thread that last reset it.
+    arena.Reset();
+    stream_sequence = 0;
+    stream_frame.clear();
+    int tcp_fd = openTcpListener(config.socket.port);
+    if (tcp_fd >= 0)
+        listeners.push_back({tcp_fd, false, true, false});
+    if (config.unix_socket.enabled)
+    {
+        int unix_fd = openUnixListener();
+        if (unix_fd >= 0)
+            listeners.push_back({unix_fd, config.unix_socket.seqpacket, false, false});
+    }
+    if (config.http.enabled)
+    {
+        int http_fd = openTcpListener(config.http.port);
+        if (http_fd >= 0)
+        {
+            listeners.push_back({http_fd, false, true, true});
+            spdlog::info("HTTP gateway on port {}: GET /latest, WebSocket /stream", config.http.port);
+        }
+    }
+
+    // One poll() set covers every listener and client so no connection can hold up
+    // the others, and the loop wakes up at least every kPollTimeoutMs to notice stop().
+    constexpr int kPollTimeoutMs = 100;
+    std::vector<pollfd> fds;
+    bool fatal_error = listeners.empty();
+    auto next_publish = std::chrono::steady_clock::now();
+    while (running && !fatal_error)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= next_publish)
+        {
+            publishCounters();
+            next_publish = now + std::chrono::milliseconds(kPollTimeoutMs);
+        }
+        int timeout_ms = kPollTimeoutMs;
+        if (waiting_clients.load(std::memory_order_relaxed) > 0)
+            releaseWaiters(now);
+        if (stream_clients.load(std::memory_order_relaxed) > 0)
+            broadcastStream();
+        fds.clear();
+        for (const Listener& l : listeners)
+            fds.push_back({l.fd, POLLIN, 0});
+        for (Connection& c : connections)
+        {
+            short events = 0;
+            // Stop reading requests from clients that do not drain their responses or
+            // are out of tokens; the kernel then pushes back on them, not on others.
+            if (!c.waiting && !c.close_when_flushed && c.pendingBytes() < kMaxPendingBytes && mayRead(c, now, timeout_ms))
+                events |= POLLIN;
+            if (c.waiting)
+            {
+                const auto wait = std::chrono::ceil<std::chrono::milliseconds>(c.wait_deadline - now).count();
+                timeout_ms = std::min(timeout_ms, static_cast<int>(std::max<int64_t>(0, wait)));
+            }
+            if (c.pendingBytes() > 0)
+                events |= POLLOUT;
+            // Without a wake-up descriptor, poll for finished export steps.
+            if (wake_fd < 0 && c.export_queued)
+                timeout_ms = std::min(timeout_ms, 1);
+            fds.push_back({c.fd, events, 0});
+        }
+        const size_t wake_index = fds.size();
+        if (wake_fd >= 0)
+            fds.push_back({wake_fd, POLLIN, 0});
+
+        int ready = transport_.poll(fds.data(), fds.size(), timeout_ms);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            spdlog::error("poll failed: {}", std::strerror(errno));
+            break;
+        }
+        if (wake_fd < 0 || (fds[wake_index].revents & POLLIN))
+        {
+            if (wake_fd >= 0)
+                transport_.drainWake(wake_fd);
+            pushAlerts();
+        }
+        if (ready == 0 && timeout_ms > 0)
+            continue;
+
+        // Connections first: accepting appends to `connections`, which would shift
+        // indices relative to `fds`.
+        for (size_t i = 0; i < connections.size(); ++i)
+        {
+            const short revents = fds[listeners.size() + i].revents;
+            Connection& c = connections[i];
+            if (revents & (POLLERR | POLLNVAL))
+                c.closing = true;
+            // A parked client is not read; hanging up ends its wait.
+            if (c.waiting && (revents & POLLHUP))
+                c.closing = true;
+            if (!c.closing && (revents & (POLLIN | POLLHUP)))
+            {
+                TraceScope span("request");
+                handleReadable(c);
+            }
+            if (!c.closing && (revents & POLLOUT))
+                flush(c);
+        }
+        pumpExports();
+        std::erase_if(connections, [this](Connection& c) {
+            if (!c.closing)
+                return false;
+            if (c.waiting)
+                waiting_clients.fetch_sub(1, std::memory_order_relaxed);
+            if (c.protocol == Protocol::WebSocket)
+                stream_clients.fetch_sub(1, std::memory_order_relaxed);
+            cancelExport(c);
+            closeConnection(c);
+            releaseConnection(c);
+            return true;
+        });
+
+        for (size_t i = 0; i < listeners.size(); ++i)
+        {
+            const short revents = fds[i].revents;
+            if (revents & (POLLERR | POLLNVAL))
+            {
+                spdlog::error("Listener socket error");
+                fatal_error = true;
+            }
+            else if (revents & POLLIN)
+            {
+                acceptClients(listeners[i]);
+            }
+        }
+    }
+
+    for (Connection& c : connections)
+    {
+        cancelExport(c);
+        closeConnection(c);
+        releaseConnection(c);
+    }
+    connections.clear();
+    waiting_clients = 0;
+    stream_clients = 0;
+    publishCounters();
+    for (const SlabStats& pool : memory_stats)
+        spdlog::info("Pool {}: high water {} of {} blocks of {} B, {} heap fallbacks{}", pool.name, pool.high_water,
+                     pool.capacity, pool.block_bytes, pool.fallbacks, pool.hugepages ? " (huge pages)" : "");
+    for (const Listener& l : listeners)
+        transport_.close(l.fd);
+    if (config.unix_socket.enabled)
+        ::unlink(config.unix_socket.path.c_str());
+    listeners.clear();
+    spdlog::info("Server stopped.");
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::acceptClients(const Listener& listener)
+{
+    while (running)
+    {
+        int client_fd = transport_.accept(listener.fd, nullptr, nullptr);
+        if (client_fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                spdlog::error("accept failed: {}", std::strerror(errno));
+            return;
+        }
+        const size_t max_connections = config.limits.max_connections;
+        if (max_connections > 0 && connections.size() >= max_connections)
+        {
+            // Refuse before any per-client state exists; log once per episode.
+            transport_.close(client_fd);
+            ++refused_clients;
+            if (!refusing)
+                spdlog::warn("Connection limit of {} reached, refusing new clients", max_connections);
+            refusing = true;
+            continue;
+        }
+        if (!transport_.setNonBlocking(client_fd))
+        {
+            spdlog::error("fcntl O_NONBLOCK (client)");
+            transport_.close(client_fd);
+            continue;
+        }
+        spdlog::info("Client connected.");
+        refusing = false;
+        ++accepted_clients;
+        Connection& c = *connection_pool.create(&buffer_resource);
+        c.fd = client_fd;
+        c.protocol = listener.http ? Protocol::Http : Protocol::Frames;
+        c.seqpacket = listener.seqpacket;
+        c.quickack = listener.tcp && config.socket.tcp_quickack;
+        c.tokens = config.limits.burst;
+        c.refilled = std::chrono::steady_clock::now();
+        c.counters.id = next_client_id++;
+        c.counters.fd = client_fd;
+        // One buffer block up front (the string adds its terminator), so replies and
+        // stats frames that grow by a byte now and then as counters count up do not
+        // reallocate on a warm connection.
+        c.out.reserve(config.memory.buffer_bytes - 1);
+        if (c.seqpacket)
+            c.out_frames.reserve(config.memory.buffer_bytes / sizeof(uint32_t));
+        connections.push_back(c);
+    }
+}
+
+// Refills the client's token bucket. Without a whole token the client is not read
+// and `timeout_ms` is shortened to when the next token arrives.
+template <EngineSource EngineT, SocketTransport TransportT>
+bool BasicServer<EngineT, TransportT>::mayRead(Connection& c, std::chrono::steady_clock::time_point now, int& timeout_ms)
+{
+    const LimitsConfig& limits = config.limits;
+    if (limits.requests_per_second <= 0.0)
+        return true;
+    const double elapsed_s = std::chrono::duration<double>(now - c.refilled).count();
+    c.tokens = std::min(limits.burst, c.tokens + elapsed_s * limits.requests_per_second);
+    c.refilled = now;
+    if (c.tokens >= 1.0)
+    {
+        c.throttled = false;
+        return true;
+    }
+    if (!c.throttled)
+    {
+        c.throttled = true;
+        ++c.counters.throttled;
+        ++throttled_reads;
+    }
+    const int wait_ms = static_cast<int>((1.0 - c.tokens) / limits.requests_per_second * 1000.0) + 1;
+    timeout_ms = std::min(timeout_ms, wait_ms);
+    return false;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::chargeRequest(Connection& c)
+{
+    ++c.counters.requests;
+    c.tokens -= 1.0;
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::publishCounters()
+{
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    client_counters.clear();
+    for (const Connection& c : connections)
+        client_counters.push_back(c.counters);
+    memory_stats = {connection_pool.stats(), buffer_pool.stats(), large_buffer_pool.stats()};
+}
+
+// Plain polls keep the original contract: every read is answered with one snapshot
+// frame and the bytes are not interpreted. Reads starting with kRequestMarker carry
+// structured requests and are reassembled across reads.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::handleReadable(Connection& c)
+{
+    // Large enough for a whole request, so a SOCK_SEQPACKET record is never truncated.
+    char buffer[kRequestHeaderBytes + kMaxRequestBytes];
+    ssize_t valread = transport_.read(c.fd, buffer, sizeof(buffer));
+    if (valread > 0)
+    {
+        c.counters.bytes_received += static_cast<uint64_t>(valread);
+        if (c.quickack)
+        {
+            int one = 1;
+            transport_.setsockopt(c.fd, IPPROTO_TCP, TCP_QUICKACK, &one, sizeof(one));
+        }
+        if (c.protocol != Protocol::Frames)
+        {
+            appendInput(c, buffer, static_cast<size_t>(valread));
+            if (c.protocol == Protocol::Http)
+                processHttp(c);
+            else
+                processWebSocket(c);
+        }
+        else if (c.in.empty() && static_cast<unsigned char>(buffer[0]) != kRequestMarker)
+        {
+            chargeRequest(c);
+            appendLatest(c);
+        }
+        else
+        {
+            appendInput(c, buffer, static_cast<size_t>(valread));
+            processRequests(c);
+        }
+        flush(c);
+    }
+    else if (valread == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+    {
+        c.closing = true;
+    }
+}
+
+// The input buffer takes a whole pooled block the first time it is needed rather
+// than growing through several sizes.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::appendInput(Connection& c, const char* data, size_t size)
+{
+    if (c.in.capacity() < config.memory.buffer_bytes - 1)
+        c.in.reserve(config.memory.buffer_bytes - 1);
+    c.in.append(data, size);
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::processRequests(Connection& c)
+{
+    size_t consumed = 0;
+    while (!c.waiting && c.in.size() - consumed >= kRequestHeaderBytes)
+    {
+        const char* header = c.in.data() + consumed;
+        if (static_cast<unsigned char>(header[0]) != kRequestMarker)
+        {
+            // Plain poll bytes after a structured request: answer once, as before.
+            chargeRequest(c);
+            appendLatest(c);
+            consumed = c.in.size();
+            break;
+        }
+        uint32_t size;
+        std::memcpy(&size, header + 1, sizeof(size));
+        size = ntohl(size);
+        if (size > kMaxRequestBytes)
+        {
+            spdlog::error("Request of {} bytes exceeds limit, closing client", size);
+            c.closing = true;
+            return;
+        }
+        if (c.in.size() - consumed < kRequestHeaderBytes + size)
+            break;
+        if (!request_.ParseFromArray(header + kRequestHeaderBytes, static_cast<int>(size)))
+        {
+            spdlog::error("Malformed request, closing client");
+            c.closing = true;
+            return;
+        }
+        consumed += kRequestHeaderBytes + size;
+        handleRequest(c, request_);
+    }
+    c.in.erase(0, consumed);
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::handleRequest(Connection& c, const Request& request)
+{
+    chargeRequest(c);
+    if (request.subscribe_alerts())
+        c.alerts = true;
+    if (request.has_export_history())
+    {
+        startExport(c, request.export_history());
+        return;
+    }
+    if (request.has_after_sequence() && parkRequest(c, request))
+        return;
+    appendLatest(c, request.include_stats());
+}
+
+// Parks a long poll unless a newer sample already exists. A parked request holds
+// no thread: data_thread wakes the poll loop after each sample while any are
+// parked, and releaseWaiters() answers them.
+template <EngineSource EngineT, SocketTransport TransportT>
+bool BasicServer<EngineT, TransportT>::parkRequest(Connection& c, const Request& request)
+{
+    // Counted before the sequence is read: a sample published after the read then
+    // sees the waiter and wakes the loop.
+    waiting_clients.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(data_mutex);
+        sequence = latest_sequence;
+    }
+    if (sequence > request.after_sequence())
+    {
+        waiting_clients.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+    const uint32_t max_wait_ms = config.limits.max_wait_ms;
+    const uint32_t wait_ms = request.wait_ms() == 0 ? max_wait_ms : std::min(request.wait_ms(), max_wait_ms);
+    c.waiting = true;
+    c.wait_stats = request.include_stats();
+    c.wait_after = request.after_sequence();
+    c.wait_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait_ms);
+    return true;
+}
+
+// Answers the parked long polls that have a newer sample or have timed out, then
+// carries on with the requests queued behind them.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::releaseWaiters(std::chrono::steady_clock::time_point now)
+{
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(data_mutex);
+        sequence = latest_sequence;
+    }
+    for (Connection& c : connections)
+    {
+        if (!c.waiting || c.closing || (sequence <= c.wait_after && now < c.wait_deadline))
+            continue;
+        c.waiting = false;
+        waiting_clients.fetch_sub(1, std::memory_order_relaxed);
+        appendLatest(c, c.wait_stats);
+        if (!c.in.empty())
+            processRequests(c);
+        flush(c);
+    }
+}
+
+// HTTP gateway: request heads are parsed as they complete, so keep-alive clients
+// may pipeline. Requests with a body are refused, which keeps every request a
+// head and nothing else.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::processHttp(Connection& c)
+{
+    size_t consumed = 0;
+    while (c.protocol == Protocol::Http && !c.close_when_flushed)
+    {
+        const std::string_view pending(c.in.data() + consumed, c.in.size() - consumed);
+        http::RequestHead head;
+        const http::ParseStatus status = http::parseRequestHead(pending, head);
+        if (status == http::ParseStatus::Incomplete)
+        {
+            if (pending.size() > http::kMaxHeadBytes)
+            {
+                chargeRequest(c);
+                respondHttp(c, 431, "request head too large\n", false);
+                consumed = c.in.size();
+            }
+            break;
+        }
+        chargeRequest(c);
+        if (status == http::ParseStatus::Malformed || head.has_body)
+        {
+            respondHttp(c, 400, "bad request\n", false);
+            consumed = c.in.size();
+            break;
+        }
+        handleHttpRequest(c, head);
+        consumed += head.length;
+    }
+    c.in.erase(0, consumed);
+    // Frames the client sent right behind its handshake.
+    if (c.protocol == Protocol::WebSocket && !c.in.empty())
+        processWebSocket(c);
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::handleHttpRequest(Connection& c, const http::RequestHead& head)
+{
+    if (head.method != "GET")
+    {
+        respondHttp(c, 405, "only GET is supported\n", head.keep_alive);
+    }
+    else if (head.path == "/latest")
+    {
+        http_body.clear();
+        http::appendSnapshotJson(http_body, getLatestSnapshot(), multi_rate);
+        http_out.clear();
+        http::appendResponse(http_out, 200, "application/json", http_body, head.keep_alive);
+        c.out.append(http_out);
+        c.close_when_flushed = !head.keep_alive;
+    }
+    else if (head.path == "/stream")
+    {
+        if (!head.upgrade_websocket)
+        {
+            respondHttp(c, 426, "WebSocket upgrade required\n", head.keep_alive);
+            return;
+        }
+        if (head.websocket_key.empty() || head.websocket_version != 13)
+        {
+            respondHttp(c, 400, "unsupported WebSocket handshake\n", false);
+            return;
+        }
+        http_out.clear();
+        http::appendUpgradeResponse(http_out, head.websocket_key);
+        c.out.append(http_out);
+        c.protocol = Protocol::WebSocket;
+        spdlog::info("Client {} subscribed to the WebSocket stream", c.counters.id);
+        // Counted before the latest sample is read, as in parkRequest(), so no later
+        // sample goes by without waking the loop.
+        stream_clients.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        refreshStreamFrame();
+        // Before the first sample there is nothing to send; broadcastStream() sends it.
+        if (stream_sequence > 0)
+        {
+            c.out.append(stream_frame);
+            c.streamed_sequence = stream_sequence;
+        }
+    }
+    else
+    {
+        respondHttp(c, 404, "not found; try /latest or /stream\n", head.keep_alive);
+    }
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::respondHttp(Connection& c, int status, std::string_view body, bool keep_alive)
+{
+    http_out.clear();
+    http::appendResponse(http_out, status, "text/plain", body, keep_alive);
+    c.out.append(http_out);
+    c.close_when_flushed = !keep_alive;
+}
+
+// The stream only flows to the client: pings are answered, a close is echoed and
+// data frames are ignored.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::processWebSocket(Connection& c)
+{
+    size_t consumed = 0;
+    while (!c.close_when_flushed)
+    {
+        http::WebSocketFrame frame;
+        const http::ParseStatus status =
+            http::parseWebSocketFrame(c.in.data() + consumed, c.in.size() - consumed, kMaxRequestBytes, frame);
+        if (status == http::ParseStatus::Incomplete)
+            break;
+        if (status == http::ParseStatus::Malformed)
+        {
+            spdlog::error("Malformed WebSocket frame, closing client");
+            c.closing = true;
+            return;
+        }
+        consumed += frame.length;
+        chargeRequest(c);
+        if (frame.opcode == http::kPing)
+        {
+            http_out.clear();
+            http::appendWebSocketFrame(http_out, http::kPong, frame.payload);
+            c.out.append(http_out);
+        }
+        else if (frame.opcode == http::kClose)
+        {
+            // Echo the status code, if any.
+            http_out.clear();
+            http::appendWebSocketFrame(http_out, http::kClose, frame.payload.substr(0, 2));
+            c.out.append(http_out);
+            c.close_when_flushed = true;
+        }
+    }
+    c.in.erase(0, consumed);
+}
+
+// Encodes the latest sample as a WebSocket text frame unless it already is.
+// Returns true if it was encoded.
+template <EngineSource EngineT, SocketTransport TransportT>
+bool BasicServer<EngineT, TransportT>::refreshStreamFrame()
+{
+    EngineSnapshot snapshot;
+    {
+        auto lock = lockTraced(data_mutex, "wait data_mutex");
+        if (latest_sequence == stream_sequence && !stream_frame.empty())
+            return false;
+        snapshot = EngineSnapshot{latest, latest_sequence, latest_timestamp_ms, kAllSignals, latest_field_timestamp_ms};
+    }
+    TraceScope span("encode stream");
+    stream_json.clear();
+    http::appendSnapshotJson(stream_json, snapshot, multi_rate);
+    stream_frame.clear();
+    http::appendWebSocketFrame(stream_frame, http::kText, stream_json);
+    stream_sequence = snapshot.sequence;
+    stream_updates.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Sends the latest sample, encoded once, to every WebSocket client that has not
+// had it. A client still sending an earlier frame is skipped and gets the newest
+// sample once it has caught up, so a slow browser never queues stale samples.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::broadcastStream()
+{
+    refreshStreamFrame();
+    for (Connection& c : connections)
+    {
+        if (c.protocol != Protocol::WebSocket || c.closing || c.close_when_flushed ||
+            c.streamed_sequence == stream_sequence || c.pendingBytes() > 0)
+            continue;
+        c.out.append(stream_frame);
+        c.streamed_sequence = stream_sequence;
+        flush(c);
+    }
+}
+
+// Exports run on the bulk lane (BulkPool), so reading and encoding history never
+// delays the poll loop's live responses. The loop keeps one step of each export in
+// flight, and only while the connection's output is below kMaxPendingBytes. A slow
+// reader thus holds at most one chunk plus its backlog in memory, and exports from
+// different clients take turns chunk by chunk.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::startExport(Connection& c, const ExportRequest& request)
+{
+    cancelExport(c);
+    if (!bulk.admit())
+    {
+        spdlog::warn("Client {} export refused, {} exports running", c.counters.id, config.history.max_jobs);
+        exports_refused.fetch_add(1, std::memory_order_relaxed);
+        appendExportChunk(c, std::string(), true, true);
+        return;
+    }
+    auto job = std::make_shared<ExportJob>();
+    job->db_path = config.history.db_path;
+    job->from_ms = request.from_ms();
+    job->to_ms = request.to_ms() > 0 ? request.to_ms() : std::numeric_limits<int64_t>::max();
+    job->step_ms = request.step_ms();
+    job->format = request.format() == ExportRequest::BINARY ? ExportFormat::Binary : ExportFormat::Csv;
+    job->chunk_rows = config.history.export_chunk_rows;
+    spdlog::info("Client {} started export [{}, {})", c.counters.id, job->from_ms, job->to_ms);
+    c.export_job = std::move(job);
+    c.export_queued = true;
+    bulk.submit(c.export_job);
+}
+
+// Copies finished export steps to their connections and queues the next step of
+// each export whose client has room for another chunk.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::pumpExports()
+{
+    for (Connection& c : connections)
+    {
+        if (!c.export_job || c.closing)
+            continue;
+        if (c.export_queued)
+        {
+            const ExportJob& job = *c.export_job;
+            if (!job.ready())
+                continue;
+            c.export_queued = false;
+            appendFrame(c, job.frame.data(), job.frame.size());
+            if (job.last)
+            {
+                spdlog::info("Client {} export {}, {} rows", c.counters.id, job.failed ? "failed" : "finished",
+                             job.cursor.rowsExported());
+                c.export_job.reset();
+                bulk.retire();
+            }
+            flush(c);
+            if (!c.export_job || c.closing)
+                continue;
+        }
+        if (c.pendingBytes() < kMaxPendingBytes)
+        {
+            c.export_queued = true;
+            bulk.submit(c.export_job);
+        }
+    }
+}
+
+// The client is gone or replaced its export: a queued step is skipped and the job's
+// place is freed; a step already running finishes its chunk.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::cancelExport(Connection& c)
+{
+    if (!c.export_job)
+        return;
+    c.export_job->cancel();
+    c.export_job.reset();
+    c.export_queued = false;
+    bulk.retire();
+    exports_cancelled.fetch_add(1, std::memory_order_relaxed);
+    spdlog::info("Client {} export cancelled", c.counters.id);
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::appendExportChunk(Connection& c, const std::string& data, bool last, bool failed)
+{
+    EngineData* msg = google::protobuf::Arena::CreateMessage<EngineData>(&arena);
+    ExportChunk* chunk = msg->mutable_export_chunk();
+    chunk->set_data(data);
+    chunk->set_last(last);
+    chunk->set_failed(failed);
+    appendMessage(c, *msg);
+    arena.Reset();
+}
+
+inline void toProto(const SignalSummary& in, SignalStats* out)
+{
+    out->set_mean(in.mean);
+    out->set_min(in.min);
+    out->set_max(in.max);
+    out->set_rate_per_s(in.rate_per_s);
+    out->set_ewma(in.ewma);
+    out->set_p50(in.p50);
+    out->set_p90(in.p90);
+    out->set_p99(in.p99);
+}
+
+// Encodes the latest snapshot into the connection's output buffer. The message lives
+// in the arena, which is reset afterwards, so no memory is allocated once warm.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::appendLatest(Connection& c, bool include_stats)
+{
+    EngineData* msg = google::protobuf::Arena::CreateMessage<EngineData>(&arena);
+    {
+        auto lock = lockTraced(data_mutex, "wait data_mutex");
+        setSignals(*msg, latest);
+        msg->set_sequence(latest_sequence);
+        msg->set_timestamp_ms(latest_timestamp_ms);
+        if (multi_rate)
+        {
+            for (int64_t t : latest_field_timestamp_ms)
+                msg->add_field_timestamp_ms(t);
+        }
+        if (include_stats)
+        {
+            for (const WindowSummary& w : latest_stats)
+            {
+                WindowStats* out = msg->add_windows();
+                out->set_window_ms(static_cast<uint32_t>(w.window_ms));
+                out->set_count(w.count);
+                forEachSignal([&](auto i) { toProto(w.signals[i], (out->*kSignalProtoFields[i].mutable_stats)()); });
+            }
+        }
+    }
+    if (include_stats && transform_queue)
+    {
+        // Stage counters are atomics; no lock needed.
+        for (int stage = kAcquire; stage < kStageCount; ++stage)
+        {
+            const StageStats s = stageStats(static_cast<Stage>(stage));
+            PipelineStage* out = msg->add_pipeline();
+            out->set_name(s.name);
+            out->set_depth(static_cast<uint32_t>(s.depth));
+            out->set_capacity(static_cast<uint32_t>(s.capacity));
+            out->set_high_water(static_cast<uint32_t>(s.high_water));
+            out->set_processed(s.processed);
+            out->set_dropped(s.dropped);
+            out->set_mean_latency_us(s.mean_latency_us);
+            out->set_max_latency_us(s.max_latency_us);
+        }
+    }
+    appendMessage(c, *msg);
+    arena.Reset();
+}
+
+// Appends one wire frame: 4-byte big-endian size followed by the EngineData payload.
+// The frame is written in one piece so SOCK_SEQPACKET clients receive it as one record.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::appendMessage(Connection& c, const EngineData& msg)
+{
+    TraceScope span("serialize");
+    const size_t payload_size = msg.ByteSizeLong();
+    const size_t start = c.out.size();
+    c.out.resize(start + sizeof(uint32_t) + payload_size);
+    char* frame = c.out.data() + start;
+    uint32_t size = htonl(static_cast<uint32_t>(payload_size));
+    std::memcpy(frame, &size, sizeof(size));
+    msg.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(frame + sizeof(size)));
+    if (c.seqpacket)
+        c.out_frames.push_back(static_cast<uint32_t>(sizeof(uint32_t) + payload_size));
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::appendFrame(Connection& c, const char* frame, size_t size)
+{
+    c.out.append(frame, size);
+    if (c.seqpacket)
+        c.out_frames.push_back(static_cast<uint32_t>(size));
+}
+
+// Encodes each batch of alert events once and queues the frame to every subscriber.
+// Events from one sample share a frame carrying that sample's values.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::pushAlerts()
+{
+    std::deque<AlertEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(data_mutex);
+        events.swap(pending_alerts);
+    }
+    while (!events.empty())
+    {
+        const AlertEvent& first = events.front();
+        EngineData* msg = google::protobuf::Arena::CreateMessage<EngineData>(&arena);
+        setSignals(*msg, first.values);
+        msg->set_sequence(first.sequence);
+        msg->set_timestamp_ms(first.timestamp_ms);
+        const uint64_t sequence = first.sequence;
+        while (!events.empty() && events.front().sequence == sequence)
+        {
+            Alert* alert = msg->add_alerts();
+            alert->set_rule(events.front().rule);
+            alert->set_raised(events.front().raised);
+            events.pop_front();
+        }
+        const size_t payload_size = msg->ByteSizeLong();
+        alert_frame.resize(sizeof(uint32_t) + payload_size);
+        uint32_t size = htonl(static_cast<uint32_t>(payload_size));
+        std::memcpy(alert_frame.data(), &size, sizeof(size));
+        msg->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(alert_frame.data() + sizeof(size)));
+        arena.Reset();
+        for (Connection& c : connections)
+        {
+            if (!c.alerts || c.closing)
+                continue;
+            if (c.pendingBytes() >= kMaxPendingBytes)
+            {
+                spdlog::warn("Alert subscriber is not draining, dropping alert frame");
+                continue;
+            }
+            appendFrame(c, alert_frame.data(), alert_frame.size());
+        }
+    }
+    for (Connection& c : connections)
+    {
+        if (c.alerts && !c.closing && c.pendingBytes() > 0)
+            flush(c);
+    }
+}
+
+// Sends queued bytes until the socket would block. Stream sockets take everything
+// queued in one call and may accept it in pieces; SOCK_SEQPACKET sends are
+// all-or-nothing, so each frame is sent as its own record.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::flush(Connection& c)
+{
+    while (c.out_offset < c.out.size())
+    {
+        const size_t len = c.seqpacket ? c.out_frames[c.out_frame_head] : c.out.size() - c.out_offset;
+        ssize_t sent;
+        {
+            TraceScope span("send");
+            sent = transport_.send(c.fd, c.out.data() + c.out_offset, len, MSG_NOSIGNAL);
+        }
+        if (sent < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                spdlog::error("send failed: {}", std::strerror(errno));
+                c.closing = true;
+            }
+            break;
+        }
+        c.out_offset += static_cast<size_t>(sent);
+        c.counters.bytes_sent += static_cast<uint64_t>(sent);
+        if (c.seqpacket)
+            ++c.out_frame_head;
+        if (static_cast<size_t>(sent) < len)
+            break;
+    }
+    if (c.out_offset == c.out.size() && c.close_when_flushed)
+        c.closing = true;
+    if (c.out_offset == c.out.size())
+    {
+        // Everything sent: rewind without giving up the buffers' capacity.
+        c.out.clear();
+        c.out_offset = 0;
+        c.out_frames.clear();
+        c.out_frame_head = 0;
+    }
+    else if (c.out_offset >= kMaxPendingBytes)
+    {
+        c.out.erase(0, c.out_offset);
+        c.out_offset = 0;
+        c.out_frames.erase(c.out_frames.begin(), c.out_frames.begin() + c.out_frame_head);
+        c.out_frame_head = 0;
+    }
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::closeConnection(Connection& c)
+{
+    spdlog::info("Client disconnected.");
+    transport_.close(c.fd);
+    c.fd = -1;
+}
+
+// Returns the connection object and its buffers to their pools.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::releaseConnection(Connection& c)
+{
+    connection_pool.destroy(&c);
+}
+
+// Maps the connection and buffer pools, sized for max_connections unless
+// config.memory says otherwise. No connection exists while this runs.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::initPools()
+{
+    const MemoryConfig& memory = config.memory;
+    size_t objects = memory.connections;
+    if (objects == 0)
+        objects = config.limits.max_connections > 0 ? config.limits.max_connections : 1024;
+    const size_t buffers = memory.buffers > 0 ? memory.buffers : 2 * objects;
+    const bool ok = connection_pool.init("connections", objects, memory.hugepages) &&
+                    buffer_pool.init("buffers", memory.buffer_bytes, buffers, memory.hugepages) &&
+                    large_buffer_pool.init("large buffers", memory.large_buffer_bytes, memory.large_buffers, memory.hugepages);
+    if (!ok)
+        spdlog::error("Connection memory pools unavailable, using the heap");
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    memory_stats = {connection_pool.stats(), buffer_pool.stats(), large_buffer_pool.stats()};
+}
+
+// Acquire stage: samples the due signals, makes them the latest snapshot for the
+// request path and hands them to the transform stage. Nothing slower than the
+// sampling itself runs here, so the later stages cannot delay the next tick.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::updateDataLoop()
+{
+    Trace::setThreadName("data");
+    SampleScheduler scheduler(sampling_periods, SampleScheduler::Clock::now());
+    EngineSample values = getLatestSample();
+
+    while (running)
+    {
+        StagedSample item;
+        item.acquired_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        EngineSnapshot& snapshot = item.snapshot;
+        snapshot.fresh = scheduler.due(SampleScheduler::Clock::now());
+        EngineSample sampled;
+        {
+            TraceScope span("sample");
+            sampled = sampleSignals(snapshot.fresh);
+        }
+        snapshot.timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        {
+            auto lock = lockTraced(data_mutex, "wait data_mutex");
+            for (size_t i = 0; i < kSignalCount; ++i)
+            {
+                if (snapshot.fresh & (1u << i))
+                {
+                    signalValue(values, i) = signalValue(sampled, i);
+                    latest_field_timestamp_ms[i] = snapshot.timestamp_ms;
+                }
+            }
+            snapshot.values = values;
+            snapshot.field_timestamp_ms = latest_field_timestamp_ms;
+            snapshot.sequence = ++latest_sequence;
+            latest = snapshot.values;
+            latest_timestamp_ms = snapshot.timestamp_ms;
+        }
+        // Parked long polls and WebSocket streams are served by server_thread. The
+        // fence pairs with parkRequest() and the WebSocket upgrade: either they see
+        // this sample or this sees their client.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool listening = waiting_clients.load(std::memory_order_relaxed) > 0 ||
+                               stream_clients.load(std::memory_order_relaxed) > 0;
+        if (listening && wake_fd >= 0)
+            transport_.wake(wake_fd);
+        finishStage(kAcquire, item);
+        transform_queue->push(item);
+        std::this_thread::sleep_until(scheduler.nextDeadline());
+    }
+    transform_queue->close();
+}
+
+// Transform stage: rolling statistics and alert rules.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::transformLoop()
+{
+    Trace::setThreadName("transform");
+    StagedSample item;
+    while (transform_queue->pop(item))
+    {
+        const EngineSnapshot& snapshot = item.snapshot;
+        if (!stats.empty())
+        {
+            // Incremental update and summary happen once here, not per request.
+            TraceScope span("stats");
+            stats.add(snapshot.timestamp_ms, snapshot.values);
+            std::vector<WindowSummary> summary = stats.summary();
+            std::lock_guard<std::mutex> lock(data_mutex);
+            latest_stats = std::move(summary);
+        }
+        if (rule_engine.size() > 0)
+        {
+            TraceScope span("rules");
+            alert_events.clear();
+            rule_engine.evaluate(snapshot, alert_events);
+            if (!alert_events.empty())
+            {
+                raiseAlerts(alert_events);
+                item.alerts = true;
+            }
+        }
+        finishStage(kTransform, item);
+        publish_queue->push(item);
+    }
+    publish_queue->close();
+}
+
+// Publish stage: shared memory and multicast.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::publishLoop()
+{
+    Trace::setThreadName("publish");
+    StagedSample item;
+    while (publish_queue->pop(item))
+    {
+        {
+            TraceScope span("publish");
+            publish(item.snapshot);
+        }
+        finishStage(kPublish, item);
+        persist_queue->push(item);
+    }
+    persist_queue->close();
+}
+
+// Persist stage: the database. A slow insert only backs up this stage's queue.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::persistLoop()
+{
+    Trace::setThreadName("persist");
+    StagedSample item;
+    while (persist_queue->pop(item))
+    {
+        {
+            TraceScope span("store");
+            store(item.snapshot);
+            if (item.alerts)
+                storeAlerts();
+        }
+        finishStage(kPersist, item);
+    }
+    // Alerts whose sample a queue dropped; otherwise they go with the next alerts.
+    storeAlerts();
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::finishStage(Stage stage, const StagedSample& item)
+{
+    const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    const uint64_t latency_ns = static_cast<uint64_t>(std::max<int64_t>(0, now_ns - item.acquired_ns));
+    // Each stage's counters are written by its own thread only.
+    StageCounters& counters = stage_counters[stage];
+    counters.processed.fetch_add(1, std::memory_order_relaxed);
+    counters.latency_total_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    if (latency_ns > counters.latency_max_ns.load(std::memory_order_relaxed))
+        counters.latency_max_ns.store(latency_ns, std::memory_order_relaxed);
+}
+
+// Reads the due signals. Engines without a selective sample(signals) are sampled
+// whole and the extra values dropped.
+template <EngineSource EngineT, SocketTransport TransportT>
+EngineSample BasicServer<EngineT, TransportT>::sampleSignals(uint8_t signals)
+{
+    if constexpr (requires { { engine_.sample(signals) } -> std::same_as<EngineSample>; })
+    {
+        if (signals != kAllSignals)
+            return engine_.sample(signals);
+    }
+    return engine_.sample();
+}
+
+// Persists the snapshot with its acquisition time and only its fresh signals when the
+// engine can store whole snapshots. Runs on persist_thread, possibly well after the
+// sample was taken; engines without storeSample() stamp the row when it is written.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::store(const EngineSnapshot& snapshot)
+{
+    if constexpr (requires { engine_.storeSample(snapshot); })
+        engine_.storeSample(snapshot);
+    else
+        applySignals([&](auto... values) { engine_.storeCurrentValues(values...); }, snapshot.values);
+}
+
+// Pushes a new snapshot to the optional local transports. Runs on the data thread.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::publish(const EngineSnapshot& snapshot)
+{
+    publishShm(snapshot);
+    multicast_publisher.publish(snapshot);
+}
+
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::publishShm(const EngineSnapshot& snapshot)
+{
+    if (shm_publisher.isOpen())
+    {
+        shm::Record record;
+        record.sequence = snapshot.sequence;
+        record.timestamp_ms = snapshot.timestamp_ms;
+        record.rpm = snapshot.values.rpm;
+        record.temperature = snapshot.values.temperature;
+        record.oil_pressure = snapshot.values.oil_pressure;
+        record.speed = snapshot.values.speed;
+        shm_publisher.publish(record);
+    }
+}
+
+// Replays the tail of stored history through the same state the data thread keeps,
+// before that thread starts, so clients see the last known values and full rolling
+// windows right after a restart. Multicast is skipped: those samples went out before.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::warmStart()
+{
+    if constexpr (std::constructible_from<EngineT, const StorageConfig&>)
+    {
+        if (!config.warm_start.enabled)
+            return;
+        int64_t lookback_ms = config.warm_start.lookback_ms;
+        for (int64_t window_ms : config.stats.windows_ms)
+            lookback_ms = std::max(lookback_ms, window_ms);
+        const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        std::vector<EngineSnapshot> samples;
+        WarmStartStats result;
+        WarmStartOptions options;
+        options.budget_ms = config.warm_start.budget_ms;
+        if (!loadRecentSamples(config.storage, now_ms - lookback_ms, samples, result, options))
+            spdlog::warn("Warm start could not read all of {}", config.storage.path);
+        for (const EngineSnapshot& snapshot : samples)
+        {
+            if (!stats.empty())
+                stats.add(snapshot.timestamp_ms, snapshot.values);
+            publishShm(snapshot);
+        }
+        if (!samples.empty())
+        {
+            std::vector<WindowSummary> summary = stats.summary();
+            std::lock_guard<std::mutex> lock(data_mutex);
+            latest = samples.back().values;
+            latest_sequence = samples.back().sequence;
+            latest_timestamp_ms = samples.back().timestamp_ms;
+            latest_field_timestamp_ms = samples.back().field_timestamp_ms;
+            latest_stats = std::move(summary);
+        }
+        spdlog::info("Warm start: {} samples restored in {:.1f} ms{}", result.rows, result.seconds * 1000.0,
+                     result.truncated ? " (truncated by the time budget or row cap)" : "");
+    }
+}
+
+// Hands alert events to server_thread for delivery and, when the engine can store
+// them, to persist_thread. Runs on the transform thread.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::raiseAlerts(const std::vector<AlertEvent>& events)
+{
+    for (const AlertEvent& event : events)
+        spdlog::info("Alert '{}' {}", event.rule, event.raised ? "raised" : "cleared");
+    {
+        std::lock_guard<std::mutex> lock(data_mutex);
+        pending_alerts.insert(pending_alerts.end(), events.begin(), events.end());
+        while (pending_alerts.size() > kMaxPendingAlerts)
+            pending_alerts.pop_front();
+        if constexpr (requires { engine_.storeAlertEvent(std::string(), bool(), int64_t(), EngineSample()); })
+        {
+            unstored_alerts.insert(unstored_alerts.end(), events.begin(), events.end());
+            while (unstored_alerts.size() > kMaxPendingAlerts)
+                unstored_alerts.pop_front();
+        }
+    }
+    if (wake_fd >= 0)
+        transport_.wake(wake_fd);
+}
+
+// Stores the alert events raised so far. Runs on the persist thread, which owns
+// the engine's database writes.
+template <EngineSource EngineT, SocketTransport TransportT>
+void BasicServer<EngineT, TransportT>::storeAlerts()
+{
+    if constexpr (requires { engine_.storeAlertEvent(std::string(), bool(), int64_t(), EngineSample()); })
+    {
+        std::deque<AlertEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(data_mutex);
+            events.swap(unstored_alerts);
+        }
+        for (const AlertEvent& event : events)
+            engine_.storeAlertEvent(event.rule, event.raised, event.timestamp_ms, event.values);
+    }
+}
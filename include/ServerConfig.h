@@ -0,0 +1,184 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "SharedSnapshot.h"
+#include "Signals.h"
+#include "SpscQueue.hpp"
+#include "StorageConfig.h"
+
+// TCP listener and client socket options. Accepted sockets inherit the listener's
+// options on Linux, so they are set once on the listener; only TCP_QUICKACK, which
+// the kernel clears by itself, is re-armed per client. Zero sizes and times (and
+// incoming_cpu -1) keep the kernel defaults. Options the kernel rejects are logged
+// and skipped.
+struct SocketConfig {
+    uint16_t port = 5555;
+    // Accept queue length for the TCP and Unix listeners, capped by net.core.somaxconn.
+    int backlog = 1024;
+    int send_buffer_bytes = 0;
+    // Set before listen() so the advertised window scale covers it.
+    int receive_buffer_bytes = 0;
+    bool tcp_nodelay = true;
+    bool tcp_quickack = false;
+    // SO_BUSY_POLL: microseconds a read may spin on the device queue (raising it
+    // needs CAP_NET_ADMIN; poll() itself spins only with net.core.busy_poll).
+    int busy_poll_us = 0;
+    bool keepalive = false;
+    int keepalive_idle_s = 60;
+    int keepalive_interval_s = 10;
+    int keepalive_count = 5;
+    // TCP_USER_TIMEOUT: a client whose data stays unacknowledged this long is dropped.
+    int user_timeout_ms = 0;
+    // SO_INCOMING_CPU: with several SO_REUSEPORT listeners, connections whose packets
+    // are processed on this CPU go to this listener.
+    int incoming_cpu = -1;
+};
+
+// Shared-memory snapshot transport for consumers on the same host.
+struct SharedMemoryConfig {
+    bool enabled = false;
+    std::string name = shm::kDefaultName;
+    // Number of recent samples kept in the ring; 0 publishes only the latest one.
+    uint32_t ring_capacity = 0;
+};
+
+// Additional AF_UNIX listener for local clients. Frames are identical to TCP; with
+// seqpacket each response frame arrives as exactly one record.
+struct UnixSocketConfig {
+    bool enabled = false;
+    std::string path = "/tmp/middlewaresw.sock";
+    bool seqpacket = false;
+};
+
+// HTTP/1.1 and WebSocket gateway for browsers, served from the same poll loop as
+// the socket protocol: GET /latest returns the latest snapshot as JSON and
+// /stream upgrades to a WebSocket that receives one JSON text message per sample.
+// Gateway clients count toward limits.max_connections.
+struct HttpConfig {
+    bool enabled = false;
+    uint16_t port = 8080;
+};
+
+// UDP multicast fan-out of every sample. Loopback delivery is on so receivers on
+// the publishing host (and tests) see the datagrams too.
+struct MulticastConfig {
+    bool enabled = false;
+    std::string group = "239.255.0.1";
+    uint16_t port = 5556;
+    // Outgoing interface address; empty lets the routing table decide.
+    std::string interface_address;
+    int ttl = 1;
+    bool loopback = true;
+};
+
+// Rolling-window statistics maintained by the server; an empty list disables them.
+struct StatsConfig {
+    std::vector<int64_t> windows_ms = {1000, 10000, 60000};
+};
+
+// Memory for client connections, preallocated in slab pools (see SlabPool).
+// Connections beyond the pools still work; their memory comes from the heap.
+struct MemoryConfig {
+    // Connection objects; 0 sizes the pool by limits.max_connections.
+    size_t connections = 0;
+    // Each connection's output buffer and, once it sends structured or HTTP
+    // requests, its input buffer hold one block.
+    size_t buffer_bytes = 4096;
+    // 0: two per pooled connection.
+    size_t buffers = 0;
+    // Blocks for output backlogs that outgrow buffer_bytes (exports, slow readers).
+    size_t large_buffer_bytes = 128 * 1024;
+    size_t large_buffers = 64;
+    // Back the pools with huge pages: reserved ones (vm.nr_hugepages) if available,
+    // otherwise transparent huge pages.
+    bool hugepages = false;
+};
+
+// Stored history served to export requests.
+struct HistoryConfig {
+    // Database written by EngineImpl, or the partition directory when storage is
+    // partitioned; exports open their own read-only connections.
+    std::string db_path = "engine_data.db";
+    // Rows read per chunk, i.e. per export frame.
+    size_t export_chunk_rows = 1024;
+    // Exports run on this many bulk worker threads, off the poll loop.
+    size_t workers = 2;
+    // Exports admitted at once across all clients; further ones fail right away.
+    size_t max_jobs = 64;
+    // Nice value of the bulk workers, so live requests get the CPU first.
+    int worker_nice = 10;
+};
+
+// Admission control and per-client request rate limits.
+struct LimitsConfig {
+    // Clients beyond this many are accepted and closed right away; 0 means no cap.
+    size_t max_connections = 1024;
+    // Token bucket per client: sustained requests per second (0 disables the
+    // limit) and the burst allowed on top of it.
+    double requests_per_second = 0.0;
+    double burst = 20.0;
+    // Longest a long-poll request (Request.after_sequence) is parked.
+    uint32_t max_wait_ms = 30000;
+};
+
+// Alert rules compiled at startup, one per entry (syntax in RuleEngine.h). Invalid
+// rules are logged and skipped.
+struct RulesConfig {
+    std::vector<std::string> rules;
+};
+
+// Per-signal sampling rates, indexed by signal (see Signals.h). A rate of 0 samples
+// the signal every update interval. Each tick reads only the signals that are due.
+struct SamplingConfig {
+    std::array<double, kSignalCount> rate_hz{};
+};
+
+// Rebuilding the latest snapshot, the rolling windows and the shared-memory ring
+// from stored history at start(). Only engines built from a StorageConfig have
+// history to read.
+struct WarmStartConfig {
+    bool enabled = true;
+    // How far back to read; at least the longest rolling-statistics window is read.
+    int64_t lookback_ms = 0;
+    // Upper bound on the time spent reading, however large the database.
+    int64_t budget_ms = 250;
+};
+
+// Queue in front of one pipeline stage.
+struct StageQueueConfig {
+    size_t capacity = 4096;
+    OverflowPolicy overflow = OverflowPolicy::DropOldest;
+};
+
+// Samples flow acquire -> transform (rolling statistics, alert rules) -> publish
+// (shared memory, multicast) -> persist (database), each stage on its own thread.
+// Acquisition never waits for a queue unless the transform queue blocks. A Block
+// queue stalls the stage before it when full; drop policies count what they drop.
+struct PipelineConfig {
+    // Blocking keeps every sample in front of the alert rules, whose "for <duration>"
+    // holds would otherwise miss transitions dropped under overload.
+    StageQueueConfig transform{4096, OverflowPolicy::Block};
+    StageQueueConfig publish;
+    // Dropping the newest keeps stored history gap-free up to the first drop.
+    StageQueueConfig persist{4096, OverflowPolicy::DropNewest};
+};
+
+// Optional server features. Defaults reproduce the plain TCP server.
+struct ServerConfig {
+    SocketConfig socket;
+    SharedMemoryConfig shm;
+    UnixSocketConfig unix_socket;
+    HttpConfig http;
+    MulticastConfig multicast;
+    StatsConfig stats;
+    RulesConfig alerts;
+    LimitsConfig limits;
+    MemoryConfig memory;
+    HistoryConfig history;
+    StorageConfig storage;
+    WarmStartConfig warm_start;
+    SamplingConfig sampling;
+    PipelineConfig pipeline;
+};
@@ -0,0 +1,182 @@
+#pragma once
+// Header-only reader for the shared-memory snapshot published by middlewaresw.
+//
+// The segment holds the latest engine snapshot and an optional ring of recent
+// samples. Every slot is guarded by a seqlock: the writer bumps the slot's sequence
+// to an odd value, writes the payload, then bumps it to the next even value. Readers
+// copy the payload and retry if the sequence was odd or changed meanwhile, so after
+// open() a read costs a handful of loads and no syscalls.
+//
+// This header only depends on the C++ standard library and POSIX so consumers can
+// copy it into their own projects.
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace shm {
+
+constexpr uint32_t kMagic = 0x4D575348; // "MWSH"
+constexpr uint32_t kVersion = 1;
+constexpr const char* kDefaultName = "/middlewaresw";
+
+// Plain copy of one engine snapshot as seen by readers.
+struct Record {
+    uint64_t sequence = 0;
+    int64_t timestamp_ms = 0;
+    int32_t rpm = 0;
+    int32_t temperature = 0;
+    int32_t oil_pressure = 0;
+    int32_t speed = 0;
+};
+static_assert(sizeof(Record) == 32, "Record layout is part of the shared-memory ABI");
+
+constexpr size_t kRecordWords = sizeof(Record) / sizeof(uint64_t);
+
+// One seqlock-protected slot. The payload is stored as relaxed atomic words so the
+// concurrent copy is well defined; `index` lets ring readers detect overwrites.
+struct alignas(64) Slot {
+    std::atomic<uint64_t> seq;
+    std::atomic<uint64_t> index;
+    std::atomic<uint64_t> words[kRecordWords];
+};
+
+struct alignas(64) Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t ring_capacity;
+    uint32_t reserved;
+    // Number of records ever written to the ring.
+    std::atomic<uint64_t> ring_written;
+    Slot latest;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "seqlock needs lock-free 64-bit atomics");
+
+inline size_t segmentSize(uint32_t ring_capacity) {
+    return sizeof(Header) + sizeof(Slot) * ring_capacity;
+}
+
+inline Slot* ringSlots(Header* header) {
+    return reinterpret_cast<Slot*>(header + 1);
+}
+
+inline const Slot* ringSlots(const Header* header) {
+    return reinterpret_cast<const Slot*>(header + 1);
+}
+
+// Writer side of the seqlock. Only one writer per slot is supported.
+inline void writeSlot(Slot& slot, uint64_t index, const Record& record) {
+    uint64_t words[kRecordWords];
+    std::memcpy(words, &record, sizeof(record));
+    const uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.index.store(index, std::memory_order_relaxed);
+    for (size_t i = 0; i < kRecordWords; ++i)
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    slot.seq.store(seq + 2, std::memory_order_release);
+}
+
+// Reader side of the seqlock. Returns false if the slot was never written.
+inline bool readSlot(const Slot& slot, uint64_t& index, Record& record) {
+    uint64_t words[kRecordWords];
+    uint64_t before, after;
+    do {
+        before = slot.seq.load(std::memory_order_acquire);
+        if (before & 1)
+            continue;
+        index = slot.index.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < kRecordWords; ++i)
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = slot.seq.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+    if (before == 0)
+        return false;
+    std::memcpy(&record, words, sizeof(record));
+    return true;
+}
+
+// Maps a published segment read-only.
+class Reader {
+public:
+    Reader() = default;
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+    ~Reader() { close(); }
+
+    bool open(const char* name = kDefaultName) {
+        close();
+        int fd = ::shm_open(name, O_RDONLY, 0);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+            ::close(fd);
+            return false;
+        }
+        void* addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED)
+            return false;
+        const Header* header = static_cast<const Header*>(addr);
+        if (header->magic != kMagic || header->version != kVersion ||
+            static_cast<size_t>(st.st_size) < segmentSize(header->ring_capacity)) {
+            ::munmap(addr, st.st_size);
+            return false;
+        }
+        header_ = header;
+        mapped_size_ = st.st_size;
+        return true;
+    }
+
+    void close() {
+        if (header_) {
+            ::munmap(const_cast<Header*>(header_), mapped_size_);
+            header_ = nullptr;
+            mapped_size_ = 0;
+        }
+    }
+
+    bool isOpen() const { return header_ != nullptr; }
+
+    uint32_t ringCapacity() const { return header_ ? header_->ring_capacity : 0; }
+
+    // Copies the newest snapshot. Returns false before the first publish.
+    bool readLatest(Record& out) const {
+        if (!header_)
+            return false;
+        uint64_t index;
+        return readSlot(header_->latest, index, out);
+    }
+
+    // Copies up to `max` of the most recent ring entries, oldest first. Entries
+    // overwritten by the writer while reading are skipped.
+    size_t readRecent(Record* out, size_t max) const {
+        if (!header_ || header_->ring_capacity == 0)
+            return 0;
+        const uint64_t written = header_->ring_written.load(std::memory_order_acquire);
+        uint64_t count = written < header_->ring_capacity ? written : header_->ring_capacity;
+        if (count > max)
+            count = max;
+        const Slot* slots = ringSlots(header_);
+        size_t copied = 0;
+        for (uint64_t i = written - count; i < written; ++i) {
+            uint64_t index;
+            if (readSlot(slots[i % header_->ring_capacity], index, out[copied]) && index == i)
+                ++copied;
+        }
+        return copied;
+    }
+
+private:
+    const Header* header_ = nullptr;
+    size_t mapped_size_ = 0;
+};
+
+} // namespace shm
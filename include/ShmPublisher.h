@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "SharedSnapshot.h"
+
+// Writes engine snapshots into a POSIX shared-memory segment for co-located readers
+// (see shm::Reader in SharedSnapshot.h). Single writer; readers never block it.
+class ShmPublisher {
+public:
+    ShmPublisher() = default;
+    ShmPublisher(const ShmPublisher&) = delete;
+    ShmPublisher& operator=(const ShmPublisher&) = delete;
+    ~ShmPublisher();
+
+    // Creates (or recreates) the segment `name` with room for `ring_capacity`
+    // recent samples. A capacity of 0 publishes only the latest snapshot.
+    bool open(const std::string& name, uint32_t ring_capacity);
+    // Unmaps and unlinks the segment.
+    void close();
+    bool isOpen() const { return header != nullptr; }
+    void publish(const shm::Record& record);
+
+private:
+    shm::Header* header = nullptr;
+    size_t mapped_size = 0;
+    std::string segment_name;
+};
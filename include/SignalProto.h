@@ -0,0 +1,39 @@
+#pragma once
+#include "Signals.h"
+#include "engine_data.pb.h"
+
+// EngineData and WindowStats accessors of each signal, generated from
+// ENGINE_SIGNALS in the same order as kSignalFields.
+struct SignalProtoField {
+    void (EngineData::*set)(int32_t);
+    void (EngineData::*clear)();
+    int32_t (EngineData::*get)() const;
+    SignalStats* (WindowStats::*mutable_stats)();
+};
+
+inline constexpr SignalProtoField kSignalProtoFields[] = {
+#define ENGINE_SIGNAL_PROTO(name, min, max) \
+    {&EngineData::set_##name, &EngineData::clear_##name, &EngineData::name, &WindowStats::mutable_##name},
+    ENGINE_SIGNALS(ENGINE_SIGNAL_PROTO)
+#undef ENGINE_SIGNAL_PROTO
+};
+static_assert(std::size(kSignalProtoFields) == kSignalCount);
+
+// Sets the signals in `mask` on `msg` and clears the others.
+inline void setSignals(EngineData& msg, const EngineSample& s, uint8_t mask = kAllSignals) {
+    forEachSignal([&](auto i) {
+        constexpr SignalProtoField field = kSignalProtoFields[i];
+        if (mask & (1u << i))
+            (msg.*field.set)(s.*kSignalFields[i].member);
+        else
+            (msg.*field.clear)();
+    });
+}
+
+// The signal values of `msg`; absent ones read as 0.
+inline EngineSample signalsOf(const EngineData& msg) {
+    EngineSample s;
+    forEachSignal([&](auto i) { s.*kSignalFields[i].member = (msg.*kSignalProtoFields[i].get)(); });
+    return s;
+}
+
@@ -0,0 +1,109 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// The engine signals, declared once. Each X(name, min, max) entry becomes an
+// EngineSample field, an engine_values and alert_events column, an EngineData and
+// WindowStats field mapping (SignalProto.h), a JSON key and the name rules and
+// command-line options use. min and max are the simulated range (Receiver) and
+// the range the statistics histograms cover.
+//
+// Entry order is the signal index: sampling masks, field_timestamp_ms, statistics
+// and export columns all follow it. A new signal is one line here plus a field of
+// the same name in EngineData and WindowStats (engine_data.proto). Existing
+// databases gain its column on the next start.
+#define ENGINE_SIGNALS(X)    \
+    X(rpm, 0, 8000)          \
+    X(temperature, -50, 500) \
+    X(oil_pressure, 0, 200)  \
+    X(speed, 0, 500)
+
+// One reading of every engine signal, taken together in a single call.
+struct EngineSample {
+#define ENGINE_SIGNAL_MEMBER(name, min, max) int name = 0;
+    ENGINE_SIGNALS(ENGINE_SIGNAL_MEMBER)
+#undef ENGINE_SIGNAL_MEMBER
+};
+
+struct SignalField {
+    // Field, column, JSON key and rule name.
+    const char* name;
+    // `,"name":`, the key as appendSnapshotJson writes it after the previous value.
+    std::string_view json_key;
+    int EngineSample::*member;
+    int min;
+    int max;
+};
+
+inline constexpr SignalField kSignalFields[] = {
+#define ENGINE_SIGNAL_FIELD(name, min, max) {#name, ",\"" #name "\":", &EngineSample::name, min, max},
+    ENGINE_SIGNALS(ENGINE_SIGNAL_FIELD)
+#undef ENGINE_SIGNAL_FIELD
+};
+
+// Sampling masks use bit (1 << index).
+constexpr size_t kSignalCount = std::size(kSignalFields);
+static_assert(kSignalCount <= 8, "sampling masks are uint8_t");
+constexpr uint8_t kAllSignals = static_cast<uint8_t>((1u << kSignalCount) - 1);
+
+// Signal indexes by name, e.g. signals::speed.
+namespace signals {
+enum Index : size_t {
+#define ENGINE_SIGNAL_INDEX(name, min, max) name,
+    ENGINE_SIGNALS(ENGINE_SIGNAL_INDEX)
+#undef ENGINE_SIGNAL_INDEX
+};
+} // namespace signals
+
+// Calls f(std::integral_constant<size_t, I>{}) for every signal in index order. The
+// calls are unrolled, so kSignalFields[i] is a constant inside f and member access
+// through it compiles to a fixed offset.
+template <typename F>
+constexpr void forEachSignal(F&& f) {
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        (f(std::integral_constant<size_t, I>{}), ...);
+    }(std::make_index_sequence<kSignalCount>{});
+}
+
+// Calls f with every value of `s` as separate arguments, in signal order.
+template <typename F>
+constexpr decltype(auto) applySignals(F&& f, const EngineSample& s) {
+    return [&]<size_t... I>(std::index_sequence<I...>) -> decltype(auto) {
+        return f(s.*kSignalFields[I].member...);
+    }(std::make_index_sequence<kSignalCount>{});
+}
+
+inline int& signalValue(EngineSample& s, size_t signal) {
+    return s.*kSignalFields[signal].member;
+}
+
+inline int signalValue(const EngineSample& s, size_t signal) {
+    return s.*kSignalFields[signal].member;
+}
+
+// Index of the signal called `name`, or -1.
+constexpr int signalIndex(std::string_view name) {
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        if (name == kSignalFields[i].name)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+// The signal names in index order, joined by `separator`, each preceded by `prefix`:
+// the column list of the storage statements.
+inline std::string signalNames(std::string_view separator = ", ", std::string_view prefix = {}) {
+    std::string out;
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        if (i > 0)
+            out += separator;
+        out += prefix;
+        out += kSignalFields[i].name;
+    }
+    return out;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+inline constexpr size_t kCacheLineBytes = 64;
+
+// Usage of one slab pool.
+struct SlabStats {
+    const char* name = "";
+    size_t block_bytes = 0;
+    size_t capacity = 0;
+    size_t in_use = 0;
+    size_t high_water = 0;
+    // Blocks handed out, and requests the pool could not serve (all blocks in use,
+    // or larger than any block) that went to the heap instead.
+    uint64_t allocations = 0;
+    uint64_t fallbacks = 0;
+    // Backed by reserved huge pages (MAP_HUGETLB).
+    bool hugepages = false;
+};
+
+// Fixed-size blocks carved from one mapping made up front, so steady connection
+// churn reuses the same memory instead of going through malloc and free.
+//
+// Blocks are whole cache lines and start on a cache line, so no two blocks share
+// one. Freed blocks are kept on an intrusive free list and reused most recently
+// freed first, while their memory is still warm. Blocks never used are not touched,
+// so the kernel only backs what the high-water mark reached. Not thread-safe: a pool
+// belongs to one thread.
+class SlabPool {
+public:
+    SlabPool() = default;
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+    ~SlabPool();
+
+    // Maps `capacity` blocks of at least `block_bytes`. With `hugepages` the mapping
+    // uses reserved huge pages when the system has them and otherwise asks for
+    // transparent huge pages. Returns false, leaving the pool empty, if mapping fails.
+    bool init(const char* name, size_t block_bytes, size_t capacity, bool hugepages);
+    void release();
+
+    // A block, or nullptr when all are in use.
+    void* allocate();
+    void deallocate(void* block);
+    bool owns(const void* p) const {
+        return p >= static_cast<const void*>(base) && p < static_cast<const void*>(base + capacity * block_bytes);
+    }
+    size_t blockBytes() const { return block_bytes; }
+    void countFallback() { ++stats_.fallbacks; }
+    const SlabStats& stats() const { return stats_; }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    char* base = nullptr;
+    size_t mapped_bytes = 0;
+    size_t block_bytes = 0;
+    size_t capacity = 0;
+    // Blocks below this index have been handed out at least once.
+    size_t next_unused = 0;
+    FreeBlock* free_list = nullptr;
+    SlabStats stats_;
+};
+
+// Container memory from slab pools, given smallest blocks first: each request is
+// served by the first pool whose blocks are large enough and which has one free.
+// Other requests go to `upstream`.
+class SlabResource : public std::pmr::memory_resource {
+public:
+    SlabResource(std::initializer_list<SlabPool*> pools,
+                 std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : pools(pools), upstream(upstream) {}
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::vector<SlabPool*> pools;
+    std::pmr::memory_resource* upstream;
+};
+
+// Objects of one type in a SlabPool, each in its own cache-line-aligned block.
+// When the pool is exhausted objects are allocated with new instead.
+template <typename T>
+class SlabObjectPool {
+    static_assert(alignof(T) <= kCacheLineBytes);
+
+public:
+    bool init(const char* name, size_t capacity, bool hugepages) {
+        return pool.init(name, sizeof(T), capacity, hugepages);
+    }
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (void* block = pool.allocate())
+            return new (block) T(std::forward<Args>(args)...);
+        pool.countFallback();
+        return new T(std::forward<Args>(args)...);
+    }
+    void destroy(T* object) {
+        if (pool.owns(object)) {
+            object->~T();
+            pool.deallocate(object);
+        } else {
+            delete object;
+        }
+    }
+    const SlabStats& stats() const { return pool.stats(); }
+
+private:
+    SlabPool pool;
+};
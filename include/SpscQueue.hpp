@@ -0,0 +1,156 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+// What push() does when the queue is full.
+enum class OverflowPolicy {
+    // Wait for the consumer to make room.
+    Block,
+    // Drop the item being pushed.
+    DropNewest,
+    // Drop the oldest queued item to make room.
+    DropOldest,
+};
+
+// Bounded lock-free queue between one producer thread and one consumer thread.
+//
+// head (next write) is advanced by the producer and tail (next read) by the
+// consumer. With DropOldest the producer also advances tail. That is why the
+// consumer claims an item with a compare-exchange on tail and discards its copy if
+// the producer dropped the item meanwhile. Slots are stored as relaxed atomic
+// words, like the SharedSnapshot seqlock payload, so that copy is well defined
+// even while the producer overwrites the slot; T must be trivially copyable. An
+// empty consumer and a blocked producer sleep on atomic wait/notify
+// instead of spinning.
+template <typename T>
+class SpscQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "items are copied while the producer may overwrite them");
+
+public:
+    // The capacity is rounded up to a power of two.
+    SpscQueue(size_t capacity, OverflowPolicy policy)
+        : slots(std::make_unique<Slot[]>(std::bit_ceil(capacity < 1 ? size_t{1} : capacity))),
+          mask(std::bit_ceil(capacity < 1 ? size_t{1} : capacity) - 1), policy(policy) {}
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer only. Returns false if the item was dropped (DropNewest) or the queue
+    // is closed.
+    bool push(const T& item) {
+        const uint64_t h = head.load(std::memory_order_relaxed);
+        while (h - tail.load(std::memory_order_acquire) > mask) {
+            if (closed.load(std::memory_order_acquire))
+                return false;
+            if (policy == OverflowPolicy::DropNewest) {
+                drops.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (policy == OverflowPolicy::DropOldest) {
+                uint64_t t = tail.load(std::memory_order_acquire);
+                if (h - t > mask && tail.compare_exchange_strong(t, t + 1, std::memory_order_acq_rel))
+                    drops.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            const uint32_t seen = space_signal.load(std::memory_order_acquire);
+            if (h - tail.load(std::memory_order_acquire) > mask)
+                space_signal.wait(seen, std::memory_order_acquire);
+        }
+        store(slots[h & mask], item);
+        head.store(h + 1, std::memory_order_release);
+        const size_t depth = static_cast<size_t>(h + 1 - tail.load(std::memory_order_relaxed));
+        if (depth > high_water.load(std::memory_order_relaxed))
+            high_water.store(depth, std::memory_order_relaxed);
+        item_signal.fetch_add(1, std::memory_order_release);
+        item_signal.notify_one();
+        return true;
+    }
+
+    // Consumer only. Waits for an item; returns false once the queue is closed and empty.
+    bool pop(T& item) {
+        for (;;) {
+            const uint32_t seen = item_signal.load(std::memory_order_acquire);
+            if (tryPop(item))
+                return true;
+            if (closed.load(std::memory_order_acquire))
+                return tryPop(item);
+            item_signal.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+    // Consumer only. Returns false if the queue is empty.
+    bool tryPop(T& item) {
+        uint64_t t = tail.load(std::memory_order_acquire);
+        while (t != head.load(std::memory_order_acquire)) {
+            const T copy = load(slots[t & mask]);
+            if (tail.compare_exchange_strong(t, t + 1, std::memory_order_acq_rel)) {
+                item = copy;
+                if (policy == OverflowPolicy::Block) {
+                    space_signal.fetch_add(1, std::memory_order_release);
+                    space_signal.notify_one();
+                }
+                return true;
+            }
+            // The producer dropped this item; t now holds the new tail.
+        }
+        return false;
+    }
+
+    // Wakes both sides: pop() drains what is queued and then returns false, push()
+    // returns false instead of blocking.
+    void close() {
+        closed.store(true, std::memory_order_release);
+        item_signal.fetch_add(1, std::memory_order_release);
+        item_signal.notify_all();
+        space_signal.fetch_add(1, std::memory_order_release);
+        space_signal.notify_all();
+    }
+
+    size_t capacity() const { return mask + 1; }
+    size_t size() const {
+        const uint64_t t = tail.load(std::memory_order_acquire);
+        return static_cast<size_t>(head.load(std::memory_order_acquire) - t);
+    }
+    size_t highWater() const { return high_water.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return drops.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    struct Slot {
+        std::atomic<uint64_t> words[kWords];
+    };
+
+    static void store(Slot& slot, const T& item) {
+        uint64_t words[kWords] = {};
+        std::memcpy(words, &item, sizeof(T));
+        for (size_t i = 0; i < kWords; ++i)
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    // May return a torn item if the producer is overwriting the slot; the caller's
+    // compare-exchange on tail then fails and the copy is discarded.
+    static T load(const Slot& slot) {
+        uint64_t words[kWords];
+        for (size_t i = 0; i < kWords; ++i)
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        T item;
+        std::memcpy(&item, words, sizeof(T));
+        return item;
+    }
+
+    // Producer and consumer indices on separate cache lines.
+    alignas(64) std::atomic<uint64_t> head{0};
+    alignas(64) std::atomic<uint64_t> tail{0};
+    alignas(64) std::atomic<uint32_t> item_signal{0};
+    std::atomic<uint32_t> space_signal{0};
+    std::atomic<bool> closed{false};
+    std::atomic<uint64_t> drops{0};
+    std::atomic<size_t> high_water{0};
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+    OverflowPolicy policy;
+};
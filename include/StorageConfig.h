@@ -0,0 +1,62 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "Signals.h"
+
+enum class Partitioning {
+    None,
+    Hour,
+    Day,
+};
+
+enum class CompressionMode {
+    // Every sample is stored.
+    None,
+    // A sample is stored when it differs from the last stored value by more than the
+    // deviation; reads hold the stored value in between.
+    Deadband,
+    // Swinging-door trending: a sample is stored when the straight line from the last
+    // stored sample can no longer pass within the deviation of every sample since.
+    SwingingDoor,
+};
+
+struct SignalCompression {
+    CompressionMode mode = CompressionMode::None;
+    // Largest difference between a sampled value and the value reconstructed by
+    // linear interpolation between the stored samples around it.
+    double deviation = 0.0;
+};
+
+// Per-signal compression in front of persistence (see SampleCompressor).
+struct CompressionConfig {
+    // One entry per signal, indexed by signal (see Signals.h).
+    std::array<SignalCompression, kSignalCount> signals{};
+    // A compressed signal is stored at least this often even while it does not
+    // change, so readers can tell a steady signal from a stopped writer. 0 disables it.
+    int64_t max_silence_ms = 60000;
+
+    bool enabled() const {
+        for (const SignalCompression& s : signals) {
+            if (s.mode != CompressionMode::None)
+                return true;
+        }
+        return false;
+    }
+};
+
+// Where EngineImpl stores samples and alert events.
+struct StorageConfig {
+    // Database file; with partitioning, the directory holding one file per partition.
+    std::string path = "engine_data.db";
+    Partitioning partitioning = Partitioning::None;
+    // Partitions that ended longer ago than this are deleted; 0 keeps everything.
+    int64_t retention_ms = 0;
+    CompressionConfig compression;
+    // Blocked layout (see BlockWriter): up to block_rows consecutive samples, spanning
+    // less than block_ms, are packed into one engine_blocks row. 0 stores one
+    // engine_values row per sample. Single-file storage only.
+    size_t block_rows = 0;
+    int64_t block_ms = 10000;
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+// In-process span tracing, switched on and off at runtime.
+//
+// Each thread records into its own fixed-size ring, so recording takes no lock and
+// allocates nothing after a thread's first span. The ring keeps the most recent
+// kRingEvents spans and overwrites older ones. Timestamps are raw TSC reads
+// (steady_clock on non-x86), converted to microseconds only when the trace is
+// written. writeChromeJson() produces the Chrome trace event format, which
+// chrome://tracing and ui.perfetto.dev open.
+//
+// While tracing is off a TraceScope costs one relaxed atomic load and a branch.
+class Trace {
+public:
+    static constexpr size_t kRingEvents = 16384;
+
+    static bool enabled() { return on.load(std::memory_order_relaxed); }
+    static void enable();
+    static void disable();
+
+    static uint64_t now();
+    // Records a finished span. `name` must outlive the trace, e.g. a string literal.
+    static void record(const char* name, uint64_t begin, uint64_t end);
+    // Names the calling thread in written traces.
+    static void setThreadName(const char* name);
+
+    // Writes every thread's recorded spans; returns false if the file cannot be written.
+    static bool writeChromeJson(const std::string& path);
+    static std::string chromeJson();
+    // Drops recorded spans. Only call while no thread records.
+    static void clear();
+    // Spans recorded since the last clear(), including overwritten ones.
+    static uint64_t recorded();
+
+private:
+    static inline std::atomic<bool> on{false};
+};
+
+// Records the span from construction to destruction under `name`.
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : name(Trace::enabled() ? name : nullptr), begin(this->name ? Trace::now() : 0) {}
+    ~TraceScope() {
+        if (name)
+            Trace::record(name, begin, Trace::now());
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    uint64_t begin;
+};
+
+// Locks `mutex`, recording the time spent waiting for it as a span.
+inline std::unique_lock<std::mutex> lockTraced(std::mutex& mutex, const char* name) {
+    TraceScope wait(name);
+    return std::unique_lock<std::mutex>(mutex);
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+// Compile-time socket transport policy used by BasicServer. The operations mirror
+// the POSIX calls the server needs so an in-memory implementation can stand in for
+// the kernel in tests and benchmarks.
+template <typename T>
+concept SocketTransport = requires(T t, int fd, void* buf, const void* cbuf, size_t len,
+                                   sockaddr* addr, socklen_t* addrlen, const sockaddr* caddr,
+                                   pollfd* fds, nfds_t nfds) {
+    { t.socket(fd, fd, fd) } -> std::same_as<int>;
+    { t.setNonBlocking(fd) } -> std::same_as<bool>;
+    { t.setsockopt(fd, fd, fd, cbuf, socklen_t{}) } -> std::same_as<int>;
+    { t.bind(fd, caddr, socklen_t{}) } -> std::same_as<int>;
+    { t.listen(fd, fd) } -> std::same_as<int>;
+    { t.accept(fd, addr, addrlen) } -> std::same_as<int>;
+    { t.read(fd, buf, len) } -> std::same_as<ssize_t>;
+    { t.send(fd, cbuf, len, fd) } -> std::same_as<ssize_t>;
+    { t.sendto(fd, cbuf, len, fd, caddr, socklen_t{}) } -> std::same_as<ssize_t>;
+    { t.close(fd) } -> std::same_as<int>;
+    { t.poll(fds, nfds, fd) } -> std::same_as<int>;
+    // Wake-up descriptor other threads use to interrupt poll(): readable after
+    // wake() until drainWake().
+    { t.openWakeFd() } -> std::same_as<int>;
+    t.wake(fd);
+    t.drainWake(fd);
+};
+
+// Default transport: forwards straight to the C library.
+class PosixTransport {
+public:
+    int socket(int domain, int type, int protocol);
+    bool setNonBlocking(int fd);
+    int setsockopt(int fd, int level, int optname, const void* optval, socklen_t optlen);
+    int bind(int fd, const sockaddr* addr, socklen_t addrlen);
+    int listen(int fd, int backlog);
+    int accept(int fd, sockaddr* addr, socklen_t* addrlen);
+    ssize_t read(int fd, void* buf, size_t count);
+    ssize_t send(int fd, const void* buf, size_t len, int flags);
+    ssize_t sendto(int fd, const void* buf, size_t len, int flags, const sockaddr* dest, socklen_t destlen);
+    int close(int fd);
+    int poll(pollfd* fds, nfds_t nfds, int timeout);
+    int openWakeFd();
+    void wake(int fd);
+    void drainWake(int fd);
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Engine.h"
+#include "StorageConfig.h"
+
+// Result of reading the tail of stored history at startup.
+struct WarmStartStats {
+    uint64_t rows = 0;
+    double seconds = 0.0;
+    // The time budget or row cap ran out before the lookback window was covered.
+    bool truncated = false;
+};
+
+struct WarmStartOptions {
+    // Stop once this much time has been spent reading.
+    int64_t budget_ms = 250;
+    // Never return more samples than this.
+    size_t max_rows = 100000;
+};
+
+// Reads the stored samples with timestamp >= since_ms from `storage`, newest first,
+// and returns them oldest first in `samples`. The newest stored sample is always
+// included, however old, so the latest snapshot survives a restart.
+//
+// Each database is read newest first by timestamp, through the engine_values
+// timestamp index merged with engine_blocks by end_ts, so samples imported after
+// newer ones (see importHistory) do not end the scan early. The scan stops at the
+// first sample older than since_ms; the cost is proportional to the rows returned,
+// not to the size of the database.
+// Partitioned storage is read newest partition first. Sequence numbers are
+// assigned 1..n. Signals a row did not sample (NULL) take the previous row's value,
+// and `fresh`/`field_timestamp_ms` say which were sampled and when. Returns false only if a database exists but cannot be read.
+bool loadRecentSamples(const StorageConfig& storage, int64_t since_ms, std::vector<EngineSnapshot>& samples,
+                       WarmStartStats& stats, const WarmStartOptions& options = {});
@@ -22,11 +22,20 @@ namespace _pbi = _pb::internal;
 
 PROTOBUF_CONSTEXPR EngineData::EngineData(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.rpm_)*/0
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.windows_)*/{}
+  , /*decltype(_impl_.alerts_)*/{}
+  , /*decltype(_impl_.field_timestamp_ms_)*/{}
+  , /*decltype(_impl_._field_timestamp_ms_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.pipeline_)*/{}
+  , /*decltype(_impl_.export_chunk_)*/nullptr
+  , /*decltype(_impl_.rpm_)*/0
   , /*decltype(_impl_.temperature_)*/0
   , /*decltype(_impl_.oil_pressure_)*/0
   , /*decltype(_impl_.speed_)*/0
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.timestamp_ms_)*/int64_t{0}} {}
 struct EngineDataDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EngineDataDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -36,12 +45,133 @@ struct EngineDataDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EngineDataDefaultTypeInternal _EngineData_default_instance_;
-static ::_pb::Metadata file_level_metadata_engine_5fdata_2eproto[1];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_engine_5fdata_2eproto = nullptr;
+PROTOBUF_CONSTEXPR PipelineStage::PipelineStage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.depth_)*/0u
+  , /*decltype(_impl_.capacity_)*/0u
+  , /*decltype(_impl_.processed_)*/uint64_t{0u}
+  , /*decltype(_impl_.dropped_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_latency_us_)*/0
+  , /*decltype(_impl_.max_latency_us_)*/0
+  , /*decltype(_impl_.high_water_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PipelineStageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PipelineStageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PipelineStageDefaultTypeInternal() {}
+  union {
+    PipelineStage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PipelineStageDefaultTypeInternal _PipelineStage_default_instance_;
+PROTOBUF_CONSTEXPR ExportChunk::ExportChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_.failed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExportChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExportChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExportChunkDefaultTypeInternal() {}
+  union {
+    ExportChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExportChunkDefaultTypeInternal _ExportChunk_default_instance_;
+PROTOBUF_CONSTEXPR Alert::Alert(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rule_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.raised_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AlertDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AlertDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AlertDefaultTypeInternal() {}
+  union {
+    Alert _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AlertDefaultTypeInternal _Alert_default_instance_;
+PROTOBUF_CONSTEXPR SignalStats::SignalStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mean_)*/0
+  , /*decltype(_impl_.min_)*/0
+  , /*decltype(_impl_.max_)*/0
+  , /*decltype(_impl_.rate_per_s_)*/0
+  , /*decltype(_impl_.ewma_)*/0
+  , /*decltype(_impl_.p50_)*/0
+  , /*decltype(_impl_.p90_)*/0
+  , /*decltype(_impl_.p99_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SignalStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SignalStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SignalStatsDefaultTypeInternal() {}
+  union {
+    SignalStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SignalStatsDefaultTypeInternal _SignalStats_default_instance_;
+PROTOBUF_CONSTEXPR WindowStats::WindowStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rpm_)*/nullptr
+  , /*decltype(_impl_.temperature_)*/nullptr
+  , /*decltype(_impl_.oil_pressure_)*/nullptr
+  , /*decltype(_impl_.speed_)*/nullptr
+  , /*decltype(_impl_.window_ms_)*/0u
+  , /*decltype(_impl_.count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WindowStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WindowStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WindowStatsDefaultTypeInternal() {}
+  union {
+    WindowStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WindowStatsDefaultTypeInternal _WindowStats_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.export_history_)*/nullptr
+  , /*decltype(_impl_.include_stats_)*/false
+  , /*decltype(_impl_.subscribe_alerts_)*/false
+  , /*decltype(_impl_.wait_ms_)*/0u
+  , /*decltype(_impl_.after_sequence_)*/uint64_t{0u}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR ExportRequest::ExportRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_ms_)*/int64_t{0}
+  , /*decltype(_impl_.to_ms_)*/int64_t{0}
+  , /*decltype(_impl_.step_ms_)*/int64_t{0}
+  , /*decltype(_impl_.format_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExportRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExportRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExportRequestDefaultTypeInternal() {}
+  union {
+    ExportRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExportRequestDefaultTypeInternal _ExportRequest_default_instance_;
+static ::_pb::Metadata file_level_metadata_engine_5fdata_2eproto[8];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_engine_5fdata_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_engine_5fdata_2eproto = nullptr;
 
 const uint32_t TableStruct_engine_5fdata_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::EngineData, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -51,25 +181,169 @@ const uint32_t TableStruct_engine_5fdata_2eproto::offsets[] PROTOBUF_SECTION_VAR
   PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.temperature_),
   PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.oil_pressure_),
   PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.speed_),
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.timestamp_ms_),
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.windows_),
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.alerts_),
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.export_chunk_),
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.field_timestamp_ms_),
+  PROTOBUF_FIELD_OFFSET(::EngineData, _impl_.pipeline_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.depth_),
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.capacity_),
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.high_water_),
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.processed_),
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.dropped_),
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.mean_latency_us_),
+  PROTOBUF_FIELD_OFFSET(::PipelineStage, _impl_.max_latency_us_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ExportChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ExportChunk, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::ExportChunk, _impl_.last_),
+  PROTOBUF_FIELD_OFFSET(::ExportChunk, _impl_.failed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Alert, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Alert, _impl_.rule_),
+  PROTOBUF_FIELD_OFFSET(::Alert, _impl_.raised_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.mean_),
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.rate_per_s_),
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.ewma_),
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.p50_),
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.p90_),
+  PROTOBUF_FIELD_OFFSET(::SignalStats, _impl_.p99_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::WindowStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WindowStats, _impl_.window_ms_),
+  PROTOBUF_FIELD_OFFSET(::WindowStats, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::WindowStats, _impl_.rpm_),
+  PROTOBUF_FIELD_OFFSET(::WindowStats, _impl_.temperature_),
+  PROTOBUF_FIELD_OFFSET(::WindowStats, _impl_.oil_pressure_),
+  PROTOBUF_FIELD_OFFSET(::WindowStats, _impl_.speed_),
+  PROTOBUF_FIELD_OFFSET(::Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Request, _impl_.include_stats_),
+  PROTOBUF_FIELD_OFFSET(::Request, _impl_.subscribe_alerts_),
+  PROTOBUF_FIELD_OFFSET(::Request, _impl_.export_history_),
+  PROTOBUF_FIELD_OFFSET(::Request, _impl_.after_sequence_),
+  PROTOBUF_FIELD_OFFSET(::Request, _impl_.wait_ms_),
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ExportRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ExportRequest, _impl_.from_ms_),
+  PROTOBUF_FIELD_OFFSET(::ExportRequest, _impl_.to_ms_),
+  PROTOBUF_FIELD_OFFSET(::ExportRequest, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::ExportRequest, _impl_.step_ms_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::EngineData)},
+  { 0, 17, -1, sizeof(::EngineData)},
+  { 28, -1, -1, sizeof(::PipelineStage)},
+  { 42, -1, -1, sizeof(::ExportChunk)},
+  { 51, -1, -1, sizeof(::Alert)},
+  { 59, -1, -1, sizeof(::SignalStats)},
+  { 73, -1, -1, sizeof(::WindowStats)},
+  { 85, 96, -1, sizeof(::Request)},
+  { 101, -1, -1, sizeof(::ExportRequest)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::_EngineData_default_instance_._instance,
+  &::_PipelineStage_default_instance_._instance,
+  &::_ExportChunk_default_instance_._instance,
+  &::_Alert_default_instance_._instance,
+  &::_SignalStats_default_instance_._instance,
+  &::_WindowStats_default_instance_._instance,
+  &::_Request_default_instance_._instance,
+  &::_ExportRequest_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_engine_5fdata_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\021engine_data.proto\"S\n\nEngineData\022\013\n\003rpm"
-  "\030\001 \001(\005\022\023\n\013temperature\030\002 \001(\005\022\024\n\014oil_press"
-  "ure\030\003 \001(\005\022\r\n\005speed\030\004 \001(\005b\006proto3"
+  "\n\021engine_data.proto\"\333\002\n\nEngineData\022\020\n\003rp"
+  "m\030\001 \001(\005H\000\210\001\001\022\030\n\013temperature\030\002 \001(\005H\001\210\001\001\022\031"
+  "\n\014oil_pressure\030\003 \001(\005H\002\210\001\001\022\022\n\005speed\030\004 \001(\005"
+  "H\003\210\001\001\022\020\n\010sequence\030\005 \001(\004\022\024\n\014timestamp_ms\030"
+  "\006 \001(\003\022\035\n\007windows\030\007 \003(\0132\014.WindowStats\022\026\n\006"
+  "alerts\030\010 \003(\0132\006.Alert\022\"\n\014export_chunk\030\t \001"
+  "(\0132\014.ExportChunk\022\032\n\022field_timestamp_ms\030\n"
+  " \003(\003\022 \n\010pipeline\030\013 \003(\0132\016.PipelineStageB\006"
+  "\n\004_rpmB\016\n\014_temperatureB\017\n\r_oil_pressureB"
+  "\010\n\006_speed\"\247\001\n\rPipelineStage\022\014\n\004name\030\001 \001("
+  "\t\022\r\n\005depth\030\002 \001(\r\022\020\n\010capacity\030\003 \001(\r\022\022\n\nhi"
+  "gh_water\030\004 \001(\r\022\021\n\tprocessed\030\005 \001(\004\022\017\n\007dro"
+  "pped\030\006 \001(\004\022\027\n\017mean_latency_us\030\007 \001(\001\022\026\n\016m"
+  "ax_latency_us\030\010 \001(\001\"9\n\013ExportChunk\022\014\n\004da"
+  "ta\030\001 \001(\014\022\014\n\004last\030\002 \001(\010\022\016\n\006failed\030\003 \001(\010\"%"
+  "\n\005Alert\022\014\n\004rule\030\001 \001(\t\022\016\n\006raised\030\002 \001(\010\"~\n"
+  "\013SignalStats\022\014\n\004mean\030\001 \001(\001\022\013\n\003min\030\002 \001(\005\022"
+  "\013\n\003max\030\003 \001(\005\022\022\n\nrate_per_s\030\004 \001(\001\022\014\n\004ewma"
+  "\030\005 \001(\001\022\013\n\003p50\030\006 \001(\001\022\013\n\003p90\030\007 \001(\001\022\013\n\003p99\030"
+  "\010 \001(\001\"\256\001\n\013WindowStats\022\021\n\twindow_ms\030\001 \001(\r"
+  "\022\r\n\005count\030\002 \001(\r\022\031\n\003rpm\030\003 \001(\0132\014.SignalSta"
+  "ts\022!\n\013temperature\030\004 \001(\0132\014.SignalStats\022\"\n"
+  "\014oil_pressure\030\005 \001(\0132\014.SignalStats\022\033\n\005spe"
+  "ed\030\006 \001(\0132\014.SignalStats\"\243\001\n\007Request\022\025\n\rin"
+  "clude_stats\030\001 \001(\010\022\030\n\020subscribe_alerts\030\002 "
+  "\001(\010\022&\n\016export_history\030\003 \001(\0132\016.ExportRequ"
+  "est\022\033\n\016after_sequence\030\004 \001(\004H\000\210\001\001\022\017\n\007wait"
+  "_ms\030\005 \001(\rB\021\n\017_after_sequence\"\206\001\n\rExportR"
+  "equest\022\017\n\007from_ms\030\001 \001(\003\022\r\n\005to_ms\030\002 \001(\003\022%"
+  "\n\006format\030\003 \001(\0162\025.ExportRequest.Format\022\017\n"
+  "\007step_ms\030\004 \001(\003\"\035\n\006Format\022\007\n\003CSV\020\000\022\n\n\006BIN"
+  "ARY\020\001b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_engine_5fdata_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_engine_5fdata_2eproto = {
-    false, false, 112, descriptor_table_protodef_engine_5fdata_2eproto,
+    false, false, 1253, descriptor_table_protodef_engine_5fdata_2eproto,
     "engine_data.proto",
-    &descriptor_table_engine_5fdata_2eproto_once, nullptr, 0, 1,
+    &descriptor_table_engine_5fdata_2eproto_once, nullptr, 0, 8,
     schemas, file_default_instances, TableStruct_engine_5fdata_2eproto::offsets,
     file_level_metadata_engine_5fdata_2eproto, file_level_enum_descriptors_engine_5fdata_2eproto,
     file_level_service_descriptors_engine_5fdata_2eproto,
@@ -80,13 +354,52 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_engine_5
 
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_engine_5fdata_2eproto(&descriptor_table_engine_5fdata_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExportRequest_Format_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_engine_5fdata_2eproto);
+  return file_level_enum_descriptors_engine_5fdata_2eproto[0];
+}
+bool ExportRequest_Format_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ExportRequest_Format ExportRequest::CSV;
+constexpr ExportRequest_Format ExportRequest::BINARY;
+constexpr ExportRequest_Format ExportRequest::Format_MIN;
+constexpr ExportRequest_Format ExportRequest::Format_MAX;
+constexpr int ExportRequest::Format_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
 class EngineData::_Internal {
  public:
+  using HasBits = decltype(std::declval<EngineData>()._impl_._has_bits_);
+  static void set_has_rpm(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_temperature(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_oil_pressure(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::ExportChunk& export_chunk(const EngineData* msg);
 };
 
+const ::ExportChunk&
+EngineData::_Internal::export_chunk(const EngineData* msg) {
+  return *msg->_impl_.export_chunk_;
+}
 EngineData::EngineData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -97,16 +410,28 @@ EngineData::EngineData(const EngineData& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   EngineData* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.rpm_){}
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.windows_){from._impl_.windows_}
+    , decltype(_impl_.alerts_){from._impl_.alerts_}
+    , decltype(_impl_.field_timestamp_ms_){from._impl_.field_timestamp_ms_}
+    , /*decltype(_impl_._field_timestamp_ms_cached_byte_size_)*/{0}
+    , decltype(_impl_.pipeline_){from._impl_.pipeline_}
+    , decltype(_impl_.export_chunk_){nullptr}
+    , decltype(_impl_.rpm_){}
     , decltype(_impl_.temperature_){}
     , decltype(_impl_.oil_pressure_){}
     , decltype(_impl_.speed_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.timestamp_ms_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_export_chunk()) {
+    _this->_impl_.export_chunk_ = new ::ExportChunk(*from._impl_.export_chunk_);
+  }
   ::memcpy(&_impl_.rpm_, &from._impl_.rpm_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.speed_) -
-    reinterpret_cast<char*>(&_impl_.rpm_)) + sizeof(_impl_.speed_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timestamp_ms_) -
+    reinterpret_cast<char*>(&_impl_.rpm_)) + sizeof(_impl_.timestamp_ms_));
   // @@protoc_insertion_point(copy_constructor:EngineData)
 }
 
@@ -115,11 +440,20 @@ inline void EngineData::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.rpm_){0}
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.windows_){arena}
+    , decltype(_impl_.alerts_){arena}
+    , decltype(_impl_.field_timestamp_ms_){arena}
+    , /*decltype(_impl_._field_timestamp_ms_cached_byte_size_)*/{0}
+    , decltype(_impl_.pipeline_){arena}
+    , decltype(_impl_.export_chunk_){nullptr}
+    , decltype(_impl_.rpm_){0}
     , decltype(_impl_.temperature_){0}
     , decltype(_impl_.oil_pressure_){0}
     , decltype(_impl_.speed_){0}
-    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.timestamp_ms_){int64_t{0}}
   };
 }
 
@@ -134,6 +468,11 @@ EngineData::~EngineData() {
 
 inline void EngineData::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.windows_.~RepeatedPtrField();
+  _impl_.alerts_.~RepeatedPtrField();
+  _impl_.field_timestamp_ms_.~RepeatedField();
+  _impl_.pipeline_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.export_chunk_;
 }
 
 void EngineData::SetCachedSize(int size) const {
@@ -146,50 +485,144 @@ void EngineData::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.rpm_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.speed_) -
-      reinterpret_cast<char*>(&_impl_.rpm_)) + sizeof(_impl_.speed_));
+  _impl_.windows_.Clear();
+  _impl_.alerts_.Clear();
+  _impl_.field_timestamp_ms_.Clear();
+  _impl_.pipeline_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.export_chunk_ != nullptr) {
+    delete _impl_.export_chunk_;
+  }
+  _impl_.export_chunk_ = nullptr;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.rpm_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.speed_) -
+        reinterpret_cast<char*>(&_impl_.rpm_)) + sizeof(_impl_.speed_));
+  }
+  ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timestamp_ms_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.timestamp_ms_));
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 const char* EngineData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 rpm = 1;
+      // optional int32 rpm = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_rpm(&has_bits);
           _impl_.rpm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 temperature = 2;
+      // optional int32 temperature = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_temperature(&has_bits);
           _impl_.temperature_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 oil_pressure = 3;
+      // optional int32 oil_pressure = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_oil_pressure(&has_bits);
           _impl_.oil_pressure_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // int32 speed = 4;
+      // optional int32 speed = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_speed(&has_bits);
           _impl_.speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
+      // uint64 sequence = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.timestamp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .WindowStats windows = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_windows(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Alert alerts = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_alerts(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ExportChunk export_chunk = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_export_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 field_timestamp_ms = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_field_timestamp_ms(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 80) {
+          _internal_add_field_timestamp_ms(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .PipelineStage pipeline = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pipeline(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -206,6 +639,7 @@ const char* EngineData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -219,30 +653,82 @@ uint8_t* EngineData::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 rpm = 1;
-  if (this->_internal_rpm() != 0) {
+  // optional int32 rpm = 1;
+  if (_internal_has_rpm()) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_rpm(), target);
   }
 
-  // int32 temperature = 2;
-  if (this->_internal_temperature() != 0) {
+  // optional int32 temperature = 2;
+  if (_internal_has_temperature()) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_temperature(), target);
   }
 
-  // int32 oil_pressure = 3;
-  if (this->_internal_oil_pressure() != 0) {
+  // optional int32 oil_pressure = 3;
+  if (_internal_has_oil_pressure()) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_oil_pressure(), target);
   }
 
-  // int32 speed = 4;
-  if (this->_internal_speed() != 0) {
+  // optional int32 speed = 4;
+  if (_internal_has_speed()) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_speed(), target);
   }
 
+  // uint64 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_sequence(), target);
+  }
+
+  // int64 timestamp_ms = 6;
+  if (this->_internal_timestamp_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_timestamp_ms(), target);
+  }
+
+  // repeated .WindowStats windows = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_windows_size()); i < n; i++) {
+    const auto& repfield = this->_internal_windows(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .Alert alerts = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_alerts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_alerts(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .ExportChunk export_chunk = 9;
+  if (this->_internal_has_export_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::export_chunk(this),
+        _Internal::export_chunk(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated int64 field_timestamp_ms = 10;
+  {
+    int byte_size = _impl_._field_timestamp_ms_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          10, _internal_field_timestamp_ms(), byte_size, target);
+    }
+  }
+
+  // repeated .PipelineStage pipeline = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pipeline_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pipeline(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -259,24 +745,79 @@ size_t EngineData::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 rpm = 1;
-  if (this->_internal_rpm() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_rpm());
+  // repeated .WindowStats windows = 7;
+  total_size += 1UL * this->_internal_windows_size();
+  for (const auto& msg : this->_impl_.windows_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int32 temperature = 2;
-  if (this->_internal_temperature() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_temperature());
+  // repeated .Alert alerts = 8;
+  total_size += 1UL * this->_internal_alerts_size();
+  for (const auto& msg : this->_impl_.alerts_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int32 oil_pressure = 3;
-  if (this->_internal_oil_pressure() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_oil_pressure());
+  // repeated int64 field_timestamp_ms = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.field_timestamp_ms_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._field_timestamp_ms_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .PipelineStage pipeline = 11;
+  total_size += 1UL * this->_internal_pipeline_size();
+  for (const auto& msg : this->_impl_.pipeline_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .ExportChunk export_chunk = 9;
+  if (this->_internal_has_export_chunk()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.export_chunk_);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional int32 rpm = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_rpm());
+    }
+
+    // optional int32 temperature = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_temperature());
+    }
+
+    // optional int32 oil_pressure = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_oil_pressure());
+    }
+
+    // optional int32 speed = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_speed());
+    }
+
+  }
+  // uint64 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
   }
 
-  // int32 speed = 4;
-  if (this->_internal_speed() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_speed());
+  // int64 timestamp_ms = 6;
+  if (this->_internal_timestamp_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp_ms());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
@@ -297,17 +838,35 @@ void EngineData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PRO
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_rpm() != 0) {
-    _this->_internal_set_rpm(from._internal_rpm());
+  _this->_impl_.windows_.MergeFrom(from._impl_.windows_);
+  _this->_impl_.alerts_.MergeFrom(from._impl_.alerts_);
+  _this->_impl_.field_timestamp_ms_.MergeFrom(from._impl_.field_timestamp_ms_);
+  _this->_impl_.pipeline_.MergeFrom(from._impl_.pipeline_);
+  if (from._internal_has_export_chunk()) {
+    _this->_internal_mutable_export_chunk()->::ExportChunk::MergeFrom(
+        from._internal_export_chunk());
   }
-  if (from._internal_temperature() != 0) {
-    _this->_internal_set_temperature(from._internal_temperature());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.rpm_ = from._impl_.rpm_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.temperature_ = from._impl_.temperature_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.oil_pressure_ = from._impl_.oil_pressure_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.speed_ = from._impl_.speed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_oil_pressure() != 0) {
-    _this->_internal_set_oil_pressure(from._internal_oil_pressure());
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
   }
-  if (from._internal_speed() != 0) {
-    _this->_internal_set_speed(from._internal_speed());
+  if (from._internal_timestamp_ms() != 0) {
+    _this->_internal_set_timestamp_ms(from._internal_timestamp_ms());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -326,12 +885,17 @@ bool EngineData::IsInitialized() const {
 void EngineData::InternalSwap(EngineData* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.windows_.InternalSwap(&other->_impl_.windows_);
+  _impl_.alerts_.InternalSwap(&other->_impl_.alerts_);
+  _impl_.field_timestamp_ms_.InternalSwap(&other->_impl_.field_timestamp_ms_);
+  _impl_.pipeline_.InternalSwap(&other->_impl_.pipeline_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EngineData, _impl_.speed_)
-      + sizeof(EngineData::_impl_.speed_)
-      - PROTOBUF_FIELD_OFFSET(EngineData, _impl_.rpm_)>(
-          reinterpret_cast<char*>(&_impl_.rpm_),
-          reinterpret_cast<char*>(&other->_impl_.rpm_));
+      PROTOBUF_FIELD_OFFSET(EngineData, _impl_.timestamp_ms_)
+      + sizeof(EngineData::_impl_.timestamp_ms_)
+      - PROTOBUF_FIELD_OFFSET(EngineData, _impl_.export_chunk_)>(
+          reinterpret_cast<char*>(&_impl_.export_chunk_),
+          reinterpret_cast<char*>(&other->_impl_.export_chunk_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EngineData::GetMetadata() const {
@@ -340,11 +904,2311 @@ void EngineData::InternalSwap(EngineData* other) {
       file_level_metadata_engine_5fdata_2eproto[0]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::EngineData*
-Arena::CreateMaybeMessage< ::EngineData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::EngineData >(arena);
+// ===================================================================
+
+class PipelineStage::_Internal {
+ public:
+};
+
+PipelineStage::PipelineStage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PipelineStage)
+}
+PipelineStage::PipelineStage(const PipelineStage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PipelineStage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.depth_){}
+    , decltype(_impl_.capacity_){}
+    , decltype(_impl_.processed_){}
+    , decltype(_impl_.dropped_){}
+    , decltype(_impl_.mean_latency_us_){}
+    , decltype(_impl_.max_latency_us_){}
+    , decltype(_impl_.high_water_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.depth_, &from._impl_.depth_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.high_water_) -
+    reinterpret_cast<char*>(&_impl_.depth_)) + sizeof(_impl_.high_water_));
+  // @@protoc_insertion_point(copy_constructor:PipelineStage)
+}
+
+inline void PipelineStage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.depth_){0u}
+    , decltype(_impl_.capacity_){0u}
+    , decltype(_impl_.processed_){uint64_t{0u}}
+    , decltype(_impl_.dropped_){uint64_t{0u}}
+    , decltype(_impl_.mean_latency_us_){0}
+    , decltype(_impl_.max_latency_us_){0}
+    , decltype(_impl_.high_water_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PipelineStage::~PipelineStage() {
+  // @@protoc_insertion_point(destructor:PipelineStage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PipelineStage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void PipelineStage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PipelineStage::Clear() {
+// @@protoc_insertion_point(message_clear_start:PipelineStage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.depth_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.high_water_) -
+      reinterpret_cast<char*>(&_impl_.depth_)) + sizeof(_impl_.high_water_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PipelineStage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "PipelineStage.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 depth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 capacity = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 high_water = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.high_water_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 processed = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.processed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dropped = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double mean_latency_us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.mean_latency_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double max_latency_us = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.max_latency_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PipelineStage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PipelineStage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "PipelineStage.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint32 depth = 2;
+  if (this->_internal_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_depth(), target);
+  }
+
+  // uint32 capacity = 3;
+  if (this->_internal_capacity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_capacity(), target);
+  }
+
+  // uint32 high_water = 4;
+  if (this->_internal_high_water() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_high_water(), target);
+  }
+
+  // uint64 processed = 5;
+  if (this->_internal_processed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_processed(), target);
+  }
+
+  // uint64 dropped = 6;
+  if (this->_internal_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_dropped(), target);
+  }
+
+  // double mean_latency_us = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean_latency_us = this->_internal_mean_latency_us();
+  uint64_t raw_mean_latency_us;
+  memcpy(&raw_mean_latency_us, &tmp_mean_latency_us, sizeof(tmp_mean_latency_us));
+  if (raw_mean_latency_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_mean_latency_us(), target);
+  }
+
+  // double max_latency_us = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency_us = this->_internal_max_latency_us();
+  uint64_t raw_max_latency_us;
+  memcpy(&raw_max_latency_us, &tmp_max_latency_us, sizeof(tmp_max_latency_us));
+  if (raw_max_latency_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_max_latency_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PipelineStage)
+  return target;
+}
+
+size_t PipelineStage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PipelineStage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint32 depth = 2;
+  if (this->_internal_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_depth());
+  }
+
+  // uint32 capacity = 3;
+  if (this->_internal_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_capacity());
+  }
+
+  // uint64 processed = 5;
+  if (this->_internal_processed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_processed());
+  }
+
+  // uint64 dropped = 6;
+  if (this->_internal_dropped() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_dropped());
+  }
+
+  // double mean_latency_us = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean_latency_us = this->_internal_mean_latency_us();
+  uint64_t raw_mean_latency_us;
+  memcpy(&raw_mean_latency_us, &tmp_mean_latency_us, sizeof(tmp_mean_latency_us));
+  if (raw_mean_latency_us != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double max_latency_us = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency_us = this->_internal_max_latency_us();
+  uint64_t raw_max_latency_us;
+  memcpy(&raw_max_latency_us, &tmp_max_latency_us, sizeof(tmp_max_latency_us));
+  if (raw_max_latency_us != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 high_water = 4;
+  if (this->_internal_high_water() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_high_water());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PipelineStage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PipelineStage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PipelineStage::GetClassData() const { return &_class_data_; }
+
+
+void PipelineStage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PipelineStage*>(&to_msg);
+  auto& from = static_cast<const PipelineStage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PipelineStage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_depth() != 0) {
+    _this->_internal_set_depth(from._internal_depth());
+  }
+  if (from._internal_capacity() != 0) {
+    _this->_internal_set_capacity(from._internal_capacity());
+  }
+  if (from._internal_processed() != 0) {
+    _this->_internal_set_processed(from._internal_processed());
+  }
+  if (from._internal_dropped() != 0) {
+    _this->_internal_set_dropped(from._internal_dropped());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean_latency_us = from._internal_mean_latency_us();
+  uint64_t raw_mean_latency_us;
+  memcpy(&raw_mean_latency_us, &tmp_mean_latency_us, sizeof(tmp_mean_latency_us));
+  if (raw_mean_latency_us != 0) {
+    _this->_internal_set_mean_latency_us(from._internal_mean_latency_us());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency_us = from._internal_max_latency_us();
+  uint64_t raw_max_latency_us;
+  memcpy(&raw_max_latency_us, &tmp_max_latency_us, sizeof(tmp_max_latency_us));
+  if (raw_max_latency_us != 0) {
+    _this->_internal_set_max_latency_us(from._internal_max_latency_us());
+  }
+  if (from._internal_high_water() != 0) {
+    _this->_internal_set_high_water(from._internal_high_water());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PipelineStage::CopyFrom(const PipelineStage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PipelineStage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PipelineStage::IsInitialized() const {
+  return true;
+}
+
+void PipelineStage::InternalSwap(PipelineStage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PipelineStage, _impl_.high_water_)
+      + sizeof(PipelineStage::_impl_.high_water_)
+      - PROTOBUF_FIELD_OFFSET(PipelineStage, _impl_.depth_)>(
+          reinterpret_cast<char*>(&_impl_.depth_),
+          reinterpret_cast<char*>(&other->_impl_.depth_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PipelineStage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_engine_5fdata_2eproto_getter, &descriptor_table_engine_5fdata_2eproto_once,
+      file_level_metadata_engine_5fdata_2eproto[1]);
+}
+
+// ===================================================================
+
+class ExportChunk::_Internal {
+ public:
+};
+
+ExportChunk::ExportChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ExportChunk)
+}
+ExportChunk::ExportChunk(const ExportChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExportChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.last_){}
+    , decltype(_impl_.failed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.last_, &from._impl_.last_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.failed_) -
+    reinterpret_cast<char*>(&_impl_.last_)) + sizeof(_impl_.failed_));
+  // @@protoc_insertion_point(copy_constructor:ExportChunk)
+}
+
+inline void ExportChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.last_){false}
+    , decltype(_impl_.failed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ExportChunk::~ExportChunk() {
+  // @@protoc_insertion_point(destructor:ExportChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExportChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void ExportChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExportChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:ExportChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.last_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.failed_) -
+      reinterpret_cast<char*>(&_impl_.last_)) + sizeof(_impl_.failed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExportChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes data = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool failed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.failed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExportChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ExportChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes data = 1;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_data(), target);
+  }
+
+  // bool last = 2;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_last(), target);
+  }
+
+  // bool failed = 3;
+  if (this->_internal_failed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_failed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ExportChunk)
+  return target;
+}
+
+size_t ExportChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ExportChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 1;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // bool last = 2;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool failed = 3;
+  if (this->_internal_failed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExportChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExportChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExportChunk::GetClassData() const { return &_class_data_; }
+
+
+void ExportChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExportChunk*>(&to_msg);
+  auto& from = static_cast<const ExportChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ExportChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  if (from._internal_failed() != 0) {
+    _this->_internal_set_failed(from._internal_failed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExportChunk::CopyFrom(const ExportChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ExportChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExportChunk::IsInitialized() const {
+  return true;
+}
+
+void ExportChunk::InternalSwap(ExportChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExportChunk, _impl_.failed_)
+      + sizeof(ExportChunk::_impl_.failed_)
+      - PROTOBUF_FIELD_OFFSET(ExportChunk, _impl_.last_)>(
+          reinterpret_cast<char*>(&_impl_.last_),
+          reinterpret_cast<char*>(&other->_impl_.last_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExportChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_engine_5fdata_2eproto_getter, &descriptor_table_engine_5fdata_2eproto_once,
+      file_level_metadata_engine_5fdata_2eproto[2]);
+}
+
+// ===================================================================
+
+class Alert::_Internal {
+ public:
+};
+
+Alert::Alert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Alert)
+}
+Alert::Alert(const Alert& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Alert* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rule_){}
+    , decltype(_impl_.raised_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rule_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rule_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rule().empty()) {
+    _this->_impl_.rule_.Set(from._internal_rule(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.raised_ = from._impl_.raised_;
+  // @@protoc_insertion_point(copy_constructor:Alert)
+}
+
+inline void Alert::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rule_){}
+    , decltype(_impl_.raised_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rule_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rule_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Alert::~Alert() {
+  // @@protoc_insertion_point(destructor:Alert)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Alert::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rule_.Destroy();
+}
+
+void Alert::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Alert::Clear() {
+// @@protoc_insertion_point(message_clear_start:Alert)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rule_.ClearToEmpty();
+  _impl_.raised_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Alert::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rule = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rule();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Alert.rule"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool raised = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.raised_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Alert::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Alert)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rule = 1;
+  if (!this->_internal_rule().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rule().data(), static_cast<int>(this->_internal_rule().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Alert.rule");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rule(), target);
+  }
+
+  // bool raised = 2;
+  if (this->_internal_raised() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_raised(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Alert)
+  return target;
+}
+
+size_t Alert::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Alert)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rule = 1;
+  if (!this->_internal_rule().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rule());
+  }
+
+  // bool raised = 2;
+  if (this->_internal_raised() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Alert::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Alert::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Alert::GetClassData() const { return &_class_data_; }
+
+
+void Alert::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Alert*>(&to_msg);
+  auto& from = static_cast<const Alert&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Alert)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rule().empty()) {
+    _this->_internal_set_rule(from._internal_rule());
+  }
+  if (from._internal_raised() != 0) {
+    _this->_internal_set_raised(from._internal_raised());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Alert::CopyFrom(const Alert& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Alert)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Alert::IsInitialized() const {
+  return true;
+}
+
+void Alert::InternalSwap(Alert* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rule_, lhs_arena,
+      &other->_impl_.rule_, rhs_arena
+  );
+  swap(_impl_.raised_, other->_impl_.raised_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Alert::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_engine_5fdata_2eproto_getter, &descriptor_table_engine_5fdata_2eproto_once,
+      file_level_metadata_engine_5fdata_2eproto[3]);
+}
+
+// ===================================================================
+
+class SignalStats::_Internal {
+ public:
+};
+
+SignalStats::SignalStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SignalStats)
+}
+SignalStats::SignalStats(const SignalStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SignalStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mean_){}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , decltype(_impl_.rate_per_s_){}
+    , decltype(_impl_.ewma_){}
+    , decltype(_impl_.p50_){}
+    , decltype(_impl_.p90_){}
+    , decltype(_impl_.p99_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.mean_, &from._impl_.mean_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.p99_) -
+    reinterpret_cast<char*>(&_impl_.mean_)) + sizeof(_impl_.p99_));
+  // @@protoc_insertion_point(copy_constructor:SignalStats)
+}
+
+inline void SignalStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mean_){0}
+    , decltype(_impl_.min_){0}
+    , decltype(_impl_.max_){0}
+    , decltype(_impl_.rate_per_s_){0}
+    , decltype(_impl_.ewma_){0}
+    , decltype(_impl_.p50_){0}
+    , decltype(_impl_.p90_){0}
+    , decltype(_impl_.p99_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SignalStats::~SignalStats() {
+  // @@protoc_insertion_point(destructor:SignalStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SignalStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SignalStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SignalStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:SignalStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.mean_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.p99_) -
+      reinterpret_cast<char*>(&_impl_.mean_)) + sizeof(_impl_.p99_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SignalStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double mean = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.mean_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 min = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double rate_per_s = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.rate_per_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double ewma = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.ewma_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p50 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.p50_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p90 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.p90_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p99 = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.p99_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SignalStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SignalStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double mean = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_mean(), target);
+  }
+
+  // int32 min = 2;
+  if (this->_internal_min() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_min(), target);
+  }
+
+  // int32 max = 3;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_max(), target);
+  }
+
+  // double rate_per_s = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate_per_s = this->_internal_rate_per_s();
+  uint64_t raw_rate_per_s;
+  memcpy(&raw_rate_per_s, &tmp_rate_per_s, sizeof(tmp_rate_per_s));
+  if (raw_rate_per_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_rate_per_s(), target);
+  }
+
+  // double ewma = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ewma = this->_internal_ewma();
+  uint64_t raw_ewma;
+  memcpy(&raw_ewma, &tmp_ewma, sizeof(tmp_ewma));
+  if (raw_ewma != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_ewma(), target);
+  }
+
+  // double p50 = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50 = this->_internal_p50();
+  uint64_t raw_p50;
+  memcpy(&raw_p50, &tmp_p50, sizeof(tmp_p50));
+  if (raw_p50 != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_p50(), target);
+  }
+
+  // double p90 = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p90 = this->_internal_p90();
+  uint64_t raw_p90;
+  memcpy(&raw_p90, &tmp_p90, sizeof(tmp_p90));
+  if (raw_p90 != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_p90(), target);
+  }
+
+  // double p99 = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99 = this->_internal_p99();
+  uint64_t raw_p99;
+  memcpy(&raw_p99, &tmp_p99, sizeof(tmp_p99));
+  if (raw_p99 != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_p99(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SignalStats)
+  return target;
+}
+
+size_t SignalStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SignalStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double mean = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 min = 2;
+  if (this->_internal_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min());
+  }
+
+  // int32 max = 3;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max());
+  }
+
+  // double rate_per_s = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate_per_s = this->_internal_rate_per_s();
+  uint64_t raw_rate_per_s;
+  memcpy(&raw_rate_per_s, &tmp_rate_per_s, sizeof(tmp_rate_per_s));
+  if (raw_rate_per_s != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double ewma = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ewma = this->_internal_ewma();
+  uint64_t raw_ewma;
+  memcpy(&raw_ewma, &tmp_ewma, sizeof(tmp_ewma));
+  if (raw_ewma != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p50 = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50 = this->_internal_p50();
+  uint64_t raw_p50;
+  memcpy(&raw_p50, &tmp_p50, sizeof(tmp_p50));
+  if (raw_p50 != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p90 = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p90 = this->_internal_p90();
+  uint64_t raw_p90;
+  memcpy(&raw_p90, &tmp_p90, sizeof(tmp_p90));
+  if (raw_p90 != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p99 = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99 = this->_internal_p99();
+  uint64_t raw_p99;
+  memcpy(&raw_p99, &tmp_p99, sizeof(tmp_p99));
+  if (raw_p99 != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SignalStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SignalStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SignalStats::GetClassData() const { return &_class_data_; }
+
+
+void SignalStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SignalStats*>(&to_msg);
+  auto& from = static_cast<const SignalStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SignalStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = from._internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    _this->_internal_set_mean(from._internal_mean());
+  }
+  if (from._internal_min() != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate_per_s = from._internal_rate_per_s();
+  uint64_t raw_rate_per_s;
+  memcpy(&raw_rate_per_s, &tmp_rate_per_s, sizeof(tmp_rate_per_s));
+  if (raw_rate_per_s != 0) {
+    _this->_internal_set_rate_per_s(from._internal_rate_per_s());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ewma = from._internal_ewma();
+  uint64_t raw_ewma;
+  memcpy(&raw_ewma, &tmp_ewma, sizeof(tmp_ewma));
+  if (raw_ewma != 0) {
+    _this->_internal_set_ewma(from._internal_ewma());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50 = from._internal_p50();
+  uint64_t raw_p50;
+  memcpy(&raw_p50, &tmp_p50, sizeof(tmp_p50));
+  if (raw_p50 != 0) {
+    _this->_internal_set_p50(from._internal_p50());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p90 = from._internal_p90();
+  uint64_t raw_p90;
+  memcpy(&raw_p90, &tmp_p90, sizeof(tmp_p90));
+  if (raw_p90 != 0) {
+    _this->_internal_set_p90(from._internal_p90());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99 = from._internal_p99();
+  uint64_t raw_p99;
+  memcpy(&raw_p99, &tmp_p99, sizeof(tmp_p99));
+  if (raw_p99 != 0) {
+    _this->_internal_set_p99(from._internal_p99());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SignalStats::CopyFrom(const SignalStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SignalStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SignalStats::IsInitialized() const {
+  return true;
+}
+
+void SignalStats::InternalSwap(SignalStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SignalStats, _impl_.p99_)
+      + sizeof(SignalStats::_impl_.p99_)
+      - PROTOBUF_FIELD_OFFSET(SignalStats, _impl_.mean_)>(
+          reinterpret_cast<char*>(&_impl_.mean_),
+          reinterpret_cast<char*>(&other->_impl_.mean_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SignalStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_engine_5fdata_2eproto_getter, &descriptor_table_engine_5fdata_2eproto_once,
+      file_level_metadata_engine_5fdata_2eproto[4]);
+}
+
+// ===================================================================
+
+class WindowStats::_Internal {
+ public:
+  static const ::SignalStats& rpm(const WindowStats* msg);
+  static const ::SignalStats& temperature(const WindowStats* msg);
+  static const ::SignalStats& oil_pressure(const WindowStats* msg);
+  static const ::SignalStats& speed(const WindowStats* msg);
+};
+
+const ::SignalStats&
+WindowStats::_Internal::rpm(const WindowStats* msg) {
+  return *msg->_impl_.rpm_;
+}
+const ::SignalStats&
+WindowStats::_Internal::temperature(const WindowStats* msg) {
+  return *msg->_impl_.temperature_;
+}
+const ::SignalStats&
+WindowStats::_Internal::oil_pressure(const WindowStats* msg) {
+  return *msg->_impl_.oil_pressure_;
+}
+const ::SignalStats&
+WindowStats::_Internal::speed(const WindowStats* msg) {
+  return *msg->_impl_.speed_;
+}
+WindowStats::WindowStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WindowStats)
+}
+WindowStats::WindowStats(const WindowStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WindowStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rpm_){nullptr}
+    , decltype(_impl_.temperature_){nullptr}
+    , decltype(_impl_.oil_pressure_){nullptr}
+    , decltype(_impl_.speed_){nullptr}
+    , decltype(_impl_.window_ms_){}
+    , decltype(_impl_.count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_rpm()) {
+    _this->_impl_.rpm_ = new ::SignalStats(*from._impl_.rpm_);
+  }
+  if (from._internal_has_temperature()) {
+    _this->_impl_.temperature_ = new ::SignalStats(*from._impl_.temperature_);
+  }
+  if (from._internal_has_oil_pressure()) {
+    _this->_impl_.oil_pressure_ = new ::SignalStats(*from._impl_.oil_pressure_);
+  }
+  if (from._internal_has_speed()) {
+    _this->_impl_.speed_ = new ::SignalStats(*from._impl_.speed_);
+  }
+  ::memcpy(&_impl_.window_ms_, &from._impl_.window_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.window_ms_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:WindowStats)
+}
+
+inline void WindowStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rpm_){nullptr}
+    , decltype(_impl_.temperature_){nullptr}
+    , decltype(_impl_.oil_pressure_){nullptr}
+    , decltype(_impl_.speed_){nullptr}
+    , decltype(_impl_.window_ms_){0u}
+    , decltype(_impl_.count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WindowStats::~WindowStats() {
+  // @@protoc_insertion_point(destructor:WindowStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WindowStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.rpm_;
+  if (this != internal_default_instance()) delete _impl_.temperature_;
+  if (this != internal_default_instance()) delete _impl_.oil_pressure_;
+  if (this != internal_default_instance()) delete _impl_.speed_;
+}
+
+void WindowStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WindowStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:WindowStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.rpm_ != nullptr) {
+    delete _impl_.rpm_;
+  }
+  _impl_.rpm_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.temperature_ != nullptr) {
+    delete _impl_.temperature_;
+  }
+  _impl_.temperature_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.oil_pressure_ != nullptr) {
+    delete _impl_.oil_pressure_;
+  }
+  _impl_.oil_pressure_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.speed_ != nullptr) {
+    delete _impl_.speed_;
+  }
+  _impl_.speed_ = nullptr;
+  ::memset(&_impl_.window_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.count_) -
+      reinterpret_cast<char*>(&_impl_.window_ms_)) + sizeof(_impl_.count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WindowStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 window_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.window_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .SignalStats rpm = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rpm(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .SignalStats temperature = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_temperature(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .SignalStats oil_pressure = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_oil_pressure(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .SignalStats speed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_speed(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WindowStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WindowStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 window_ms = 1;
+  if (this->_internal_window_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_window_ms(), target);
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_count(), target);
+  }
+
+  // .SignalStats rpm = 3;
+  if (this->_internal_has_rpm()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::rpm(this),
+        _Internal::rpm(this).GetCachedSize(), target, stream);
+  }
+
+  // .SignalStats temperature = 4;
+  if (this->_internal_has_temperature()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::temperature(this),
+        _Internal::temperature(this).GetCachedSize(), target, stream);
+  }
+
+  // .SignalStats oil_pressure = 5;
+  if (this->_internal_has_oil_pressure()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::oil_pressure(this),
+        _Internal::oil_pressure(this).GetCachedSize(), target, stream);
+  }
+
+  // .SignalStats speed = 6;
+  if (this->_internal_has_speed()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::speed(this),
+        _Internal::speed(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WindowStats)
+  return target;
+}
+
+size_t WindowStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WindowStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .SignalStats rpm = 3;
+  if (this->_internal_has_rpm()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rpm_);
+  }
+
+  // .SignalStats temperature = 4;
+  if (this->_internal_has_temperature()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.temperature_);
+  }
+
+  // .SignalStats oil_pressure = 5;
+  if (this->_internal_has_oil_pressure()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.oil_pressure_);
+  }
+
+  // .SignalStats speed = 6;
+  if (this->_internal_has_speed()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.speed_);
+  }
+
+  // uint32 window_ms = 1;
+  if (this->_internal_window_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_window_ms());
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WindowStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WindowStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WindowStats::GetClassData() const { return &_class_data_; }
+
+
+void WindowStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WindowStats*>(&to_msg);
+  auto& from = static_cast<const WindowStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WindowStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_rpm()) {
+    _this->_internal_mutable_rpm()->::SignalStats::MergeFrom(
+        from._internal_rpm());
+  }
+  if (from._internal_has_temperature()) {
+    _this->_internal_mutable_temperature()->::SignalStats::MergeFrom(
+        from._internal_temperature());
+  }
+  if (from._internal_has_oil_pressure()) {
+    _this->_internal_mutable_oil_pressure()->::SignalStats::MergeFrom(
+        from._internal_oil_pressure());
+  }
+  if (from._internal_has_speed()) {
+    _this->_internal_mutable_speed()->::SignalStats::MergeFrom(
+        from._internal_speed());
+  }
+  if (from._internal_window_ms() != 0) {
+    _this->_internal_set_window_ms(from._internal_window_ms());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WindowStats::CopyFrom(const WindowStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WindowStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WindowStats::IsInitialized() const {
+  return true;
+}
+
+void WindowStats::InternalSwap(WindowStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WindowStats, _impl_.count_)
+      + sizeof(WindowStats::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(WindowStats, _impl_.rpm_)>(
+          reinterpret_cast<char*>(&_impl_.rpm_),
+          reinterpret_cast<char*>(&other->_impl_.rpm_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WindowStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_engine_5fdata_2eproto_getter, &descriptor_table_engine_5fdata_2eproto_once,
+      file_level_metadata_engine_5fdata_2eproto[5]);
+}
+
+// ===================================================================
+
+class Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Request>()._impl_._has_bits_);
+  static const ::ExportRequest& export_history(const Request* msg);
+  static void set_has_after_sequence(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::ExportRequest&
+Request::_Internal::export_history(const Request* msg) {
+  return *msg->_impl_.export_history_;
+}
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Request)
+}
+Request::Request(const Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.export_history_){nullptr}
+    , decltype(_impl_.include_stats_){}
+    , decltype(_impl_.subscribe_alerts_){}
+    , decltype(_impl_.wait_ms_){}
+    , decltype(_impl_.after_sequence_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_export_history()) {
+    _this->_impl_.export_history_ = new ::ExportRequest(*from._impl_.export_history_);
+  }
+  ::memcpy(&_impl_.include_stats_, &from._impl_.include_stats_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.after_sequence_) -
+    reinterpret_cast<char*>(&_impl_.include_stats_)) + sizeof(_impl_.after_sequence_));
+  // @@protoc_insertion_point(copy_constructor:Request)
+}
+
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.export_history_){nullptr}
+    , decltype(_impl_.include_stats_){false}
+    , decltype(_impl_.subscribe_alerts_){false}
+    , decltype(_impl_.wait_ms_){0u}
+    , decltype(_impl_.after_sequence_){uint64_t{0u}}
+  };
+}
+
+Request::~Request() {
+  // @@protoc_insertion_point(destructor:Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.export_history_;
+}
+
+void Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.export_history_ != nullptr) {
+    delete _impl_.export_history_;
+  }
+  _impl_.export_history_ = nullptr;
+  ::memset(&_impl_.include_stats_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.wait_ms_) -
+      reinterpret_cast<char*>(&_impl_.include_stats_)) + sizeof(_impl_.wait_ms_));
+  _impl_.after_sequence_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool include_stats = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.include_stats_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool subscribe_alerts = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.subscribe_alerts_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ExportRequest export_history = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_export_history(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 after_sequence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_after_sequence(&has_bits);
+          _impl_.after_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 wait_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.wait_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool include_stats = 1;
+  if (this->_internal_include_stats() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_include_stats(), target);
+  }
+
+  // bool subscribe_alerts = 2;
+  if (this->_internal_subscribe_alerts() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_subscribe_alerts(), target);
+  }
+
+  // .ExportRequest export_history = 3;
+  if (this->_internal_has_export_history()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::export_history(this),
+        _Internal::export_history(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 after_sequence = 4;
+  if (_internal_has_after_sequence()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_after_sequence(), target);
+  }
+
+  // uint32 wait_ms = 5;
+  if (this->_internal_wait_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_wait_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Request)
+  return target;
+}
+
+size_t Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .ExportRequest export_history = 3;
+  if (this->_internal_has_export_history()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.export_history_);
+  }
+
+  // bool include_stats = 1;
+  if (this->_internal_include_stats() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool subscribe_alerts = 2;
+  if (this->_internal_subscribe_alerts() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 wait_ms = 5;
+  if (this->_internal_wait_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_wait_ms());
+  }
+
+  // optional uint64 after_sequence = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_after_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Request::GetClassData() const { return &_class_data_; }
+
+
+void Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Request*>(&to_msg);
+  auto& from = static_cast<const Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_export_history()) {
+    _this->_internal_mutable_export_history()->::ExportRequest::MergeFrom(
+        from._internal_export_history());
+  }
+  if (from._internal_include_stats() != 0) {
+    _this->_internal_set_include_stats(from._internal_include_stats());
+  }
+  if (from._internal_subscribe_alerts() != 0) {
+    _this->_internal_set_subscribe_alerts(from._internal_subscribe_alerts());
+  }
+  if (from._internal_wait_ms() != 0) {
+    _this->_internal_set_wait_ms(from._internal_wait_ms());
+  }
+  if (from._internal_has_after_sequence()) {
+    _this->_internal_set_after_sequence(from._internal_after_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Request::CopyFrom(const Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Request::IsInitialized() const {
+  return true;
+}
+
+void Request::InternalSwap(Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Request, _impl_.after_sequence_)
+      + sizeof(Request::_impl_.after_sequence_)
+      - PROTOBUF_FIELD_OFFSET(Request, _impl_.export_history_)>(
+          reinterpret_cast<char*>(&_impl_.export_history_),
+          reinterpret_cast<char*>(&other->_impl_.export_history_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_engine_5fdata_2eproto_getter, &descriptor_table_engine_5fdata_2eproto_once,
+      file_level_metadata_engine_5fdata_2eproto[6]);
+}
+
+// ===================================================================
+
+class ExportRequest::_Internal {
+ public:
+};
+
+ExportRequest::ExportRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ExportRequest)
+}
+ExportRequest::ExportRequest(const ExportRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExportRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_ms_){}
+    , decltype(_impl_.to_ms_){}
+    , decltype(_impl_.step_ms_){}
+    , decltype(_impl_.format_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.from_ms_, &from._impl_.from_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.format_) -
+    reinterpret_cast<char*>(&_impl_.from_ms_)) + sizeof(_impl_.format_));
+  // @@protoc_insertion_point(copy_constructor:ExportRequest)
+}
+
+inline void ExportRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_ms_){int64_t{0}}
+    , decltype(_impl_.to_ms_){int64_t{0}}
+    , decltype(_impl_.step_ms_){int64_t{0}}
+    , decltype(_impl_.format_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ExportRequest::~ExportRequest() {
+  // @@protoc_insertion_point(destructor:ExportRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExportRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ExportRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExportRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ExportRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.from_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.format_) -
+      reinterpret_cast<char*>(&_impl_.from_ms_)) + sizeof(_impl_.format_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExportRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 from_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 to_ms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.to_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ExportRequest.Format format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::ExportRequest_Format>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 step_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.step_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExportRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ExportRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 from_ms = 1;
+  if (this->_internal_from_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_from_ms(), target);
+  }
+
+  // int64 to_ms = 2;
+  if (this->_internal_to_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_to_ms(), target);
+  }
+
+  // .ExportRequest.Format format = 3;
+  if (this->_internal_format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_format(), target);
+  }
+
+  // int64 step_ms = 4;
+  if (this->_internal_step_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_step_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ExportRequest)
+  return target;
+}
+
+size_t ExportRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ExportRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 from_ms = 1;
+  if (this->_internal_from_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_from_ms());
+  }
+
+  // int64 to_ms = 2;
+  if (this->_internal_to_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_to_ms());
+  }
+
+  // int64 step_ms = 4;
+  if (this->_internal_step_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_step_ms());
+  }
+
+  // .ExportRequest.Format format = 3;
+  if (this->_internal_format() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExportRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExportRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExportRequest::GetClassData() const { return &_class_data_; }
+
+
+void ExportRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExportRequest*>(&to_msg);
+  auto& from = static_cast<const ExportRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ExportRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_from_ms() != 0) {
+    _this->_internal_set_from_ms(from._internal_from_ms());
+  }
+  if (from._internal_to_ms() != 0) {
+    _this->_internal_set_to_ms(from._internal_to_ms());
+  }
+  if (from._internal_step_ms() != 0) {
+    _this->_internal_set_step_ms(from._internal_step_ms());
+  }
+  if (from._internal_format() != 0) {
+    _this->_internal_set_format(from._internal_format());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExportRequest::CopyFrom(const ExportRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ExportRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExportRequest::IsInitialized() const {
+  return true;
+}
+
+void ExportRequest::InternalSwap(ExportRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExportRequest, _impl_.format_)
+      + sizeof(ExportRequest::_impl_.format_)
+      - PROTOBUF_FIELD_OFFSET(ExportRequest, _impl_.from_ms_)>(
+          reinterpret_cast<char*>(&_impl_.from_ms_),
+          reinterpret_cast<char*>(&other->_impl_.from_ms_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExportRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_engine_5fdata_2eproto_getter, &descriptor_table_engine_5fdata_2eproto_once,
+      file_level_metadata_engine_5fdata_2eproto[7]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::EngineData*
+Arena::CreateMaybeMessage< ::EngineData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::EngineData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PipelineStage*
+Arena::CreateMaybeMessage< ::PipelineStage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PipelineStage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ExportChunk*
+Arena::CreateMaybeMessage< ::ExportChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ExportChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Alert*
+Arena::CreateMaybeMessage< ::Alert >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Alert >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SignalStats*
+Arena::CreateMaybeMessage< ::SignalStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SignalStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WindowStats*
+Arena::CreateMaybeMessage< ::WindowStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WindowStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Request*
+Arena::CreateMaybeMessage< ::Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ExportRequest*
+Arena::CreateMaybeMessage< ::ExportRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ExportRequest >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
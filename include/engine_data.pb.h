@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -44,13 +45,66 @@ struct TableStruct_engine_5fdata_2eproto {
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_engine_5fdata_2eproto;
+class Alert;
+struct AlertDefaultTypeInternal;
+extern AlertDefaultTypeInternal _Alert_default_instance_;
 class EngineData;
 struct EngineDataDefaultTypeInternal;
 extern EngineDataDefaultTypeInternal _EngineData_default_instance_;
+class ExportChunk;
+struct ExportChunkDefaultTypeInternal;
+extern ExportChunkDefaultTypeInternal _ExportChunk_default_instance_;
+class ExportRequest;
+struct ExportRequestDefaultTypeInternal;
+extern ExportRequestDefaultTypeInternal _ExportRequest_default_instance_;
+class PipelineStage;
+struct PipelineStageDefaultTypeInternal;
+extern PipelineStageDefaultTypeInternal _PipelineStage_default_instance_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+class SignalStats;
+struct SignalStatsDefaultTypeInternal;
+extern SignalStatsDefaultTypeInternal _SignalStats_default_instance_;
+class WindowStats;
+struct WindowStatsDefaultTypeInternal;
+extern WindowStatsDefaultTypeInternal _WindowStats_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
+template<> ::Alert* Arena::CreateMaybeMessage<::Alert>(Arena*);
 template<> ::EngineData* Arena::CreateMaybeMessage<::EngineData>(Arena*);
+template<> ::ExportChunk* Arena::CreateMaybeMessage<::ExportChunk>(Arena*);
+template<> ::ExportRequest* Arena::CreateMaybeMessage<::ExportRequest>(Arena*);
+template<> ::PipelineStage* Arena::CreateMaybeMessage<::PipelineStage>(Arena*);
+template<> ::Request* Arena::CreateMaybeMessage<::Request>(Arena*);
+template<> ::SignalStats* Arena::CreateMaybeMessage<::SignalStats>(Arena*);
+template<> ::WindowStats* Arena::CreateMaybeMessage<::WindowStats>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 
+enum ExportRequest_Format : int {
+  ExportRequest_Format_CSV = 0,
+  ExportRequest_Format_BINARY = 1,
+  ExportRequest_Format_ExportRequest_Format_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ExportRequest_Format_ExportRequest_Format_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ExportRequest_Format_IsValid(int value);
+constexpr ExportRequest_Format ExportRequest_Format_Format_MIN = ExportRequest_Format_CSV;
+constexpr ExportRequest_Format ExportRequest_Format_Format_MAX = ExportRequest_Format_BINARY;
+constexpr int ExportRequest_Format_Format_ARRAYSIZE = ExportRequest_Format_Format_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExportRequest_Format_descriptor();
+template<typename T>
+inline const std::string& ExportRequest_Format_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ExportRequest_Format>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ExportRequest_Format_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ExportRequest_Format_descriptor(), enum_t_value);
+}
+inline bool ExportRequest_Format_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ExportRequest_Format* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ExportRequest_Format>(
+    ExportRequest_Format_descriptor(), name, value);
+}
 // ===================================================================
 
 class EngineData final :
@@ -174,12 +228,117 @@ class EngineData final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kWindowsFieldNumber = 7,
+    kAlertsFieldNumber = 8,
+    kFieldTimestampMsFieldNumber = 10,
+    kPipelineFieldNumber = 11,
+    kExportChunkFieldNumber = 9,
     kRpmFieldNumber = 1,
     kTemperatureFieldNumber = 2,
     kOilPressureFieldNumber = 3,
     kSpeedFieldNumber = 4,
+    kSequenceFieldNumber = 5,
+    kTimestampMsFieldNumber = 6,
   };
-  // int32 rpm = 1;
+  // repeated .WindowStats windows = 7;
+  int windows_size() const;
+  private:
+  int _internal_windows_size() const;
+  public:
+  void clear_windows();
+  ::WindowStats* mutable_windows(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WindowStats >*
+      mutable_windows();
+  private:
+  const ::WindowStats& _internal_windows(int index) const;
+  ::WindowStats* _internal_add_windows();
+  public:
+  const ::WindowStats& windows(int index) const;
+  ::WindowStats* add_windows();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WindowStats >&
+      windows() const;
+
+  // repeated .Alert alerts = 8;
+  int alerts_size() const;
+  private:
+  int _internal_alerts_size() const;
+  public:
+  void clear_alerts();
+  ::Alert* mutable_alerts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Alert >*
+      mutable_alerts();
+  private:
+  const ::Alert& _internal_alerts(int index) const;
+  ::Alert* _internal_add_alerts();
+  public:
+  const ::Alert& alerts(int index) const;
+  ::Alert* add_alerts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Alert >&
+      alerts() const;
+
+  // repeated int64 field_timestamp_ms = 10;
+  int field_timestamp_ms_size() const;
+  private:
+  int _internal_field_timestamp_ms_size() const;
+  public:
+  void clear_field_timestamp_ms();
+  private:
+  int64_t _internal_field_timestamp_ms(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_field_timestamp_ms() const;
+  void _internal_add_field_timestamp_ms(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_field_timestamp_ms();
+  public:
+  int64_t field_timestamp_ms(int index) const;
+  void set_field_timestamp_ms(int index, int64_t value);
+  void add_field_timestamp_ms(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      field_timestamp_ms() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_field_timestamp_ms();
+
+  // repeated .PipelineStage pipeline = 11;
+  int pipeline_size() const;
+  private:
+  int _internal_pipeline_size() const;
+  public:
+  void clear_pipeline();
+  ::PipelineStage* mutable_pipeline(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PipelineStage >*
+      mutable_pipeline();
+  private:
+  const ::PipelineStage& _internal_pipeline(int index) const;
+  ::PipelineStage* _internal_add_pipeline();
+  public:
+  const ::PipelineStage& pipeline(int index) const;
+  ::PipelineStage* add_pipeline();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PipelineStage >&
+      pipeline() const;
+
+  // .ExportChunk export_chunk = 9;
+  bool has_export_chunk() const;
+  private:
+  bool _internal_has_export_chunk() const;
+  public:
+  void clear_export_chunk();
+  const ::ExportChunk& export_chunk() const;
+  PROTOBUF_NODISCARD ::ExportChunk* release_export_chunk();
+  ::ExportChunk* mutable_export_chunk();
+  void set_allocated_export_chunk(::ExportChunk* export_chunk);
+  private:
+  const ::ExportChunk& _internal_export_chunk() const;
+  ::ExportChunk* _internal_mutable_export_chunk();
+  public:
+  void unsafe_arena_set_allocated_export_chunk(
+      ::ExportChunk* export_chunk);
+  ::ExportChunk* unsafe_arena_release_export_chunk();
+
+  // optional int32 rpm = 1;
+  bool has_rpm() const;
+  private:
+  bool _internal_has_rpm() const;
+  public:
   void clear_rpm();
   int32_t rpm() const;
   void set_rpm(int32_t value);
@@ -188,7 +347,11 @@ class EngineData final :
   void _internal_set_rpm(int32_t value);
   public:
 
-  // int32 temperature = 2;
+  // optional int32 temperature = 2;
+  bool has_temperature() const;
+  private:
+  bool _internal_has_temperature() const;
+  public:
   void clear_temperature();
   int32_t temperature() const;
   void set_temperature(int32_t value);
@@ -197,7 +360,11 @@ class EngineData final :
   void _internal_set_temperature(int32_t value);
   public:
 
-  // int32 oil_pressure = 3;
+  // optional int32 oil_pressure = 3;
+  bool has_oil_pressure() const;
+  private:
+  bool _internal_has_oil_pressure() const;
+  public:
   void clear_oil_pressure();
   int32_t oil_pressure() const;
   void set_oil_pressure(int32_t value);
@@ -206,7 +373,11 @@ class EngineData final :
   void _internal_set_oil_pressure(int32_t value);
   public:
 
-  // int32 speed = 4;
+  // optional int32 speed = 4;
+  bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
   void clear_speed();
   int32_t speed() const;
   void set_speed(int32_t value);
@@ -215,6 +386,24 @@ class EngineData final :
   void _internal_set_speed(int32_t value);
   public:
 
+  // uint64 sequence = 5;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // int64 timestamp_ms = 6;
+  void clear_timestamp_ms();
+  int64_t timestamp_ms() const;
+  void set_timestamp_ms(int64_t value);
+  private:
+  int64_t _internal_timestamp_ms() const;
+  void _internal_set_timestamp_ms(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:EngineData)
  private:
   class _Internal;
@@ -223,112 +412,3120 @@ class EngineData final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WindowStats > windows_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Alert > alerts_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > field_timestamp_ms_;
+    mutable std::atomic<int> _field_timestamp_ms_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PipelineStage > pipeline_;
+    ::ExportChunk* export_chunk_;
     int32_t rpm_;
     int32_t temperature_;
     int32_t oil_pressure_;
     int32_t speed_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t sequence_;
+    int64_t timestamp_ms_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_engine_5fdata_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class PipelineStage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PipelineStage) */ {
+ public:
+  inline PipelineStage() : PipelineStage(nullptr) {}
+  ~PipelineStage() override;
+  explicit PROTOBUF_CONSTEXPR PipelineStage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  PipelineStage(const PipelineStage& from);
+  PipelineStage(PipelineStage&& from) noexcept
+    : PipelineStage() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// EngineData
+  inline PipelineStage& operator=(const PipelineStage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PipelineStage& operator=(PipelineStage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// int32 rpm = 1;
-inline void EngineData::clear_rpm() {
-  _impl_.rpm_ = 0;
-}
-inline int32_t EngineData::_internal_rpm() const {
-  return _impl_.rpm_;
-}
-inline int32_t EngineData::rpm() const {
-  // @@protoc_insertion_point(field_get:EngineData.rpm)
-  return _internal_rpm();
-}
-inline void EngineData::_internal_set_rpm(int32_t value) {
-  
-  _impl_.rpm_ = value;
-}
-inline void EngineData::set_rpm(int32_t value) {
-  _internal_set_rpm(value);
-  // @@protoc_insertion_point(field_set:EngineData.rpm)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PipelineStage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PipelineStage* internal_default_instance() {
+    return reinterpret_cast<const PipelineStage*>(
+               &_PipelineStage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-// int32 temperature = 2;
-inline void EngineData::clear_temperature() {
-  _impl_.temperature_ = 0;
-}
-inline int32_t EngineData::_internal_temperature() const {
-  return _impl_.temperature_;
-}
-inline int32_t EngineData::temperature() const {
-  // @@protoc_insertion_point(field_get:EngineData.temperature)
-  return _internal_temperature();
-}
-inline void EngineData::_internal_set_temperature(int32_t value) {
-  
-  _impl_.temperature_ = value;
-}
-inline void EngineData::set_temperature(int32_t value) {
-  _internal_set_temperature(value);
-  // @@protoc_insertion_point(field_set:EngineData.temperature)
-}
+  friend void swap(PipelineStage& a, PipelineStage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PipelineStage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PipelineStage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// int32 oil_pressure = 3;
-inline void EngineData::clear_oil_pressure() {
-  _impl_.oil_pressure_ = 0;
-}
-inline int32_t EngineData::_internal_oil_pressure() const {
-  return _impl_.oil_pressure_;
-}
-inline int32_t EngineData::oil_pressure() const {
-  // @@protoc_insertion_point(field_get:EngineData.oil_pressure)
-  return _internal_oil_pressure();
-}
-inline void EngineData::_internal_set_oil_pressure(int32_t value) {
-  
-  _impl_.oil_pressure_ = value;
-}
-inline void EngineData::set_oil_pressure(int32_t value) {
-  _internal_set_oil_pressure(value);
-  // @@protoc_insertion_point(field_set:EngineData.oil_pressure)
-}
+  // implements Message ----------------------------------------------
 
-// int32 speed = 4;
-inline void EngineData::clear_speed() {
-  _impl_.speed_ = 0;
-}
-inline int32_t EngineData::_internal_speed() const {
-  return _impl_.speed_;
-}
-inline int32_t EngineData::speed() const {
-  // @@protoc_insertion_point(field_get:EngineData.speed)
-  return _internal_speed();
-}
-inline void EngineData::_internal_set_speed(int32_t value) {
-  
-  _impl_.speed_ = value;
-}
-inline void EngineData::set_speed(int32_t value) {
-  _internal_set_speed(value);
-  // @@protoc_insertion_point(field_set:EngineData.speed)
-}
+  PipelineStage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PipelineStage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PipelineStage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PipelineStage& from) {
+    PipelineStage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// @@protoc_insertion_point(namespace_scope)
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PipelineStage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PipelineStage";
+  }
+  protected:
+  explicit PipelineStage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kDepthFieldNumber = 2,
+    kCapacityFieldNumber = 3,
+    kProcessedFieldNumber = 5,
+    kDroppedFieldNumber = 6,
+    kMeanLatencyUsFieldNumber = 7,
+    kMaxLatencyUsFieldNumber = 8,
+    kHighWaterFieldNumber = 4,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint32 depth = 2;
+  void clear_depth();
+  uint32_t depth() const;
+  void set_depth(uint32_t value);
+  private:
+  uint32_t _internal_depth() const;
+  void _internal_set_depth(uint32_t value);
+  public:
+
+  // uint32 capacity = 3;
+  void clear_capacity();
+  uint32_t capacity() const;
+  void set_capacity(uint32_t value);
+  private:
+  uint32_t _internal_capacity() const;
+  void _internal_set_capacity(uint32_t value);
+  public:
 
+  // uint64 processed = 5;
+  void clear_processed();
+  uint64_t processed() const;
+  void set_processed(uint64_t value);
+  private:
+  uint64_t _internal_processed() const;
+  void _internal_set_processed(uint64_t value);
+  public:
+
+  // uint64 dropped = 6;
+  void clear_dropped();
+  uint64_t dropped() const;
+  void set_dropped(uint64_t value);
+  private:
+  uint64_t _internal_dropped() const;
+  void _internal_set_dropped(uint64_t value);
+  public:
+
+  // double mean_latency_us = 7;
+  void clear_mean_latency_us();
+  double mean_latency_us() const;
+  void set_mean_latency_us(double value);
+  private:
+  double _internal_mean_latency_us() const;
+  void _internal_set_mean_latency_us(double value);
+  public:
+
+  // double max_latency_us = 8;
+  void clear_max_latency_us();
+  double max_latency_us() const;
+  void set_max_latency_us(double value);
+  private:
+  double _internal_max_latency_us() const;
+  void _internal_set_max_latency_us(double value);
+  public:
+
+  // uint32 high_water = 4;
+  void clear_high_water();
+  uint32_t high_water() const;
+  void set_high_water(uint32_t value);
+  private:
+  uint32_t _internal_high_water() const;
+  void _internal_set_high_water(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PipelineStage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t depth_;
+    uint32_t capacity_;
+    uint64_t processed_;
+    uint64_t dropped_;
+    double mean_latency_us_;
+    double max_latency_us_;
+    uint32_t high_water_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_engine_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExportChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ExportChunk) */ {
+ public:
+  inline ExportChunk() : ExportChunk(nullptr) {}
+  ~ExportChunk() override;
+  explicit PROTOBUF_CONSTEXPR ExportChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExportChunk(const ExportChunk& from);
+  ExportChunk(ExportChunk&& from) noexcept
+    : ExportChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline ExportChunk& operator=(const ExportChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExportChunk& operator=(ExportChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExportChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExportChunk* internal_default_instance() {
+    return reinterpret_cast<const ExportChunk*>(
+               &_ExportChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ExportChunk& a, ExportChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExportChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExportChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExportChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExportChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExportChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExportChunk& from) {
+    ExportChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExportChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ExportChunk";
+  }
+  protected:
+  explicit ExportChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+    kLastFieldNumber = 2,
+    kFailedFieldNumber = 3,
+  };
+  // bytes data = 1;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // bool last = 2;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // bool failed = 3;
+  void clear_failed();
+  bool failed() const;
+  void set_failed(bool value);
+  private:
+  bool _internal_failed() const;
+  void _internal_set_failed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ExportChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    bool last_;
+    bool failed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_engine_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Alert final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Alert) */ {
+ public:
+  inline Alert() : Alert(nullptr) {}
+  ~Alert() override;
+  explicit PROTOBUF_CONSTEXPR Alert(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Alert(const Alert& from);
+  Alert(Alert&& from) noexcept
+    : Alert() {
+    *this = ::std::move(from);
+  }
+
+  inline Alert& operator=(const Alert& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Alert& operator=(Alert&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Alert& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Alert* internal_default_instance() {
+    return reinterpret_cast<const Alert*>(
+               &_Alert_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Alert& a, Alert& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Alert* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Alert* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Alert* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Alert>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Alert& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Alert& from) {
+    Alert::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Alert* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Alert";
+  }
+  protected:
+  explicit Alert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRuleFieldNumber = 1,
+    kRaisedFieldNumber = 2,
+  };
+  // string rule = 1;
+  void clear_rule();
+  const std::string& rule() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rule(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rule();
+  PROTOBUF_NODISCARD std::string* release_rule();
+  void set_allocated_rule(std::string* rule);
+  private:
+  const std::string& _internal_rule() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rule(const std::string& value);
+  std::string* _internal_mutable_rule();
+  public:
+
+  // bool raised = 2;
+  void clear_raised();
+  bool raised() const;
+  void set_raised(bool value);
+  private:
+  bool _internal_raised() const;
+  void _internal_set_raised(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Alert)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rule_;
+    bool raised_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_engine_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SignalStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SignalStats) */ {
+ public:
+  inline SignalStats() : SignalStats(nullptr) {}
+  ~SignalStats() override;
+  explicit PROTOBUF_CONSTEXPR SignalStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SignalStats(const SignalStats& from);
+  SignalStats(SignalStats&& from) noexcept
+    : SignalStats() {
+    *this = ::std::move(from);
+  }
+
+  inline SignalStats& operator=(const SignalStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SignalStats& operator=(SignalStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SignalStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SignalStats* internal_default_instance() {
+    return reinterpret_cast<const SignalStats*>(
+               &_SignalStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SignalStats& a, SignalStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SignalStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SignalStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SignalStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SignalStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SignalStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SignalStats& from) {
+    SignalStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SignalStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SignalStats";
+  }
+  protected:
+  explicit SignalStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMeanFieldNumber = 1,
+    kMinFieldNumber = 2,
+    kMaxFieldNumber = 3,
+    kRatePerSFieldNumber = 4,
+    kEwmaFieldNumber = 5,
+    kP50FieldNumber = 6,
+    kP90FieldNumber = 7,
+    kP99FieldNumber = 8,
+  };
+  // double mean = 1;
+  void clear_mean();
+  double mean() const;
+  void set_mean(double value);
+  private:
+  double _internal_mean() const;
+  void _internal_set_mean(double value);
+  public:
+
+  // int32 min = 2;
+  void clear_min();
+  int32_t min() const;
+  void set_min(int32_t value);
+  private:
+  int32_t _internal_min() const;
+  void _internal_set_min(int32_t value);
+  public:
+
+  // int32 max = 3;
+  void clear_max();
+  int32_t max() const;
+  void set_max(int32_t value);
+  private:
+  int32_t _internal_max() const;
+  void _internal_set_max(int32_t value);
+  public:
+
+  // double rate_per_s = 4;
+  void clear_rate_per_s();
+  double rate_per_s() const;
+  void set_rate_per_s(double value);
+  private:
+  double _internal_rate_per_s() const;
+  void _internal_set_rate_per_s(double value);
+  public:
+
+  // double ewma = 5;
+  void clear_ewma();
+  double ewma() const;
+  void set_ewma(double value);
+  private:
+  double _internal_ewma() const;
+  void _internal_set_ewma(double value);
+  public:
+
+  // double p50 = 6;
+  void clear_p50();
+  double p50() const;
+  void set_p50(double value);
+  private:
+  double _internal_p50() const;
+  void _internal_set_p50(double value);
+  public:
+
+  // double p90 = 7;
+  void clear_p90();
+  double p90() const;
+  void set_p90(double value);
+  private:
+  double _internal_p90() const;
+  void _internal_set_p90(double value);
+  public:
+
+  // double p99 = 8;
+  void clear_p99();
+  double p99() const;
+  void set_p99(double value);
+  private:
+  double _internal_p99() const;
+  void _internal_set_p99(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SignalStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double mean_;
+    int32_t min_;
+    int32_t max_;
+    double rate_per_s_;
+    double ewma_;
+    double p50_;
+    double p90_;
+    double p99_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_engine_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WindowStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WindowStats) */ {
+ public:
+  inline WindowStats() : WindowStats(nullptr) {}
+  ~WindowStats() override;
+  explicit PROTOBUF_CONSTEXPR WindowStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WindowStats(const WindowStats& from);
+  WindowStats(WindowStats&& from) noexcept
+    : WindowStats() {
+    *this = ::std::move(from);
+  }
+
+  inline WindowStats& operator=(const WindowStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WindowStats& operator=(WindowStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WindowStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WindowStats* internal_default_instance() {
+    return reinterpret_cast<const WindowStats*>(
+               &_WindowStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(WindowStats& a, WindowStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WindowStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WindowStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WindowStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WindowStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WindowStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WindowStats& from) {
+    WindowStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WindowStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WindowStats";
+  }
+  protected:
+  explicit WindowStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRpmFieldNumber = 3,
+    kTemperatureFieldNumber = 4,
+    kOilPressureFieldNumber = 5,
+    kSpeedFieldNumber = 6,
+    kWindowMsFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // .SignalStats rpm = 3;
+  bool has_rpm() const;
+  private:
+  bool _internal_has_rpm() const;
+  public:
+  void clear_rpm();
+  const ::SignalStats& rpm() const;
+  PROTOBUF_NODISCARD ::SignalStats* release_rpm();
+  ::SignalStats* mutable_rpm();
+  void set_allocated_rpm(::SignalStats* rpm);
+  private:
+  const ::SignalStats& _internal_rpm() const;
+  ::SignalStats* _internal_mutable_rpm();
+  public:
+  void unsafe_arena_set_allocated_rpm(
+      ::SignalStats* rpm);
+  ::SignalStats* unsafe_arena_release_rpm();
+
+  // .SignalStats temperature = 4;
+  bool has_temperature() const;
+  private:
+  bool _internal_has_temperature() const;
+  public:
+  void clear_temperature();
+  const ::SignalStats& temperature() const;
+  PROTOBUF_NODISCARD ::SignalStats* release_temperature();
+  ::SignalStats* mutable_temperature();
+  void set_allocated_temperature(::SignalStats* temperature);
+  private:
+  const ::SignalStats& _internal_temperature() const;
+  ::SignalStats* _internal_mutable_temperature();
+  public:
+  void unsafe_arena_set_allocated_temperature(
+      ::SignalStats* temperature);
+  ::SignalStats* unsafe_arena_release_temperature();
+
+  // .SignalStats oil_pressure = 5;
+  bool has_oil_pressure() const;
+  private:
+  bool _internal_has_oil_pressure() const;
+  public:
+  void clear_oil_pressure();
+  const ::SignalStats& oil_pressure() const;
+  PROTOBUF_NODISCARD ::SignalStats* release_oil_pressure();
+  ::SignalStats* mutable_oil_pressure();
+  void set_allocated_oil_pressure(::SignalStats* oil_pressure);
+  private:
+  const ::SignalStats& _internal_oil_pressure() const;
+  ::SignalStats* _internal_mutable_oil_pressure();
+  public:
+  void unsafe_arena_set_allocated_oil_pressure(
+      ::SignalStats* oil_pressure);
+  ::SignalStats* unsafe_arena_release_oil_pressure();
+
+  // .SignalStats speed = 6;
+  bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
+  void clear_speed();
+  const ::SignalStats& speed() const;
+  PROTOBUF_NODISCARD ::SignalStats* release_speed();
+  ::SignalStats* mutable_speed();
+  void set_allocated_speed(::SignalStats* speed);
+  private:
+  const ::SignalStats& _internal_speed() const;
+  ::SignalStats* _internal_mutable_speed();
+  public:
+  void unsafe_arena_set_allocated_speed(
+      ::SignalStats* speed);
+  ::SignalStats* unsafe_arena_release_speed();
+
+  // uint32 window_ms = 1;
+  void clear_window_ms();
+  uint32_t window_ms() const;
+  void set_window_ms(uint32_t value);
+  private:
+  uint32_t _internal_window_ms() const;
+  void _internal_set_window_ms(uint32_t value);
+  public:
+
+  // uint32 count = 2;
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:WindowStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::SignalStats* rpm_;
+    ::SignalStats* temperature_;
+    ::SignalStats* oil_pressure_;
+    ::SignalStats* speed_;
+    uint32_t window_ms_;
+    uint32_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_engine_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExportHistoryFieldNumber = 3,
+    kIncludeStatsFieldNumber = 1,
+    kSubscribeAlertsFieldNumber = 2,
+    kWaitMsFieldNumber = 5,
+    kAfterSequenceFieldNumber = 4,
+  };
+  // .ExportRequest export_history = 3;
+  bool has_export_history() const;
+  private:
+  bool _internal_has_export_history() const;
+  public:
+  void clear_export_history();
+  const ::ExportRequest& export_history() const;
+  PROTOBUF_NODISCARD ::ExportRequest* release_export_history();
+  ::ExportRequest* mutable_export_history();
+  void set_allocated_export_history(::ExportRequest* export_history);
+  private:
+  const ::ExportRequest& _internal_export_history() const;
+  ::ExportRequest* _internal_mutable_export_history();
+  public:
+  void unsafe_arena_set_allocated_export_history(
+      ::ExportRequest* export_history);
+  ::ExportRequest* unsafe_arena_release_export_history();
+
+  // bool include_stats = 1;
+  void clear_include_stats();
+  bool include_stats() const;
+  void set_include_stats(bool value);
+  private:
+  bool _internal_include_stats() const;
+  void _internal_set_include_stats(bool value);
+  public:
+
+  // bool subscribe_alerts = 2;
+  void clear_subscribe_alerts();
+  bool subscribe_alerts() const;
+  void set_subscribe_alerts(bool value);
+  private:
+  bool _internal_subscribe_alerts() const;
+  void _internal_set_subscribe_alerts(bool value);
+  public:
+
+  // uint32 wait_ms = 5;
+  void clear_wait_ms();
+  uint32_t wait_ms() const;
+  void set_wait_ms(uint32_t value);
+  private:
+  uint32_t _internal_wait_ms() const;
+  void _internal_set_wait_ms(uint32_t value);
+  public:
+
+  // optional uint64 after_sequence = 4;
+  bool has_after_sequence() const;
+  private:
+  bool _internal_has_after_sequence() const;
+  public:
+  void clear_after_sequence();
+  uint64_t after_sequence() const;
+  void set_after_sequence(uint64_t value);
+  private:
+  uint64_t _internal_after_sequence() const;
+  void _internal_set_after_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ExportRequest* export_history_;
+    bool include_stats_;
+    bool subscribe_alerts_;
+    uint32_t wait_ms_;
+    uint64_t after_sequence_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_engine_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExportRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ExportRequest) */ {
+ public:
+  inline ExportRequest() : ExportRequest(nullptr) {}
+  ~ExportRequest() override;
+  explicit PROTOBUF_CONSTEXPR ExportRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExportRequest(const ExportRequest& from);
+  ExportRequest(ExportRequest&& from) noexcept
+    : ExportRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ExportRequest& operator=(const ExportRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExportRequest& operator=(ExportRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExportRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExportRequest* internal_default_instance() {
+    return reinterpret_cast<const ExportRequest*>(
+               &_ExportRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ExportRequest& a, ExportRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExportRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExportRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExportRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExportRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExportRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExportRequest& from) {
+    ExportRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExportRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ExportRequest";
+  }
+  protected:
+  explicit ExportRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ExportRequest_Format Format;
+  static constexpr Format CSV =
+    ExportRequest_Format_CSV;
+  static constexpr Format BINARY =
+    ExportRequest_Format_BINARY;
+  static inline bool Format_IsValid(int value) {
+    return ExportRequest_Format_IsValid(value);
+  }
+  static constexpr Format Format_MIN =
+    ExportRequest_Format_Format_MIN;
+  static constexpr Format Format_MAX =
+    ExportRequest_Format_Format_MAX;
+  static constexpr int Format_ARRAYSIZE =
+    ExportRequest_Format_Format_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Format_descriptor() {
+    return ExportRequest_Format_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Format_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Format>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Format_Name.");
+    return ExportRequest_Format_Name(enum_t_value);
+  }
+  static inline bool Format_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Format* value) {
+    return ExportRequest_Format_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFromMsFieldNumber = 1,
+    kToMsFieldNumber = 2,
+    kStepMsFieldNumber = 4,
+    kFormatFieldNumber = 3,
+  };
+  // int64 from_ms = 1;
+  void clear_from_ms();
+  int64_t from_ms() const;
+  void set_from_ms(int64_t value);
+  private:
+  int64_t _internal_from_ms() const;
+  void _internal_set_from_ms(int64_t value);
+  public:
+
+  // int64 to_ms = 2;
+  void clear_to_ms();
+  int64_t to_ms() const;
+  void set_to_ms(int64_t value);
+  private:
+  int64_t _internal_to_ms() const;
+  void _internal_set_to_ms(int64_t value);
+  public:
+
+  // int64 step_ms = 4;
+  void clear_step_ms();
+  int64_t step_ms() const;
+  void set_step_ms(int64_t value);
+  private:
+  int64_t _internal_step_ms() const;
+  void _internal_set_step_ms(int64_t value);
+  public:
+
+  // .ExportRequest.Format format = 3;
+  void clear_format();
+  ::ExportRequest_Format format() const;
+  void set_format(::ExportRequest_Format value);
+  private:
+  ::ExportRequest_Format _internal_format() const;
+  void _internal_set_format(::ExportRequest_Format value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ExportRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t from_ms_;
+    int64_t to_ms_;
+    int64_t step_ms_;
+    int format_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_engine_5fdata_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// EngineData
+
+// optional int32 rpm = 1;
+inline bool EngineData::_internal_has_rpm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EngineData::has_rpm() const {
+  return _internal_has_rpm();
+}
+inline void EngineData::clear_rpm() {
+  _impl_.rpm_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t EngineData::_internal_rpm() const {
+  return _impl_.rpm_;
+}
+inline int32_t EngineData::rpm() const {
+  // @@protoc_insertion_point(field_get:EngineData.rpm)
+  return _internal_rpm();
+}
+inline void EngineData::_internal_set_rpm(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.rpm_ = value;
+}
+inline void EngineData::set_rpm(int32_t value) {
+  _internal_set_rpm(value);
+  // @@protoc_insertion_point(field_set:EngineData.rpm)
+}
+
+// optional int32 temperature = 2;
+inline bool EngineData::_internal_has_temperature() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EngineData::has_temperature() const {
+  return _internal_has_temperature();
+}
+inline void EngineData::clear_temperature() {
+  _impl_.temperature_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t EngineData::_internal_temperature() const {
+  return _impl_.temperature_;
+}
+inline int32_t EngineData::temperature() const {
+  // @@protoc_insertion_point(field_get:EngineData.temperature)
+  return _internal_temperature();
+}
+inline void EngineData::_internal_set_temperature(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.temperature_ = value;
+}
+inline void EngineData::set_temperature(int32_t value) {
+  _internal_set_temperature(value);
+  // @@protoc_insertion_point(field_set:EngineData.temperature)
+}
+
+// optional int32 oil_pressure = 3;
+inline bool EngineData::_internal_has_oil_pressure() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool EngineData::has_oil_pressure() const {
+  return _internal_has_oil_pressure();
+}
+inline void EngineData::clear_oil_pressure() {
+  _impl_.oil_pressure_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t EngineData::_internal_oil_pressure() const {
+  return _impl_.oil_pressure_;
+}
+inline int32_t EngineData::oil_pressure() const {
+  // @@protoc_insertion_point(field_get:EngineData.oil_pressure)
+  return _internal_oil_pressure();
+}
+inline void EngineData::_internal_set_oil_pressure(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.oil_pressure_ = value;
+}
+inline void EngineData::set_oil_pressure(int32_t value) {
+  _internal_set_oil_pressure(value);
+  // @@protoc_insertion_point(field_set:EngineData.oil_pressure)
+}
+
+// optional int32 speed = 4;
+inline bool EngineData::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool EngineData::has_speed() const {
+  return _internal_has_speed();
+}
+inline void EngineData::clear_speed() {
+  _impl_.speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t EngineData::_internal_speed() const {
+  return _impl_.speed_;
+}
+inline int32_t EngineData::speed() const {
+  // @@protoc_insertion_point(field_get:EngineData.speed)
+  return _internal_speed();
+}
+inline void EngineData::_internal_set_speed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.speed_ = value;
+}
+inline void EngineData::set_speed(int32_t value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:EngineData.speed)
+}
+
+// uint64 sequence = 5;
+inline void EngineData::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t EngineData::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t EngineData::sequence() const {
+  // @@protoc_insertion_point(field_get:EngineData.sequence)
+  return _internal_sequence();
+}
+inline void EngineData::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void EngineData::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:EngineData.sequence)
+}
+
+// int64 timestamp_ms = 6;
+inline void EngineData::clear_timestamp_ms() {
+  _impl_.timestamp_ms_ = int64_t{0};
+}
+inline int64_t EngineData::_internal_timestamp_ms() const {
+  return _impl_.timestamp_ms_;
+}
+inline int64_t EngineData::timestamp_ms() const {
+  // @@protoc_insertion_point(field_get:EngineData.timestamp_ms)
+  return _internal_timestamp_ms();
+}
+inline void EngineData::_internal_set_timestamp_ms(int64_t value) {
+  
+  _impl_.timestamp_ms_ = value;
+}
+inline void EngineData::set_timestamp_ms(int64_t value) {
+  _internal_set_timestamp_ms(value);
+  // @@protoc_insertion_point(field_set:EngineData.timestamp_ms)
+}
+
+// repeated .WindowStats windows = 7;
+inline int EngineData::_internal_windows_size() const {
+  return _impl_.windows_.size();
+}
+inline int EngineData::windows_size() const {
+  return _internal_windows_size();
+}
+inline void EngineData::clear_windows() {
+  _impl_.windows_.Clear();
+}
+inline ::WindowStats* EngineData::mutable_windows(int index) {
+  // @@protoc_insertion_point(field_mutable:EngineData.windows)
+  return _impl_.windows_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WindowStats >*
+EngineData::mutable_windows() {
+  // @@protoc_insertion_point(field_mutable_list:EngineData.windows)
+  return &_impl_.windows_;
+}
+inline const ::WindowStats& EngineData::_internal_windows(int index) const {
+  return _impl_.windows_.Get(index);
+}
+inline const ::WindowStats& EngineData::windows(int index) const {
+  // @@protoc_insertion_point(field_get:EngineData.windows)
+  return _internal_windows(index);
+}
+inline ::WindowStats* EngineData::_internal_add_windows() {
+  return _impl_.windows_.Add();
+}
+inline ::WindowStats* EngineData::add_windows() {
+  ::WindowStats* _add = _internal_add_windows();
+  // @@protoc_insertion_point(field_add:EngineData.windows)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WindowStats >&
+EngineData::windows() const {
+  // @@protoc_insertion_point(field_list:EngineData.windows)
+  return _impl_.windows_;
+}
+
+// repeated .Alert alerts = 8;
+inline int EngineData::_internal_alerts_size() const {
+  return _impl_.alerts_.size();
+}
+inline int EngineData::alerts_size() const {
+  return _internal_alerts_size();
+}
+inline void EngineData::clear_alerts() {
+  _impl_.alerts_.Clear();
+}
+inline ::Alert* EngineData::mutable_alerts(int index) {
+  // @@protoc_insertion_point(field_mutable:EngineData.alerts)
+  return _impl_.alerts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Alert >*
+EngineData::mutable_alerts() {
+  // @@protoc_insertion_point(field_mutable_list:EngineData.alerts)
+  return &_impl_.alerts_;
+}
+inline const ::Alert& EngineData::_internal_alerts(int index) const {
+  return _impl_.alerts_.Get(index);
+}
+inline const ::Alert& EngineData::alerts(int index) const {
+  // @@protoc_insertion_point(field_get:EngineData.alerts)
+  return _internal_alerts(index);
+}
+inline ::Alert* EngineData::_internal_add_alerts() {
+  return _impl_.alerts_.Add();
+}
+inline ::Alert* EngineData::add_alerts() {
+  ::Alert* _add = _internal_add_alerts();
+  // @@protoc_insertion_point(field_add:EngineData.alerts)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Alert >&
+EngineData::alerts() const {
+  // @@protoc_insertion_point(field_list:EngineData.alerts)
+  return _impl_.alerts_;
+}
+
+// .ExportChunk export_chunk = 9;
+inline bool EngineData::_internal_has_export_chunk() const {
+  return this != internal_default_instance() && _impl_.export_chunk_ != nullptr;
+}
+inline bool EngineData::has_export_chunk() const {
+  return _internal_has_export_chunk();
+}
+inline void EngineData::clear_export_chunk() {
+  if (GetArenaForAllocation() == nullptr && _impl_.export_chunk_ != nullptr) {
+    delete _impl_.export_chunk_;
+  }
+  _impl_.export_chunk_ = nullptr;
+}
+inline const ::ExportChunk& EngineData::_internal_export_chunk() const {
+  const ::ExportChunk* p = _impl_.export_chunk_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ExportChunk&>(
+      ::_ExportChunk_default_instance_);
+}
+inline const ::ExportChunk& EngineData::export_chunk() const {
+  // @@protoc_insertion_point(field_get:EngineData.export_chunk)
+  return _internal_export_chunk();
+}
+inline void EngineData::unsafe_arena_set_allocated_export_chunk(
+    ::ExportChunk* export_chunk) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.export_chunk_);
+  }
+  _impl_.export_chunk_ = export_chunk;
+  if (export_chunk) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:EngineData.export_chunk)
+}
+inline ::ExportChunk* EngineData::release_export_chunk() {
+  
+  ::ExportChunk* temp = _impl_.export_chunk_;
+  _impl_.export_chunk_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ExportChunk* EngineData::unsafe_arena_release_export_chunk() {
+  // @@protoc_insertion_point(field_release:EngineData.export_chunk)
+  
+  ::ExportChunk* temp = _impl_.export_chunk_;
+  _impl_.export_chunk_ = nullptr;
+  return temp;
+}
+inline ::ExportChunk* EngineData::_internal_mutable_export_chunk() {
+  
+  if (_impl_.export_chunk_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ExportChunk>(GetArenaForAllocation());
+    _impl_.export_chunk_ = p;
+  }
+  return _impl_.export_chunk_;
+}
+inline ::ExportChunk* EngineData::mutable_export_chunk() {
+  ::ExportChunk* _msg = _internal_mutable_export_chunk();
+  // @@protoc_insertion_point(field_mutable:EngineData.export_chunk)
+  return _msg;
+}
+inline void EngineData::set_allocated_export_chunk(::ExportChunk* export_chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.export_chunk_;
+  }
+  if (export_chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(export_chunk);
+    if (message_arena != submessage_arena) {
+      export_chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, export_chunk, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.export_chunk_ = export_chunk;
+  // @@protoc_insertion_point(field_set_allocated:EngineData.export_chunk)
+}
+
+// repeated int64 field_timestamp_ms = 10;
+inline int EngineData::_internal_field_timestamp_ms_size() const {
+  return _impl_.field_timestamp_ms_.size();
+}
+inline int EngineData::field_timestamp_ms_size() const {
+  return _internal_field_timestamp_ms_size();
+}
+inline void EngineData::clear_field_timestamp_ms() {
+  _impl_.field_timestamp_ms_.Clear();
+}
+inline int64_t EngineData::_internal_field_timestamp_ms(int index) const {
+  return _impl_.field_timestamp_ms_.Get(index);
+}
+inline int64_t EngineData::field_timestamp_ms(int index) const {
+  // @@protoc_insertion_point(field_get:EngineData.field_timestamp_ms)
+  return _internal_field_timestamp_ms(index);
+}
+inline void EngineData::set_field_timestamp_ms(int index, int64_t value) {
+  _impl_.field_timestamp_ms_.Set(index, value);
+  // @@protoc_insertion_point(field_set:EngineData.field_timestamp_ms)
+}
+inline void EngineData::_internal_add_field_timestamp_ms(int64_t value) {
+  _impl_.field_timestamp_ms_.Add(value);
+}
+inline void EngineData::add_field_timestamp_ms(int64_t value) {
+  _internal_add_field_timestamp_ms(value);
+  // @@protoc_insertion_point(field_add:EngineData.field_timestamp_ms)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+EngineData::_internal_field_timestamp_ms() const {
+  return _impl_.field_timestamp_ms_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+EngineData::field_timestamp_ms() const {
+  // @@protoc_insertion_point(field_list:EngineData.field_timestamp_ms)
+  return _internal_field_timestamp_ms();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+EngineData::_internal_mutable_field_timestamp_ms() {
+  return &_impl_.field_timestamp_ms_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+EngineData::mutable_field_timestamp_ms() {
+  // @@protoc_insertion_point(field_mutable_list:EngineData.field_timestamp_ms)
+  return _internal_mutable_field_timestamp_ms();
+}
+
+// repeated .PipelineStage pipeline = 11;
+inline int EngineData::_internal_pipeline_size() const {
+  return _impl_.pipeline_.size();
+}
+inline int EngineData::pipeline_size() const {
+  return _internal_pipeline_size();
+}
+inline void EngineData::clear_pipeline() {
+  _impl_.pipeline_.Clear();
+}
+inline ::PipelineStage* EngineData::mutable_pipeline(int index) {
+  // @@protoc_insertion_point(field_mutable:EngineData.pipeline)
+  return _impl_.pipeline_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PipelineStage >*
+EngineData::mutable_pipeline() {
+  // @@protoc_insertion_point(field_mutable_list:EngineData.pipeline)
+  return &_impl_.pipeline_;
+}
+inline const ::PipelineStage& EngineData::_internal_pipeline(int index) const {
+  return _impl_.pipeline_.Get(index);
+}
+inline const ::PipelineStage& EngineData::pipeline(int index) const {
+  // @@protoc_insertion_point(field_get:EngineData.pipeline)
+  return _internal_pipeline(index);
+}
+inline ::PipelineStage* EngineData::_internal_add_pipeline() {
+  return _impl_.pipeline_.Add();
+}
+inline ::PipelineStage* EngineData::add_pipeline() {
+  ::PipelineStage* _add = _internal_add_pipeline();
+  // @@protoc_insertion_point(field_add:EngineData.pipeline)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PipelineStage >&
+EngineData::pipeline() const {
+  // @@protoc_insertion_point(field_list:EngineData.pipeline)
+  return _impl_.pipeline_;
+}
+
+// -------------------------------------------------------------------
+
+// PipelineStage
+
+// string name = 1;
+inline void PipelineStage::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PipelineStage::name() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PipelineStage::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PipelineStage.name)
+}
+inline std::string* PipelineStage::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:PipelineStage.name)
+  return _s;
+}
+inline const std::string& PipelineStage::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PipelineStage::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PipelineStage::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PipelineStage::release_name() {
+  // @@protoc_insertion_point(field_release:PipelineStage.name)
+  return _impl_.name_.Release();
+}
+inline void PipelineStage::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PipelineStage.name)
+}
+
+// uint32 depth = 2;
+inline void PipelineStage::clear_depth() {
+  _impl_.depth_ = 0u;
+}
+inline uint32_t PipelineStage::_internal_depth() const {
+  return _impl_.depth_;
+}
+inline uint32_t PipelineStage::depth() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.depth)
+  return _internal_depth();
+}
+inline void PipelineStage::_internal_set_depth(uint32_t value) {
+  
+  _impl_.depth_ = value;
+}
+inline void PipelineStage::set_depth(uint32_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:PipelineStage.depth)
+}
+
+// uint32 capacity = 3;
+inline void PipelineStage::clear_capacity() {
+  _impl_.capacity_ = 0u;
+}
+inline uint32_t PipelineStage::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline uint32_t PipelineStage::capacity() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.capacity)
+  return _internal_capacity();
+}
+inline void PipelineStage::_internal_set_capacity(uint32_t value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void PipelineStage::set_capacity(uint32_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:PipelineStage.capacity)
+}
+
+// uint32 high_water = 4;
+inline void PipelineStage::clear_high_water() {
+  _impl_.high_water_ = 0u;
+}
+inline uint32_t PipelineStage::_internal_high_water() const {
+  return _impl_.high_water_;
+}
+inline uint32_t PipelineStage::high_water() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.high_water)
+  return _internal_high_water();
+}
+inline void PipelineStage::_internal_set_high_water(uint32_t value) {
+  
+  _impl_.high_water_ = value;
+}
+inline void PipelineStage::set_high_water(uint32_t value) {
+  _internal_set_high_water(value);
+  // @@protoc_insertion_point(field_set:PipelineStage.high_water)
+}
+
+// uint64 processed = 5;
+inline void PipelineStage::clear_processed() {
+  _impl_.processed_ = uint64_t{0u};
+}
+inline uint64_t PipelineStage::_internal_processed() const {
+  return _impl_.processed_;
+}
+inline uint64_t PipelineStage::processed() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.processed)
+  return _internal_processed();
+}
+inline void PipelineStage::_internal_set_processed(uint64_t value) {
+  
+  _impl_.processed_ = value;
+}
+inline void PipelineStage::set_processed(uint64_t value) {
+  _internal_set_processed(value);
+  // @@protoc_insertion_point(field_set:PipelineStage.processed)
+}
+
+// uint64 dropped = 6;
+inline void PipelineStage::clear_dropped() {
+  _impl_.dropped_ = uint64_t{0u};
+}
+inline uint64_t PipelineStage::_internal_dropped() const {
+  return _impl_.dropped_;
+}
+inline uint64_t PipelineStage::dropped() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.dropped)
+  return _internal_dropped();
+}
+inline void PipelineStage::_internal_set_dropped(uint64_t value) {
+  
+  _impl_.dropped_ = value;
+}
+inline void PipelineStage::set_dropped(uint64_t value) {
+  _internal_set_dropped(value);
+  // @@protoc_insertion_point(field_set:PipelineStage.dropped)
+}
+
+// double mean_latency_us = 7;
+inline void PipelineStage::clear_mean_latency_us() {
+  _impl_.mean_latency_us_ = 0;
+}
+inline double PipelineStage::_internal_mean_latency_us() const {
+  return _impl_.mean_latency_us_;
+}
+inline double PipelineStage::mean_latency_us() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.mean_latency_us)
+  return _internal_mean_latency_us();
+}
+inline void PipelineStage::_internal_set_mean_latency_us(double value) {
+  
+  _impl_.mean_latency_us_ = value;
+}
+inline void PipelineStage::set_mean_latency_us(double value) {
+  _internal_set_mean_latency_us(value);
+  // @@protoc_insertion_point(field_set:PipelineStage.mean_latency_us)
+}
+
+// double max_latency_us = 8;
+inline void PipelineStage::clear_max_latency_us() {
+  _impl_.max_latency_us_ = 0;
+}
+inline double PipelineStage::_internal_max_latency_us() const {
+  return _impl_.max_latency_us_;
+}
+inline double PipelineStage::max_latency_us() const {
+  // @@protoc_insertion_point(field_get:PipelineStage.max_latency_us)
+  return _internal_max_latency_us();
+}
+inline void PipelineStage::_internal_set_max_latency_us(double value) {
+  
+  _impl_.max_latency_us_ = value;
+}
+inline void PipelineStage::set_max_latency_us(double value) {
+  _internal_set_max_latency_us(value);
+  // @@protoc_insertion_point(field_set:PipelineStage.max_latency_us)
+}
+
+// -------------------------------------------------------------------
+
+// ExportChunk
+
+// bytes data = 1;
+inline void ExportChunk::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& ExportChunk::data() const {
+  // @@protoc_insertion_point(field_get:ExportChunk.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExportChunk::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ExportChunk.data)
+}
+inline std::string* ExportChunk::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:ExportChunk.data)
+  return _s;
+}
+inline const std::string& ExportChunk::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ExportChunk::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExportChunk::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExportChunk::release_data() {
+  // @@protoc_insertion_point(field_release:ExportChunk.data)
+  return _impl_.data_.Release();
+}
+inline void ExportChunk::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ExportChunk.data)
+}
+
+// bool last = 2;
+inline void ExportChunk::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool ExportChunk::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool ExportChunk::last() const {
+  // @@protoc_insertion_point(field_get:ExportChunk.last)
+  return _internal_last();
+}
+inline void ExportChunk::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void ExportChunk::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:ExportChunk.last)
+}
+
+// bool failed = 3;
+inline void ExportChunk::clear_failed() {
+  _impl_.failed_ = false;
+}
+inline bool ExportChunk::_internal_failed() const {
+  return _impl_.failed_;
+}
+inline bool ExportChunk::failed() const {
+  // @@protoc_insertion_point(field_get:ExportChunk.failed)
+  return _internal_failed();
+}
+inline void ExportChunk::_internal_set_failed(bool value) {
+  
+  _impl_.failed_ = value;
+}
+inline void ExportChunk::set_failed(bool value) {
+  _internal_set_failed(value);
+  // @@protoc_insertion_point(field_set:ExportChunk.failed)
+}
+
+// -------------------------------------------------------------------
+
+// Alert
+
+// string rule = 1;
+inline void Alert::clear_rule() {
+  _impl_.rule_.ClearToEmpty();
+}
+inline const std::string& Alert::rule() const {
+  // @@protoc_insertion_point(field_get:Alert.rule)
+  return _internal_rule();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Alert::set_rule(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rule_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Alert.rule)
+}
+inline std::string* Alert::mutable_rule() {
+  std::string* _s = _internal_mutable_rule();
+  // @@protoc_insertion_point(field_mutable:Alert.rule)
+  return _s;
+}
+inline const std::string& Alert::_internal_rule() const {
+  return _impl_.rule_.Get();
+}
+inline void Alert::_internal_set_rule(const std::string& value) {
+  
+  _impl_.rule_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Alert::_internal_mutable_rule() {
+  
+  return _impl_.rule_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Alert::release_rule() {
+  // @@protoc_insertion_point(field_release:Alert.rule)
+  return _impl_.rule_.Release();
+}
+inline void Alert::set_allocated_rule(std::string* rule) {
+  if (rule != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rule_.SetAllocated(rule, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rule_.IsDefault()) {
+    _impl_.rule_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Alert.rule)
+}
+
+// bool raised = 2;
+inline void Alert::clear_raised() {
+  _impl_.raised_ = false;
+}
+inline bool Alert::_internal_raised() const {
+  return _impl_.raised_;
+}
+inline bool Alert::raised() const {
+  // @@protoc_insertion_point(field_get:Alert.raised)
+  return _internal_raised();
+}
+inline void Alert::_internal_set_raised(bool value) {
+  
+  _impl_.raised_ = value;
+}
+inline void Alert::set_raised(bool value) {
+  _internal_set_raised(value);
+  // @@protoc_insertion_point(field_set:Alert.raised)
+}
+
+// -------------------------------------------------------------------
+
+// SignalStats
+
+// double mean = 1;
+inline void SignalStats::clear_mean() {
+  _impl_.mean_ = 0;
+}
+inline double SignalStats::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline double SignalStats::mean() const {
+  // @@protoc_insertion_point(field_get:SignalStats.mean)
+  return _internal_mean();
+}
+inline void SignalStats::_internal_set_mean(double value) {
+  
+  _impl_.mean_ = value;
+}
+inline void SignalStats::set_mean(double value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:SignalStats.mean)
+}
+
+// int32 min = 2;
+inline void SignalStats::clear_min() {
+  _impl_.min_ = 0;
+}
+inline int32_t SignalStats::_internal_min() const {
+  return _impl_.min_;
+}
+inline int32_t SignalStats::min() const {
+  // @@protoc_insertion_point(field_get:SignalStats.min)
+  return _internal_min();
+}
+inline void SignalStats::_internal_set_min(int32_t value) {
+  
+  _impl_.min_ = value;
+}
+inline void SignalStats::set_min(int32_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:SignalStats.min)
+}
+
+// int32 max = 3;
+inline void SignalStats::clear_max() {
+  _impl_.max_ = 0;
+}
+inline int32_t SignalStats::_internal_max() const {
+  return _impl_.max_;
+}
+inline int32_t SignalStats::max() const {
+  // @@protoc_insertion_point(field_get:SignalStats.max)
+  return _internal_max();
+}
+inline void SignalStats::_internal_set_max(int32_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void SignalStats::set_max(int32_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:SignalStats.max)
+}
+
+// double rate_per_s = 4;
+inline void SignalStats::clear_rate_per_s() {
+  _impl_.rate_per_s_ = 0;
+}
+inline double SignalStats::_internal_rate_per_s() const {
+  return _impl_.rate_per_s_;
+}
+inline double SignalStats::rate_per_s() const {
+  // @@protoc_insertion_point(field_get:SignalStats.rate_per_s)
+  return _internal_rate_per_s();
+}
+inline void SignalStats::_internal_set_rate_per_s(double value) {
+  
+  _impl_.rate_per_s_ = value;
+}
+inline void SignalStats::set_rate_per_s(double value) {
+  _internal_set_rate_per_s(value);
+  // @@protoc_insertion_point(field_set:SignalStats.rate_per_s)
+}
+
+// double ewma = 5;
+inline void SignalStats::clear_ewma() {
+  _impl_.ewma_ = 0;
+}
+inline double SignalStats::_internal_ewma() const {
+  return _impl_.ewma_;
+}
+inline double SignalStats::ewma() const {
+  // @@protoc_insertion_point(field_get:SignalStats.ewma)
+  return _internal_ewma();
+}
+inline void SignalStats::_internal_set_ewma(double value) {
+  
+  _impl_.ewma_ = value;
+}
+inline void SignalStats::set_ewma(double value) {
+  _internal_set_ewma(value);
+  // @@protoc_insertion_point(field_set:SignalStats.ewma)
+}
+
+// double p50 = 6;
+inline void SignalStats::clear_p50() {
+  _impl_.p50_ = 0;
+}
+inline double SignalStats::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline double SignalStats::p50() const {
+  // @@protoc_insertion_point(field_get:SignalStats.p50)
+  return _internal_p50();
+}
+inline void SignalStats::_internal_set_p50(double value) {
+  
+  _impl_.p50_ = value;
+}
+inline void SignalStats::set_p50(double value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:SignalStats.p50)
+}
+
+// double p90 = 7;
+inline void SignalStats::clear_p90() {
+  _impl_.p90_ = 0;
+}
+inline double SignalStats::_internal_p90() const {
+  return _impl_.p90_;
+}
+inline double SignalStats::p90() const {
+  // @@protoc_insertion_point(field_get:SignalStats.p90)
+  return _internal_p90();
+}
+inline void SignalStats::_internal_set_p90(double value) {
+  
+  _impl_.p90_ = value;
+}
+inline void SignalStats::set_p90(double value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:SignalStats.p90)
+}
+
+// double p99 = 8;
+inline void SignalStats::clear_p99() {
+  _impl_.p99_ = 0;
+}
+inline double SignalStats::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline double SignalStats::p99() const {
+  // @@protoc_insertion_point(field_get:SignalStats.p99)
+  return _internal_p99();
+}
+inline void SignalStats::_internal_set_p99(double value) {
+  
+  _impl_.p99_ = value;
+}
+inline void SignalStats::set_p99(double value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:SignalStats.p99)
+}
+
+// -------------------------------------------------------------------
+
+// WindowStats
+
+// uint32 window_ms = 1;
+inline void WindowStats::clear_window_ms() {
+  _impl_.window_ms_ = 0u;
+}
+inline uint32_t WindowStats::_internal_window_ms() const {
+  return _impl_.window_ms_;
+}
+inline uint32_t WindowStats::window_ms() const {
+  // @@protoc_insertion_point(field_get:WindowStats.window_ms)
+  return _internal_window_ms();
+}
+inline void WindowStats::_internal_set_window_ms(uint32_t value) {
+  
+  _impl_.window_ms_ = value;
+}
+inline void WindowStats::set_window_ms(uint32_t value) {
+  _internal_set_window_ms(value);
+  // @@protoc_insertion_point(field_set:WindowStats.window_ms)
+}
+
+// uint32 count = 2;
+inline void WindowStats::clear_count() {
+  _impl_.count_ = 0u;
+}
+inline uint32_t WindowStats::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t WindowStats::count() const {
+  // @@protoc_insertion_point(field_get:WindowStats.count)
+  return _internal_count();
+}
+inline void WindowStats::_internal_set_count(uint32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void WindowStats::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:WindowStats.count)
+}
+
+// .SignalStats rpm = 3;
+inline bool WindowStats::_internal_has_rpm() const {
+  return this != internal_default_instance() && _impl_.rpm_ != nullptr;
+}
+inline bool WindowStats::has_rpm() const {
+  return _internal_has_rpm();
+}
+inline void WindowStats::clear_rpm() {
+  if (GetArenaForAllocation() == nullptr && _impl_.rpm_ != nullptr) {
+    delete _impl_.rpm_;
+  }
+  _impl_.rpm_ = nullptr;
+}
+inline const ::SignalStats& WindowStats::_internal_rpm() const {
+  const ::SignalStats* p = _impl_.rpm_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SignalStats&>(
+      ::_SignalStats_default_instance_);
+}
+inline const ::SignalStats& WindowStats::rpm() const {
+  // @@protoc_insertion_point(field_get:WindowStats.rpm)
+  return _internal_rpm();
+}
+inline void WindowStats::unsafe_arena_set_allocated_rpm(
+    ::SignalStats* rpm) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rpm_);
+  }
+  _impl_.rpm_ = rpm;
+  if (rpm) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WindowStats.rpm)
+}
+inline ::SignalStats* WindowStats::release_rpm() {
+  
+  ::SignalStats* temp = _impl_.rpm_;
+  _impl_.rpm_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SignalStats* WindowStats::unsafe_arena_release_rpm() {
+  // @@protoc_insertion_point(field_release:WindowStats.rpm)
+  
+  ::SignalStats* temp = _impl_.rpm_;
+  _impl_.rpm_ = nullptr;
+  return temp;
+}
+inline ::SignalStats* WindowStats::_internal_mutable_rpm() {
+  
+  if (_impl_.rpm_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SignalStats>(GetArenaForAllocation());
+    _impl_.rpm_ = p;
+  }
+  return _impl_.rpm_;
+}
+inline ::SignalStats* WindowStats::mutable_rpm() {
+  ::SignalStats* _msg = _internal_mutable_rpm();
+  // @@protoc_insertion_point(field_mutable:WindowStats.rpm)
+  return _msg;
+}
+inline void WindowStats::set_allocated_rpm(::SignalStats* rpm) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rpm_;
+  }
+  if (rpm) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rpm);
+    if (message_arena != submessage_arena) {
+      rpm = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rpm, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.rpm_ = rpm;
+  // @@protoc_insertion_point(field_set_allocated:WindowStats.rpm)
+}
+
+// .SignalStats temperature = 4;
+inline bool WindowStats::_internal_has_temperature() const {
+  return this != internal_default_instance() && _impl_.temperature_ != nullptr;
+}
+inline bool WindowStats::has_temperature() const {
+  return _internal_has_temperature();
+}
+inline void WindowStats::clear_temperature() {
+  if (GetArenaForAllocation() == nullptr && _impl_.temperature_ != nullptr) {
+    delete _impl_.temperature_;
+  }
+  _impl_.temperature_ = nullptr;
+}
+inline const ::SignalStats& WindowStats::_internal_temperature() const {
+  const ::SignalStats* p = _impl_.temperature_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SignalStats&>(
+      ::_SignalStats_default_instance_);
+}
+inline const ::SignalStats& WindowStats::temperature() const {
+  // @@protoc_insertion_point(field_get:WindowStats.temperature)
+  return _internal_temperature();
+}
+inline void WindowStats::unsafe_arena_set_allocated_temperature(
+    ::SignalStats* temperature) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.temperature_);
+  }
+  _impl_.temperature_ = temperature;
+  if (temperature) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WindowStats.temperature)
+}
+inline ::SignalStats* WindowStats::release_temperature() {
+  
+  ::SignalStats* temp = _impl_.temperature_;
+  _impl_.temperature_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SignalStats* WindowStats::unsafe_arena_release_temperature() {
+  // @@protoc_insertion_point(field_release:WindowStats.temperature)
+  
+  ::SignalStats* temp = _impl_.temperature_;
+  _impl_.temperature_ = nullptr;
+  return temp;
+}
+inline ::SignalStats* WindowStats::_internal_mutable_temperature() {
+  
+  if (_impl_.temperature_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SignalStats>(GetArenaForAllocation());
+    _impl_.temperature_ = p;
+  }
+  return _impl_.temperature_;
+}
+inline ::SignalStats* WindowStats::mutable_temperature() {
+  ::SignalStats* _msg = _internal_mutable_temperature();
+  // @@protoc_insertion_point(field_mutable:WindowStats.temperature)
+  return _msg;
+}
+inline void WindowStats::set_allocated_temperature(::SignalStats* temperature) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.temperature_;
+  }
+  if (temperature) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(temperature);
+    if (message_arena != submessage_arena) {
+      temperature = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, temperature, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.temperature_ = temperature;
+  // @@protoc_insertion_point(field_set_allocated:WindowStats.temperature)
+}
+
+// .SignalStats oil_pressure = 5;
+inline bool WindowStats::_internal_has_oil_pressure() const {
+  return this != internal_default_instance() && _impl_.oil_pressure_ != nullptr;
+}
+inline bool WindowStats::has_oil_pressure() const {
+  return _internal_has_oil_pressure();
+}
+inline void WindowStats::clear_oil_pressure() {
+  if (GetArenaForAllocation() == nullptr && _impl_.oil_pressure_ != nullptr) {
+    delete _impl_.oil_pressure_;
+  }
+  _impl_.oil_pressure_ = nullptr;
+}
+inline const ::SignalStats& WindowStats::_internal_oil_pressure() const {
+  const ::SignalStats* p = _impl_.oil_pressure_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SignalStats&>(
+      ::_SignalStats_default_instance_);
+}
+inline const ::SignalStats& WindowStats::oil_pressure() const {
+  // @@protoc_insertion_point(field_get:WindowStats.oil_pressure)
+  return _internal_oil_pressure();
+}
+inline void WindowStats::unsafe_arena_set_allocated_oil_pressure(
+    ::SignalStats* oil_pressure) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.oil_pressure_);
+  }
+  _impl_.oil_pressure_ = oil_pressure;
+  if (oil_pressure) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WindowStats.oil_pressure)
+}
+inline ::SignalStats* WindowStats::release_oil_pressure() {
+  
+  ::SignalStats* temp = _impl_.oil_pressure_;
+  _impl_.oil_pressure_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SignalStats* WindowStats::unsafe_arena_release_oil_pressure() {
+  // @@protoc_insertion_point(field_release:WindowStats.oil_pressure)
+  
+  ::SignalStats* temp = _impl_.oil_pressure_;
+  _impl_.oil_pressure_ = nullptr;
+  return temp;
+}
+inline ::SignalStats* WindowStats::_internal_mutable_oil_pressure() {
+  
+  if (_impl_.oil_pressure_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SignalStats>(GetArenaForAllocation());
+    _impl_.oil_pressure_ = p;
+  }
+  return _impl_.oil_pressure_;
+}
+inline ::SignalStats* WindowStats::mutable_oil_pressure() {
+  ::SignalStats* _msg = _internal_mutable_oil_pressure();
+  // @@protoc_insertion_point(field_mutable:WindowStats.oil_pressure)
+  return _msg;
+}
+inline void WindowStats::set_allocated_oil_pressure(::SignalStats* oil_pressure) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.oil_pressure_;
+  }
+  if (oil_pressure) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(oil_pressure);
+    if (message_arena != submessage_arena) {
+      oil_pressure = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oil_pressure, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.oil_pressure_ = oil_pressure;
+  // @@protoc_insertion_point(field_set_allocated:WindowStats.oil_pressure)
+}
+
+// .SignalStats speed = 6;
+inline bool WindowStats::_internal_has_speed() const {
+  return this != internal_default_instance() && _impl_.speed_ != nullptr;
+}
+inline bool WindowStats::has_speed() const {
+  return _internal_has_speed();
+}
+inline void WindowStats::clear_speed() {
+  if (GetArenaForAllocation() == nullptr && _impl_.speed_ != nullptr) {
+    delete _impl_.speed_;
+  }
+  _impl_.speed_ = nullptr;
+}
+inline const ::SignalStats& WindowStats::_internal_speed() const {
+  const ::SignalStats* p = _impl_.speed_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SignalStats&>(
+      ::_SignalStats_default_instance_);
+}
+inline const ::SignalStats& WindowStats::speed() const {
+  // @@protoc_insertion_point(field_get:WindowStats.speed)
+  return _internal_speed();
+}
+inline void WindowStats::unsafe_arena_set_allocated_speed(
+    ::SignalStats* speed) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.speed_);
+  }
+  _impl_.speed_ = speed;
+  if (speed) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WindowStats.speed)
+}
+inline ::SignalStats* WindowStats::release_speed() {
+  
+  ::SignalStats* temp = _impl_.speed_;
+  _impl_.speed_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SignalStats* WindowStats::unsafe_arena_release_speed() {
+  // @@protoc_insertion_point(field_release:WindowStats.speed)
+  
+  ::SignalStats* temp = _impl_.speed_;
+  _impl_.speed_ = nullptr;
+  return temp;
+}
+inline ::SignalStats* WindowStats::_internal_mutable_speed() {
+  
+  if (_impl_.speed_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SignalStats>(GetArenaForAllocation());
+    _impl_.speed_ = p;
+  }
+  return _impl_.speed_;
+}
+inline ::SignalStats* WindowStats::mutable_speed() {
+  ::SignalStats* _msg = _internal_mutable_speed();
+  // @@protoc_insertion_point(field_mutable:WindowStats.speed)
+  return _msg;
+}
+inline void WindowStats::set_allocated_speed(::SignalStats* speed) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.speed_;
+  }
+  if (speed) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(speed);
+    if (message_arena != submessage_arena) {
+      speed = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, speed, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.speed_ = speed;
+  // @@protoc_insertion_point(field_set_allocated:WindowStats.speed)
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// bool include_stats = 1;
+inline void Request::clear_include_stats() {
+  _impl_.include_stats_ = false;
+}
+inline bool Request::_internal_include_stats() const {
+  return _impl_.include_stats_;
+}
+inline bool Request::include_stats() const {
+  // @@protoc_insertion_point(field_get:Request.include_stats)
+  return _internal_include_stats();
+}
+inline void Request::_internal_set_include_stats(bool value) {
+  
+  _impl_.include_stats_ = value;
+}
+inline void Request::set_include_stats(bool value) {
+  _internal_set_include_stats(value);
+  // @@protoc_insertion_point(field_set:Request.include_stats)
+}
+
+// bool subscribe_alerts = 2;
+inline void Request::clear_subscribe_alerts() {
+  _impl_.subscribe_alerts_ = false;
+}
+inline bool Request::_internal_subscribe_alerts() const {
+  return _impl_.subscribe_alerts_;
+}
+inline bool Request::subscribe_alerts() const {
+  // @@protoc_insertion_point(field_get:Request.subscribe_alerts)
+  return _internal_subscribe_alerts();
+}
+inline void Request::_internal_set_subscribe_alerts(bool value) {
+  
+  _impl_.subscribe_alerts_ = value;
+}
+inline void Request::set_subscribe_alerts(bool value) {
+  _internal_set_subscribe_alerts(value);
+  // @@protoc_insertion_point(field_set:Request.subscribe_alerts)
+}
+
+// .ExportRequest export_history = 3;
+inline bool Request::_internal_has_export_history() const {
+  return this != internal_default_instance() && _impl_.export_history_ != nullptr;
+}
+inline bool Request::has_export_history() const {
+  return _internal_has_export_history();
+}
+inline void Request::clear_export_history() {
+  if (GetArenaForAllocation() == nullptr && _impl_.export_history_ != nullptr) {
+    delete _impl_.export_history_;
+  }
+  _impl_.export_history_ = nullptr;
+}
+inline const ::ExportRequest& Request::_internal_export_history() const {
+  const ::ExportRequest* p = _impl_.export_history_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ExportRequest&>(
+      ::_ExportRequest_default_instance_);
+}
+inline const ::ExportRequest& Request::export_history() const {
+  // @@protoc_insertion_point(field_get:Request.export_history)
+  return _internal_export_history();
+}
+inline void Request::unsafe_arena_set_allocated_export_history(
+    ::ExportRequest* export_history) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.export_history_);
+  }
+  _impl_.export_history_ = export_history;
+  if (export_history) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Request.export_history)
+}
+inline ::ExportRequest* Request::release_export_history() {
+  
+  ::ExportRequest* temp = _impl_.export_history_;
+  _impl_.export_history_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ExportRequest* Request::unsafe_arena_release_export_history() {
+  // @@protoc_insertion_point(field_release:Request.export_history)
+  
+  ::ExportRequest* temp = _impl_.export_history_;
+  _impl_.export_history_ = nullptr;
+  return temp;
+}
+inline ::ExportRequest* Request::_internal_mutable_export_history() {
+  
+  if (_impl_.export_history_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ExportRequest>(GetArenaForAllocation());
+    _impl_.export_history_ = p;
+  }
+  return _impl_.export_history_;
+}
+inline ::ExportRequest* Request::mutable_export_history() {
+  ::ExportRequest* _msg = _internal_mutable_export_history();
+  // @@protoc_insertion_point(field_mutable:Request.export_history)
+  return _msg;
+}
+inline void Request::set_allocated_export_history(::ExportRequest* export_history) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.export_history_;
+  }
+  if (export_history) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(export_history);
+    if (message_arena != submessage_arena) {
+      export_history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, export_history, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.export_history_ = export_history;
+  // @@protoc_insertion_point(field_set_allocated:Request.export_history)
+}
+
+// optional uint64 after_sequence = 4;
+inline bool Request::_internal_has_after_sequence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Request::has_after_sequence() const {
+  return _internal_has_after_sequence();
+}
+inline void Request::clear_after_sequence() {
+  _impl_.after_sequence_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Request::_internal_after_sequence() const {
+  return _impl_.after_sequence_;
+}
+inline uint64_t Request::after_sequence() const {
+  // @@protoc_insertion_point(field_get:Request.after_sequence)
+  return _internal_after_sequence();
+}
+inline void Request::_internal_set_after_sequence(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.after_sequence_ = value;
+}
+inline void Request::set_after_sequence(uint64_t value) {
+  _internal_set_after_sequence(value);
+  // @@protoc_insertion_point(field_set:Request.after_sequence)
+}
+
+// uint32 wait_ms = 5;
+inline void Request::clear_wait_ms() {
+  _impl_.wait_ms_ = 0u;
+}
+inline uint32_t Request::_internal_wait_ms() const {
+  return _impl_.wait_ms_;
+}
+inline uint32_t Request::wait_ms() const {
+  // @@protoc_insertion_point(field_get:Request.wait_ms)
+  return _internal_wait_ms();
+}
+inline void Request::_internal_set_wait_ms(uint32_t value) {
+  
+  _impl_.wait_ms_ = value;
+}
+inline void Request::set_wait_ms(uint32_t value) {
+  _internal_set_wait_ms(value);
+  // @@protoc_insertion_point(field_set:Request.wait_ms)
+}
+
+// -------------------------------------------------------------------
+
+// ExportRequest
+
+// int64 from_ms = 1;
+inline void ExportRequest::clear_from_ms() {
+  _impl_.from_ms_ = int64_t{0};
+}
+inline int64_t ExportRequest::_internal_from_ms() const {
+  return _impl_.from_ms_;
+}
+inline int64_t ExportRequest::from_ms() const {
+  // @@protoc_insertion_point(field_get:ExportRequest.from_ms)
+  return _internal_from_ms();
+}
+inline void ExportRequest::_internal_set_from_ms(int64_t value) {
+  
+  _impl_.from_ms_ = value;
+}
+inline void ExportRequest::set_from_ms(int64_t value) {
+  _internal_set_from_ms(value);
+  // @@protoc_insertion_point(field_set:ExportRequest.from_ms)
+}
+
+// int64 to_ms = 2;
+inline void ExportRequest::clear_to_ms() {
+  _impl_.to_ms_ = int64_t{0};
+}
+inline int64_t ExportRequest::_internal_to_ms() const {
+  return _impl_.to_ms_;
+}
+inline int64_t ExportRequest::to_ms() const {
+  // @@protoc_insertion_point(field_get:ExportRequest.to_ms)
+  return _internal_to_ms();
+}
+inline void ExportRequest::_internal_set_to_ms(int64_t value) {
+  
+  _impl_.to_ms_ = value;
+}
+inline void ExportRequest::set_to_ms(int64_t value) {
+  _internal_set_to_ms(value);
+  // @@protoc_insertion_point(field_set:ExportRequest.to_ms)
+}
+
+// .ExportRequest.Format format = 3;
+inline void ExportRequest::clear_format() {
+  _impl_.format_ = 0;
+}
+inline ::ExportRequest_Format ExportRequest::_internal_format() const {
+  return static_cast< ::ExportRequest_Format >(_impl_.format_);
+}
+inline ::ExportRequest_Format ExportRequest::format() const {
+  // @@protoc_insertion_point(field_get:ExportRequest.format)
+  return _internal_format();
+}
+inline void ExportRequest::_internal_set_format(::ExportRequest_Format value) {
+  
+  _impl_.format_ = value;
+}
+inline void ExportRequest::set_format(::ExportRequest_Format value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:ExportRequest.format)
+}
+
+// int64 step_ms = 4;
+inline void ExportRequest::clear_step_ms() {
+  _impl_.step_ms_ = int64_t{0};
+}
+inline int64_t ExportRequest::_internal_step_ms() const {
+  return _impl_.step_ms_;
+}
+inline int64_t ExportRequest::step_ms() const {
+  // @@protoc_insertion_point(field_get:ExportRequest.step_ms)
+  return _internal_step_ms();
+}
+inline void ExportRequest::_internal_set_step_ms(int64_t value) {
+  
+  _impl_.step_ms_ = value;
+}
+inline void ExportRequest::set_step_ms(int64_t value) {
+  _internal_set_step_ms(value);
+  // @@protoc_insertion_point(field_set:ExportRequest.step_ms)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ExportRequest_Format> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ExportRequest_Format>() {
+  return ::ExportRequest_Format_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
@@ -0,0 +1,64 @@
+#!/bin/bash
+# run_bench.sh: Start the server with a Unix socket listener and compare request
+# latency/throughput over loopback TCP and AF_UNIX (stream and seqpacket).
+
+REQUESTS=${REQUESTS:-50000}
+CONNECTIONS=${CONNECTIONS:-1}
+UNIX_PATH=/tmp/middlewaresw_bench.sock
+
+./build.sh || exit 1
+
+run_server() {
+    build_application/middlewaresw 10 --unix ${UNIX_PATH} "$@" > /dev/null 2>&1 &
+    SERVER_PID=$!
+    for _ in $(seq 1 50); do
+        [ -S ${UNIX_PATH} ] && return 0
+        sleep 0.1
+    done
+    echo "Server did not start."
+    kill ${SERVER_PID} 2>/dev/null
+    exit 1
+}
+
+stop_server() {
+    kill -INT ${SERVER_PID}
+    wait ${SERVER_PID}
+}
+
+LOADGEN="build_application/middlewaresw_loadgen --requests ${REQUESTS} --connections ${CONNECTIONS}"
+
+run_server
+${LOADGEN} --tcp 127.0.0.1:5555
+echo
+${LOADGEN} --unix ${UNIX_PATH}
+echo
+# The same requests through EngineClient, pipelined.
+${LOADGEN} --client --unix ${UNIX_PATH} --pipeline ${PIPELINE:-16}
+echo
+# Live round trips while clients export the stored history (see Bulk Lane).
+${LOADGEN} --tcp 127.0.0.1:5555 --exporters ${EXPORTERS:-4}
+stop_server
+echo
+
+run_server --seqpacket
+${LOADGEN} --unix ${UNIX_PATH} --seqpacket
+stop_server
+echo
+
+# Browser-like WebSocket subscribers on the HTTP gateway, all on one thread.
+run_server --http 18080 --max-clients 4096
+build_application/middlewaresw_loadgen --websocket --tcp 127.0.0.1:18080 --connections ${WS_CLIENTS:-2000} --requests 200
+stop_server
+echo
+
+# Reconnect storm: many clients reconnecting at once, first with the old accept
+# queue length of 3, then with the default profile.
+STORM="build_application/middlewaresw_loadgen --storm --connections ${STORM_CLIENTS:-256} --requests ${STORM_RECONNECTS:-10}"
+run_server --backlog 3
+${STORM}
+stop_server
+echo
+
+run_server
+${STORM}
+stop_server
@@ -28,6 +28,7 @@ make -j$(nproc)
 
 # Run tests
 ./test_coverage > /dev/null 2>&1
+./test_client_coverage > /dev/null 2>&1
 
 # Clean and explude test artifacts from coverage
 echo "Clean test artifacts folder: middlewaresw/tests..."
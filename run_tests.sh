@@ -2,14 +2,23 @@
 
 ./build.sh
 
-rm gtestresults.xml || true
+rm -f gtestresults.xml clientresults.xml
 
 ./build_application/tests/runUnitTests --gtest_output=xml:gtestresults.xml > /dev/null 2>&1
-if [ -f gtestresults.xml ]; then
-    total_tests=$(grep -o 'tests="[0-9]*"' gtestresults.xml | head -1 | grep -o '[0-9]*')
-    failures=$(grep -o 'failures="[0-9]*"' gtestresults.xml | head -1 | grep -o '[0-9]*')
-    disabled=$(grep -o 'disabled="[0-9]*"' gtestresults.xml | head -1 | grep -o '[0-9]*')
-    errors=$(grep -o 'errors="[0-9]*"' gtestresults.xml | head -1 | grep -o '[0-9]*')
+./build_application/tests/runClientTests --gtest_output=xml:clientresults.xml > /dev/null 2>&1
+if [ -f gtestresults.xml ] && [ -f clientresults.xml ]; then
+    # Sums an attribute of the root <testsuites> element of both reports.
+    attribute() {
+        local total=0
+        for report in gtestresults.xml clientresults.xml; do
+            total=$((total + $(grep -o "$1=\"[0-9]*\"" $report | head -1 | grep -o '[0-9]*')))
+        done
+        echo $total
+    }
+    total_tests=$(attribute tests)
+    failures=$(attribute failures)
+    disabled=$(attribute disabled)
+    errors=$(attribute errors)
 
     echo "Google Test Report:"
     echo "-------------------"
@@ -25,6 +34,6 @@ if [ -f gtestresults.xml ]; then
         echo "All tests passed."
     fi
 else
-    echo "gtestresults.xml not found."
+    echo "gtestresults.xml or clientresults.xml not found."
     exit 1
 fi
\ No newline at end of file
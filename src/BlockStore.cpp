@@ -0,0 +1,510 @@
+#include "BlockStore.h"
+#include <algorithm>
+#include <limits>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+// First byte of a signal column.
+enum ColumnMode : uint8_t {
+    kNonePresent = 0,
+    kAllPresent = 1,
+    kBitmap = 2,
+};
+
+// Differences are taken modulo 2^64, which zigzag and varint round-trip exactly.
+void appendVarint(std::string& out, int64_t value) {
+    uint64_t z = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    while (z >= 0x80) {
+        out.push_back(static_cast<char>(z | 0x80));
+        z >>= 7;
+    }
+    out.push_back(static_cast<char>(z));
+}
+
+struct Reader {
+    std::string_view data;
+    size_t pos = 0;
+
+    bool varint(int64_t& value) {
+        uint64_t z = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos == data.size())
+                return false;
+            const uint8_t byte = static_cast<uint8_t>(data[pos++]);
+            z |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                value = static_cast<int64_t>((z >> 1) ^ (~(z & 1) + 1));
+                return true;
+            }
+        }
+        return false;
+    }
+    bool finished() const { return pos == data.size(); }
+};
+
+int64_t wrappingSub(int64_t a, int64_t b) {
+    return static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+}
+
+int64_t wrappingAdd(int64_t a, int64_t b) {
+    return static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+}
+
+std::string_view columnBlob(sqlite3_stmt* stmt, int column) {
+    const void* data = sqlite3_column_blob(stmt, column);
+    const int bytes = sqlite3_column_bytes(stmt, column);
+    return data ? std::string_view(static_cast<const char*>(data), static_cast<size_t>(bytes)) : std::string_view();
+}
+
+} // namespace
+
+bool initBlockSchema(sqlite3* db) {
+    const std::string sql =
+        "CREATE TABLE IF NOT EXISTS engine_blocks ("
+        "id INTEGER PRIMARY KEY,"
+        "samples INTEGER NOT NULL,"
+        "start_ts INTEGER NOT NULL,"
+        "end_ts INTEGER NOT NULL,"
+        "timestamp BLOB NOT NULL," +
+        signalNames(" BLOB NOT NULL,") + " BLOB NOT NULL"
+        ");"
+        "CREATE INDEX IF NOT EXISTS idx_engine_blocks_end_ts ON engine_blocks(end_ts);";
+    char* err_msg = nullptr;
+    if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &err_msg) != SQLITE_OK) {
+        spdlog::error("Failed to create engine_blocks: {}", err_msg ? err_msg : "unknown");
+        sqlite3_free(err_msg);
+        return false;
+    }
+    return true;
+}
+
+void encodeBlock(const StoredSample* samples, size_t count, EncodedBlock& out) {
+    out.timestamps.clear();
+    out.start_ts = count > 0 ? samples[0].timestamp_ms : 0;
+    out.end_ts = out.start_ts;
+    int64_t previous = 0;
+    int64_t previous_delta = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t ts = samples[i].timestamp_ms;
+        out.start_ts = std::min(out.start_ts, ts);
+        out.end_ts = std::max(out.end_ts, ts);
+        if (i == 0) {
+            appendVarint(out.timestamps, ts);
+        } else {
+            const int64_t delta = wrappingSub(ts, previous);
+            appendVarint(out.timestamps, wrappingSub(delta, previous_delta));
+            previous_delta = delta;
+        }
+        previous = ts;
+    }
+
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        std::string& column = out.signals[s];
+        column.clear();
+        const uint8_t bit = static_cast<uint8_t>(1u << s);
+        size_t present = 0;
+        for (size_t i = 0; i < count; ++i)
+            present += (samples[i].present & bit) != 0;
+        if (present == 0) {
+            column.push_back(static_cast<char>(kNonePresent));
+            continue;
+        }
+        if (present == count) {
+            column.push_back(static_cast<char>(kAllPresent));
+        } else {
+            column.push_back(static_cast<char>(kBitmap));
+            const size_t offset = column.size();
+            column.resize(offset + (count + 7) / 8, '\0');
+            for (size_t i = 0; i < count; ++i) {
+                if (samples[i].present & bit)
+                    column[offset + i / 8] = static_cast<char>(column[offset + i / 8] | (1 << (i % 8)));
+            }
+        }
+        int64_t last = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (samples[i].present & bit) {
+                const int64_t value = signalValue(samples[i].values, s);
+                appendVarint(column, value - last);
+                last = value;
+            }
+        }
+    }
+}
+
+bool decodeBlock(int64_t first_id, size_t count, std::string_view timestamps,
+                 const std::array<std::string_view, kSignalCount>& signals, std::vector<StoredSample>& out) {
+    out.assign(count, StoredSample{});
+    Reader ts{timestamps};
+    int64_t previous = 0;
+    int64_t previous_delta = 0;
+    for (size_t i = 0; i < count; ++i) {
+        int64_t value;
+        if (!ts.varint(value))
+            return false;
+        if (i == 0) {
+            previous = value;
+        } else {
+            previous_delta = wrappingAdd(previous_delta, value);
+            previous = wrappingAdd(previous, previous_delta);
+        }
+        out[i].id = first_id + static_cast<int64_t>(i);
+        out[i].timestamp_ms = previous;
+    }
+    if (!ts.finished())
+        return false;
+
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        const std::string_view column = signals[s];
+        if (column.empty())
+            return false;
+        const uint8_t mode = static_cast<uint8_t>(column[0]);
+        Reader values{column, 1};
+        std::string_view bitmap;
+        if (mode == kNonePresent) {
+            if (!values.finished())
+                return false;
+            continue;
+        } else if (mode == kBitmap) {
+            const size_t bytes = (count + 7) / 8;
+            if (column.size() < 1 + bytes)
+                return false;
+            bitmap = column.substr(1, bytes);
+            values.pos += bytes;
+        } else if (mode != kAllPresent) {
+            return false;
+        }
+        const uint8_t bit = static_cast<uint8_t>(1u << s);
+        int64_t last = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (mode == kBitmap && !(static_cast<uint8_t>(bitmap[i / 8]) & (1u << (i % 8))))
+                continue;
+            int64_t delta;
+            if (!values.varint(delta))
+                return false;
+            last = wrappingAdd(last, delta);
+            signalValue(out[i].values, s) = static_cast<int>(last);
+            out[i].present |= bit;
+        }
+        if (!values.finished())
+            return false;
+    }
+    return true;
+}
+
+BlockWriter::~BlockWriter() {
+    close();
+}
+
+bool BlockWriter::open(sqlite3* db, size_t block_rows, int64_t block_ms) {
+    close();
+    if (!db || block_rows == 0 || !initBlockSchema(db))
+        return false;
+
+    // Blocks continue after the last id of either layout.
+    sqlite3_stmt* stmt = nullptr;
+    const char* next_id_sql =
+        "SELECT MAX(IFNULL((SELECT seq FROM sqlite_sequence WHERE name = 'engine_values'), 0), "
+        "IFNULL((SELECT id + samples - 1 FROM engine_blocks ORDER BY id DESC LIMIT 1), 0));";
+    if (sqlite3_prepare_v2(db, next_id_sql, -1, &stmt, nullptr) != SQLITE_OK || sqlite3_step(stmt) != SQLITE_ROW) {
+        spdlog::error("Failed to read the sample id sequence: {}", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return false;
+    }
+    next_id = sqlite3_column_int64(stmt, 0) + 1;
+    sqlite3_finalize(stmt);
+
+    std::string insert_sql = "INSERT INTO engine_blocks (id, samples, start_ts, end_ts, timestamp, " + signalNames() +
+                             ") VALUES (?, ?, ?, ?, ?";
+    for (size_t i = 0; i < kSignalCount; ++i)
+        insert_sql += ", ?";
+    insert_sql += ");";
+    if (sqlite3_prepare_v2(db, insert_sql.c_str(), -1, &insert_stmt, nullptr) != SQLITE_OK ||
+        sqlite3_prepare_v2(db, "UPDATE sqlite_sequence SET seq = ? WHERE name = 'engine_values';", -1,
+                           &sequence_stmt, nullptr) != SQLITE_OK) {
+        spdlog::error("Failed to prepare block statements: {}", sqlite3_errmsg(db));
+        sqlite3_finalize(insert_stmt);
+        insert_stmt = nullptr;
+        return false;
+    }
+    this->db = db;
+    this->block_rows = block_rows;
+    this->block_ms = block_ms;
+    samples.clear();
+    samples.reserve(block_rows);
+    blocks = 0;
+    return true;
+}
+
+void BlockWriter::close() {
+    if (!isOpen())
+        return;
+    flush();
+    sqlite3_finalize(insert_stmt);
+    sqlite3_finalize(sequence_stmt);
+    insert_stmt = nullptr;
+    sequence_stmt = nullptr;
+    db = nullptr;
+}
+
+void BlockWriter::add(int64_t timestamp_ms, const EngineSample& values, uint8_t present) {
+    if (!samples.empty() && block_ms > 0 && timestamp_ms - samples.front().timestamp_ms >= block_ms)
+        flush();
+    StoredSample& sample = samples.emplace_back();
+    sample.id = next_id + static_cast<int64_t>(samples.size()) - 1;
+    sample.timestamp_ms = timestamp_ms;
+    sample.values = values;
+    sample.present = present;
+    if (samples.size() >= block_rows)
+        flush();
+}
+
+bool BlockWriter::flush() {
+    if (samples.empty() || !isOpen())
+        return true;
+    encodeBlock(samples.data(), samples.size(), encoded);
+    const int64_t last_id = next_id + static_cast<int64_t>(samples.size()) - 1;
+
+    sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr);
+    sqlite3_bind_int64(insert_stmt, 1, next_id);
+    sqlite3_bind_int64(insert_stmt, 2, static_cast<sqlite3_int64>(samples.size()));
+    sqlite3_bind_int64(insert_stmt, 3, encoded.start_ts);
+    sqlite3_bind_int64(insert_stmt, 4, encoded.end_ts);
+    sqlite3_bind_blob(insert_stmt, 5, encoded.timestamps.data(), static_cast<int>(encoded.timestamps.size()),
+                      SQLITE_STATIC);
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        sqlite3_bind_blob(insert_stmt, 6 + static_cast<int>(s), encoded.signals[s].data(),
+                          static_cast<int>(encoded.signals[s].size()), SQLITE_STATIC);
+    }
+    bool ok = sqlite3_step(insert_stmt) == SQLITE_DONE;
+    sqlite3_reset(insert_stmt);
+    if (ok) {
+        sqlite3_bind_int64(sequence_stmt, 1, last_id);
+        ok = sqlite3_step(sequence_stmt) == SQLITE_DONE;
+        sqlite3_reset(sequence_stmt);
+        // engine_values has no sequence entry until its first insert.
+        if (ok && sqlite3_changes(db) == 0) {
+            const std::string sql =
+                "INSERT INTO sqlite_sequence (name, seq) VALUES ('engine_values', " + std::to_string(last_id) + ");";
+            ok = sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK;
+        }
+    }
+    if (ok) {
+        sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+        ++blocks;
+    } else {
+        spdlog::error("Failed to write sample block: {}", sqlite3_errmsg(db));
+        sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+    }
+    // A failed block is dropped like a failed row insert; its ids are not reused.
+    next_id = last_id + 1;
+    samples.clear();
+    return ok;
+}
+
+BlockCursor::~BlockCursor() {
+    close();
+}
+
+bool BlockCursor::open(sqlite3* db, bool descending) {
+    close();
+    // Ascending, the scan starts at the block holding the sample after `id`.
+    static const std::string columns = "SELECT id, samples, timestamp, " + signalNames() + " FROM engine_blocks ";
+    static const std::string ascending_sql =
+        columns +
+        "WHERE id >= IFNULL((SELECT MAX(id) FROM engine_blocks WHERE id <= ?1), ?1) "
+        "AND end_ts >= ?2 AND start_ts < ?3 ORDER BY id;";
+    static const std::string descending_sql =
+        columns + "WHERE id < ?1 AND end_ts >= ?2 AND start_ts < ?3 ORDER BY id DESC;";
+    const std::string& sql = descending ? descending_sql : ascending_sql;
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        stmt = nullptr;
+        return false;
+    }
+    this->db = db;
+    this->descending = descending;
+    stepping = false;
+    error = false;
+    return true;
+}
+
+void BlockCursor::close() {
+    if (stmt)
+        sqlite3_finalize(stmt);
+    stmt = nullptr;
+    db = nullptr;
+}
+
+void BlockCursor::seek(int64_t id, int64_t from_ms, int64_t to_ms) {
+    if (stmt)
+        sqlite3_reset(stmt);
+    stepping = false;
+    error = false;
+    this->id = id;
+    this->from_ms = from_ms;
+    this->to_ms = to_ms;
+}
+
+bool BlockCursor::next(std::vector<StoredSample>& out) {
+    if (!stmt || error)
+        return false;
+    if (!stepping) {
+        sqlite3_bind_int64(stmt, 1, id);
+        sqlite3_bind_int64(stmt, 2, from_ms);
+        sqlite3_bind_int64(stmt, 3, to_ms);
+        stepping = true;
+    }
+    for (;;) {
+        const int rc = sqlite3_step(stmt);
+        if (rc == SQLITE_DONE)
+            return false;
+        if (rc != SQLITE_ROW) {
+            spdlog::error("Block query failed: {}", sqlite3_errmsg(db));
+            error = true;
+            return false;
+        }
+        const int64_t first_id = sqlite3_column_int64(stmt, 0);
+        const int64_t count = sqlite3_column_int64(stmt, 1);
+        std::array<std::string_view, kSignalCount> signals;
+        for (size_t s = 0; s < kSignalCount; ++s)
+            signals[s] = columnBlob(stmt, 3 + static_cast<int>(s));
+        if (count < 0 || !decodeBlock(first_id, static_cast<size_t>(count), columnBlob(stmt, 2), signals, out)) {
+            spdlog::error("Sample block {} is malformed", first_id);
+            error = true;
+            return false;
+        }
+        out.erase(std::remove_if(out.begin(), out.end(),
+                                 [this](const StoredSample& s) {
+                                     return (descending ? s.id >= id : s.id <= id) || s.timestamp_ms < from_ms ||
+                                            s.timestamp_ms >= to_ms;
+                                 }),
+                  out.end());
+        if (descending)
+            std::reverse(out.begin(), out.end());
+        if (!out.empty())
+            return true;
+    }
+}
+
+SampleScan::~SampleScan() {
+    close();
+}
+
+bool SampleScan::open(sqlite3* db, bool descending) {
+    close();
+    static const std::string columns = "SELECT id, timestamp, " + signalNames() + " FROM engine_values ";
+    static const std::string ascending_sql =
+        columns + "WHERE id > ? AND timestamp >= ? AND timestamp < ? ORDER BY id;";
+    static const std::string descending_sql =
+        columns + "WHERE id < ? AND timestamp >= ? AND timestamp < ? ORDER BY id DESC;";
+    if (sqlite3_prepare_v2(db, (descending ? descending_sql : ascending_sql).c_str(), -1, &rows_stmt, nullptr) !=
+        SQLITE_OK) {
+        rows_stmt = nullptr;
+        return false;
+    }
+    // Databases that never stored blocks have no engine_blocks table.
+    blocks.open(db, descending);
+    this->db = db;
+    this->descending = descending;
+    seek(descending ? std::numeric_limits<int64_t>::max() : 0, std::numeric_limits<int64_t>::min(),
+         std::numeric_limits<int64_t>::max());
+    return true;
+}
+
+void SampleScan::close() {
+    if (rows_stmt)
+        sqlite3_finalize(rows_stmt);
+    rows_stmt = nullptr;
+    blocks.close();
+    db = nullptr;
+}
+
+void SampleScan::seek(int64_t id, int64_t from_ms, int64_t to_ms) {
+    if (rows_stmt)
+        sqlite3_reset(rows_stmt);
+    blocks.seek(id, from_ms, to_ms);
+    last_id = id;
+    this->from_ms = from_ms;
+    this->to_ms = to_ms;
+    error = false;
+    rows_stepping = false;
+    rows_done = false;
+    has_row = false;
+    blocks_done = !blocks.isOpen();
+    block.clear();
+    block_pos = 0;
+}
+
+void SampleScan::pause() {
+    // Read-ahead is dropped and read again after the last sample returned.
+    seek(last_id, from_ms, to_ms);
+}
+
+bool SampleScan::fillRow() {
+    if (!rows_stepping) {
+        sqlite3_bind_int64(rows_stmt, 1, last_id);
+        sqlite3_bind_int64(rows_stmt, 2, from_ms);
+        sqlite3_bind_int64(rows_stmt, 3, to_ms);
+        rows_stepping = true;
+    }
+    const int rc = sqlite3_step(rows_stmt);
+    if (rc == SQLITE_DONE) {
+        rows_done = true;
+        return true;
+    }
+    if (rc != SQLITE_ROW) {
+        spdlog::error("Sample query failed: {}", sqlite3_errmsg(db));
+        return false;
+    }
+    row.id = sqlite3_column_int64(rows_stmt, 0);
+    row.timestamp_ms = sqlite3_column_int64(rows_stmt, 1);
+    row.present = 0;
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        const int column = 2 + static_cast<int>(s);
+        // NULL: the signal was not sampled in this row (multi-rate sampling).
+        if (sqlite3_column_type(rows_stmt, column) == SQLITE_NULL) {
+            signalValue(row.values, s) = 0;
+        } else {
+            signalValue(row.values, s) = sqlite3_column_int(rows_stmt, column);
+            row.present |= static_cast<uint8_t>(1u << s);
+        }
+    }
+    has_row = true;
+    return true;
+}
+
+bool SampleScan::fillBlock() {
+    block_pos = 0;
+    if (!blocks.next(block)) {
+        block.clear();
+        blocks_done = true;
+        return !blocks.failed();
+    }
+    return true;
+}
+
+bool SampleScan::next(StoredSample& out) {
+    if (!rows_stmt || error)
+        return false;
+    if (!has_row && !rows_done && !fillRow()) {
+        error = true;
+        return false;
+    }
+    if (block_pos == block.size() && !blocks_done && !fillBlock()) {
+        error = true;
+        return false;
+    }
+    const bool have_block = block_pos < block.size();
+    if (!has_row && !have_block)
+        return false;
+    const bool take_row =
+        has_row && (!have_block || (descending ? row.id > block[block_pos].id : row.id < block[block_pos].id));
+    if (take_row) {
+        out = row;
+        has_row = false;
+    } else {
+        out = block[block_pos++];
+    }
+    last_id = out.id;
+    return true;
+}
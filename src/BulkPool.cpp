@@ -0,0 +1,84 @@
+#include "BulkPool.h"
+#include <cerrno>
+#include <cstring>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <spdlog/spdlog.h>
+#include "Trace.h"
+
+BulkPool::~BulkPool() {
+    stop();
+}
+
+void BulkPool::start(size_t worker_count, size_t max_jobs, int worker_nice, std::function<void()> notify) {
+    stop();
+    this->max_jobs = max_jobs;
+    this->notify = std::move(notify);
+    stopping = false;
+    for (size_t i = 0; i < worker_count; ++i)
+        workers.emplace_back(&BulkPool::workerLoop, this, worker_nice);
+}
+
+void BulkPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    ready.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+    workers.clear();
+    queue.clear();
+    admitted_ = 0;
+}
+
+bool BulkPool::admit() {
+    size_t admitted = admitted_.load(std::memory_order_relaxed);
+    do {
+        if (admitted >= max_jobs)
+            return false;
+    } while (!admitted_.compare_exchange_weak(admitted, admitted + 1, std::memory_order_relaxed));
+    return true;
+}
+
+void BulkPool::retire() {
+    admitted_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void BulkPool::submit(std::shared_ptr<BulkJob> job) {
+    job->ready_.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(job));
+    }
+    ready.notify_one();
+}
+
+void BulkPool::workerLoop(int nice) {
+    Trace::setThreadName("bulk");
+    // Linux applies nice values per thread.
+    if (nice != 0 && setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nice) != 0)
+        spdlog::warn("Could not lower bulk worker priority: {}", std::strerror(errno));
+    for (;;) {
+        std::shared_ptr<BulkJob> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ready.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (stopping)
+                return;
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+        if (job->cancelled())
+            continue;
+        {
+            TraceScope span("bulk step");
+            job->step();
+        }
+        steps_.fetch_add(1, std::memory_order_relaxed);
+        job->ready_.store(true, std::memory_order_release);
+        if (notify)
+            notify();
+    }
+}
@@ -0,0 +1,480 @@
+#include "Compression.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <utility>
+#include <sqlite3.h>
+#include <spdlog/spdlog.h>
+#include "BlockStore.h"
+#include "PartitionedStore.h"
+
+SignalCompressor::SignalCompressor(const SignalCompression& config, int64_t max_silence_ms)
+    : config(config), max_silence_ms(max_silence_ms) {}
+
+void SignalCompressor::archive(const StoredPoint& point) {
+    archived = point;
+    has_archived = true;
+    has_pending = false;
+}
+
+size_t SignalCompressor::offer(int64_t timestamp_ms, int value, StoredPoint* out) {
+    const StoredPoint point{timestamp_ms, value};
+    size_t n = 0;
+    if (config.mode == CompressionMode::None || !has_archived) {
+        archive(point);
+        out[n++] = point;
+        return n;
+    }
+    bool silent = max_silence_ms > 0 && timestamp_ms - archived.timestamp_ms >= max_silence_ms;
+
+    if (config.mode == CompressionMode::Deadband) {
+        if (silent && has_pending) {
+            // Heartbeat: store the unchanged value at the previous sample.
+            out[n++] = StoredPoint{pending.timestamp_ms, archived.value};
+            archived.timestamp_ms = pending.timestamp_ms;
+            has_pending = false;
+            silent = timestamp_ms - archived.timestamp_ms >= max_silence_ms;
+        }
+        if (silent || std::abs(static_cast<double>(value) - archived.value) > config.deviation) {
+            if (has_pending)
+                out[n++] = StoredPoint{pending.timestamp_ms, archived.value};
+            archive(point);
+            out[n++] = point;
+            return n;
+        }
+        pending = point;
+        has_pending = true;
+        return n;
+    }
+
+    // Swinging door.
+    if (!has_pending) {
+        if (silent) {
+            archive(point);
+            out[n++] = point;
+            return n;
+        }
+    } else {
+        const double slope = (value - archived.value) / static_cast<double>(timestamp_ms - archived.timestamp_ms);
+        if (!silent && slope >= slope_low && slope <= slope_high) {
+            // The line from the archived point to this sample still passes every sample
+            // in between: it replaces the pending one.
+            const double dt = static_cast<double>(timestamp_ms - archived.timestamp_ms);
+            slope_low = std::max(slope_low, (value - config.deviation - archived.value) / dt);
+            slope_high = std::min(slope_high, (value + config.deviation - archived.value) / dt);
+            pending = point;
+            return n;
+        }
+        // The door closed (or the heartbeat is due): the pending sample ends the line.
+        out[n++] = pending;
+        archive(pending);
+    }
+    const double dt = static_cast<double>(timestamp_ms - archived.timestamp_ms);
+    slope_low = (value - config.deviation - archived.value) / dt;
+    slope_high = (value + config.deviation - archived.value) / dt;
+    pending = point;
+    has_pending = true;
+    return n;
+}
+
+size_t SignalCompressor::flush(StoredPoint* out) {
+    if (!has_pending)
+        return 0;
+    // A deadband sample that was held back did not move far enough to matter.
+    const StoredPoint point = config.mode == CompressionMode::Deadband
+        ? StoredPoint{pending.timestamp_ms, archived.value}
+        : pending;
+    archive(point);
+    out[0] = point;
+    return 1;
+}
+
+SampleCompressor::SampleCompressor(const CompressionConfig& config) : active(config.enabled()) {
+    for (size_t i = 0; i < kSignalCount; ++i)
+        signals[i] = SignalCompressor(config.signals[i], config.max_silence_ms);
+}
+
+void SampleCompressor::offer(const EngineSnapshot& snapshot, std::vector<CompressedRow>& rows) {
+    StoredPoint points[kSignalCount * SignalCompressor::kMaxPoints];
+    size_t counts[kSignalCount] = {};
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        if (snapshot.fresh & (1u << i)) {
+            ++values_offered;
+            counts[i] = signals[i].offer(snapshot.timestamp_ms, signalValue(snapshot.values, i),
+                                         points + i * SignalCompressor::kMaxPoints);
+        }
+    }
+    group(points, counts, rows);
+}
+
+void SampleCompressor::flush(std::vector<CompressedRow>& rows) {
+    StoredPoint points[kSignalCount * SignalCompressor::kMaxPoints];
+    size_t counts[kSignalCount] = {};
+    for (size_t i = 0; i < kSignalCount; ++i)
+        counts[i] = signals[i].flush(points + i * SignalCompressor::kMaxPoints);
+    group(points, counts, rows);
+}
+
+// Merges the points of all signals into rows, one per distinct timestamp.
+void SampleCompressor::group(const StoredPoint* points, const size_t* counts, std::vector<CompressedRow>& rows) {
+    // Each signal's points are in timestamp order: merge the runs, one row per timestamp.
+    size_t next[kSignalCount] = {};
+    for (;;) {
+        bool any = false;
+        int64_t timestamp_ms = 0;
+        for (size_t i = 0; i < kSignalCount; ++i) {
+            if (next[i] < counts[i]) {
+                const int64_t t = points[i * SignalCompressor::kMaxPoints + next[i]].timestamp_ms;
+                if (!any || t < timestamp_ms)
+                    timestamp_ms = t;
+                any = true;
+            }
+        }
+        if (!any)
+            return;
+        CompressedRow& row = rows.emplace_back();
+        row.timestamp_ms = timestamp_ms;
+        for (size_t i = 0; i < kSignalCount; ++i) {
+            for (; next[i] < counts[i]; ++next[i]) {
+                const StoredPoint& point = points[i * SignalCompressor::kMaxPoints + next[i]];
+                if (point.timestamp_ms != timestamp_ms)
+                    break;
+                signalValue(row.values, i) = point.value;
+                row.fresh |= static_cast<uint8_t>(1u << i);
+                ++values_stored;
+            }
+        }
+    }
+}
+
+namespace {
+
+sqlite3* openReadOnly(const std::string& path) {
+    sqlite3* db = nullptr;
+    if (sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        spdlog::error("Cannot open database {} for reading: {}", path, sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return nullptr;
+    }
+    sqlite3_busy_timeout(db, 1000);
+    return db;
+}
+
+} // namespace
+
+// The stored values of one signal, read one database after another in (timestamp, id)
+// order from engine_values merged with the samples of engine_blocks in id order, and
+// the two around the current time.
+struct HistoryInterpolator::Track {
+    size_t signal = 0;
+    const std::vector<std::string>* databases = nullptr;
+    size_t database = 0;
+    sqlite3* db = nullptr;
+    sqlite3_stmt* stmt = nullptr;
+    bool stepping = false;
+    // Rows are read after this (timestamp, id), which is the next row when has_row.
+    int64_t resume_timestamp = std::numeric_limits<int64_t>::min();
+    int64_t resume_id = std::numeric_limits<int64_t>::min();
+    bool rows_done = false;
+    bool has_row = false;
+    StoredPoint row;
+    // Blocks are read after the sample with this id; `block` holds those decoded
+    // but not returned yet from block_pos on.
+    BlockCursor blocks;
+    int64_t block_resume_id = std::numeric_limits<int64_t>::min();
+    bool blocks_done = false;
+    std::vector<StoredSample> block;
+    size_t block_pos = 0;
+    bool has_before = false;
+    StoredPoint before;
+    bool has_after = false;
+    StoredPoint after;
+
+    ~Track() { closeDatabase(); }
+
+    bool openDatabase() {
+        db = openReadOnly((*databases)[database]);
+        if (!db)
+            return false;
+        const std::string column = kSignalFields[signal].name;
+        const std::string sql = "SELECT timestamp, id, " + column + " FROM engine_values WHERE " + column +
+            " IS NOT NULL AND (timestamp, id) > (?, ?) ORDER BY timestamp, id;";
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+            spdlog::error("Failed to prepare interpolation statement: {}", sqlite3_errmsg(db));
+            closeDatabase();
+            return false;
+        }
+        stepping = false;
+        rows_done = false;
+        has_row = false;
+        // Databases that never stored blocks have no engine_blocks table.
+        blocks_done = !blocks.open(db);
+        blocks.seek(block_resume_id, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+        block.clear();
+        block_pos = 0;
+        return true;
+    }
+
+    void closeDatabase() {
+        blocks.close();
+        if (stmt) {
+            sqlite3_finalize(stmt);
+            stmt = nullptr;
+        }
+        if (db) {
+            sqlite3_close(db);
+            db = nullptr;
+        }
+    }
+
+    // Finds the last stored value at or before `from_ms` and starts reading there.
+    bool seek(int64_t from_ms, const std::vector<PartitionInfo>& ranges) {
+        const std::string column = kSignalFields[signal].name;
+        const std::string sql = "SELECT timestamp, id FROM engine_values WHERE " + column +
+            " IS NOT NULL AND timestamp <= ? ORDER BY timestamp DESC, id DESC LIMIT 1;";
+        const int64_t to_ms = from_ms == std::numeric_limits<int64_t>::max() ? from_ms : from_ms + 1;
+        database = 0;
+        for (size_t i = ranges.size(); i-- > 0;) {
+            if (ranges[i].start_ms > from_ms)
+                continue;
+            sqlite3* seek_db = openReadOnly(ranges[i].path);
+            if (!seek_db)
+                return false;
+            sqlite3_stmt* seek_stmt = nullptr;
+            bool found = false;
+            int64_t found_timestamp = 0;
+            int64_t found_id = 0;
+            if (sqlite3_prepare_v2(seek_db, sql.c_str(), -1, &seek_stmt, nullptr) == SQLITE_OK) {
+                sqlite3_bind_int64(seek_stmt, 1, from_ms);
+                if (sqlite3_step(seek_stmt) == SQLITE_ROW) {
+                    found = true;
+                    found_timestamp = sqlite3_column_int64(seek_stmt, 0);
+                    found_id = sqlite3_column_int64(seek_stmt, 1);
+                }
+                sqlite3_finalize(seek_stmt);
+            }
+            // The newest block sample holding the signal, if later than the row.
+            BlockCursor seek_blocks;
+            bool block_found = false;
+            if (seek_blocks.open(seek_db, true)) {
+                seek_blocks.seek(std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min(), to_ms);
+                while (!block_found && seek_blocks.next(block)) {
+                    for (const StoredSample& sample : block) {
+                        if (sample.present & (1u << signal)) {
+                            block_found = true;
+                            if (!found || std::pair(sample.timestamp_ms, sample.id) > std::pair(found_timestamp, found_id)) {
+                                found = true;
+                                found_timestamp = sample.timestamp_ms;
+                                found_id = sample.id;
+                            }
+                            break;
+                        }
+                    }
+                }
+                block.clear();
+                if (seek_blocks.failed()) {
+                    seek_blocks.close();
+                    sqlite3_close(seek_db);
+                    return false;
+                }
+                seek_blocks.close();
+            }
+            sqlite3_close(seek_db);
+            if (found) {
+                database = i;
+                // Resume just before the sample so the first read returns it.
+                resume_timestamp = found_timestamp;
+                resume_id = found_id - 1;
+                block_resume_id = found_id - 1;
+                break;
+            }
+        }
+        return fetch(has_after, after);
+    }
+
+    bool fillRow() {
+        if (!stepping) {
+            sqlite3_bind_int64(stmt, 1, resume_timestamp);
+            sqlite3_bind_int64(stmt, 2, resume_id);
+            stepping = true;
+        }
+        const int rc = sqlite3_step(stmt);
+        if (rc == SQLITE_DONE) {
+            rows_done = true;
+            return true;
+        }
+        if (rc != SQLITE_ROW) {
+            spdlog::error("Interpolation query failed: {}", sqlite3_errmsg(db));
+            return false;
+        }
+        row.timestamp_ms = sqlite3_column_int64(stmt, 0);
+        row.value = sqlite3_column_int(stmt, 2);
+        resume_timestamp = row.timestamp_ms;
+        resume_id = sqlite3_column_int64(stmt, 1);
+        has_row = true;
+        return true;
+    }
+
+    // Moves block_pos to the next block sample holding the signal, reading blocks as
+    // needed. It is past the end of `block` once the blocks are exhausted.
+    bool fillBlock() {
+        for (;;) {
+            for (; block_pos < block.size(); ++block_pos) {
+                if (block[block_pos].present & (1u << signal))
+                    return true;
+            }
+            if (blocks_done)
+                return true;
+            block_pos = 0;
+            if (!blocks.next(block)) {
+                block.clear();
+                blocks_done = true;
+                return !blocks.failed();
+            }
+            block_resume_id = block.back().id;
+        }
+    }
+
+    // Reads the next stored value. `found` is false once every database is exhausted.
+    bool fetch(bool& found, StoredPoint& point) {
+        found = false;
+        while (database < databases->size()) {
+            if (!db && !openDatabase())
+                return false;
+            if (!has_row && !rows_done && !fillRow())
+                return false;
+            if (!fillBlock())
+                return false;
+            const bool have_block = block_pos < block.size();
+            if (has_row || have_block) {
+                if (has_row && (!have_block || std::pair(row.timestamp_ms, resume_id) <
+                                                   std::pair(block[block_pos].timestamp_ms, block[block_pos].id))) {
+                    point = row;
+                    has_row = false;
+                } else {
+                    point.timestamp_ms = block[block_pos].timestamp_ms;
+                    point.value = signalValue(block[block_pos].values, signal);
+                    ++block_pos;
+                }
+                found = true;
+                return true;
+            }
+            closeDatabase();
+            ++database;
+            resume_timestamp = std::numeric_limits<int64_t>::min();
+            resume_id = std::numeric_limits<int64_t>::min();
+            block_resume_id = std::numeric_limits<int64_t>::min();
+        }
+        return true;
+    }
+
+    bool advance(int64_t timestamp_ms) {
+        while (has_after && after.timestamp_ms <= timestamp_ms) {
+            before = after;
+            has_before = true;
+            if (!fetch(has_after, after))
+                return false;
+        }
+        return true;
+    }
+
+    // The row and block samples already read stay; reading continues after them.
+    void pause() {
+        if (stmt) {
+            sqlite3_reset(stmt);
+            stepping = false;
+        }
+        if (blocks.isOpen())
+            blocks.seek(block_resume_id, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+    }
+};
+
+HistoryInterpolator::HistoryInterpolator() = default;
+
+HistoryInterpolator::~HistoryInterpolator() {
+    close();
+}
+
+bool HistoryInterpolator::open(const std::string& storage, int64_t from_ms) {
+    close();
+    std::vector<PartitionInfo> ranges;
+    std::error_code ec;
+    if (std::filesystem::is_directory(storage, ec)) {
+        ranges = PartitionedStore::list(storage);
+    } else {
+        ranges.push_back(PartitionInfo{storage, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()});
+    }
+
+    for (const PartitionInfo& range : ranges) {
+        sqlite3* db = openReadOnly(range.path);
+        if (!db)
+            return false;
+        databases.push_back(range.path);
+        // Databases that never stored blocks fail the second statement.
+        for (const char* sql : {"SELECT MIN(timestamp), MAX(timestamp) FROM engine_values;",
+                                "SELECT MIN(start_ts), MAX(end_ts) FROM engine_blocks;"}) {
+            sqlite3_stmt* stmt = nullptr;
+            if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) == SQLITE_OK && sqlite3_step(stmt) == SQLITE_ROW &&
+                sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+                const int64_t first = sqlite3_column_int64(stmt, 0);
+                const int64_t last = sqlite3_column_int64(stmt, 1);
+                first_ms = has_rows ? std::min(first_ms, first) : first;
+                last_ms = has_rows ? std::max(last_ms, last) : last;
+                has_rows = true;
+            }
+            sqlite3_finalize(stmt);
+        }
+        sqlite3_close(db);
+    }
+
+    tracks = std::make_unique<Track[]>(kSignalCount);
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        tracks[i].signal = i;
+        tracks[i].databases = &databases;
+        if (!tracks[i].seek(from_ms, ranges)) {
+            close();
+            return false;
+        }
+    }
+    pause();
+    return true;
+}
+
+void HistoryInterpolator::close() {
+    tracks.reset();
+    databases.clear();
+    has_rows = false;
+    first_ms = 0;
+    last_ms = 0;
+}
+
+bool HistoryInterpolator::at(int64_t timestamp_ms, EngineSample& values, uint8_t& known) {
+    values = EngineSample{};
+    known = 0;
+    if (!tracks)
+        return false;
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        Track& track = tracks[i];
+        if (!track.advance(timestamp_ms))
+            return false;
+        if (!track.has_before)
+            continue;
+        double value = track.before.value;
+        if (track.has_after) {
+            const double fraction = static_cast<double>(timestamp_ms - track.before.timestamp_ms) /
+                static_cast<double>(track.after.timestamp_ms - track.before.timestamp_ms);
+            value += (track.after.value - track.before.value) * fraction;
+        }
+        signalValue(values, i) = static_cast<int>(std::lround(value));
+        known |= static_cast<uint8_t>(1u << i);
+    }
+    return true;
+}
+
+void HistoryInterpolator::pause() {
+    if (!tracks)
+        return;
+    for (size_t i = 0; i < kSignalCount; ++i)
+        tracks[i].pause();
+}
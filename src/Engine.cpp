@@ -1,7 +1,12 @@
 #include "Engine.h"
+#include "Compression.h"
+#include <cerrno>
 #include <chrono>
 #include <spdlog/spdlog.h>
 #include <cstring>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
 #include <set>
 #include <vector>
 
@@ -17,43 +22,103 @@ EngineImpl::EngineImpl(const std::string& db_path) : db(nullptr) {
     initDatabase(db_path);
 }
 
+EngineImpl::EngineImpl(const StorageConfig& config) : db(nullptr) {
+    if (config.partitioning == Partitioning::None) {
+        if (writer_lock.acquire(config.path, false))
+            initDatabase(config.path);
+        else
+            spdlog::error("{} is locked by an import; samples are not stored", config.path);
+        if (db && config.block_rows > 0 && !blocks.open(db, config.block_rows, config.block_ms))
+            spdlog::warn("Storing one row per sample instead of blocks");
+    } else if (partitions.open(config.path, config.partitioning)) {
+        retention_ms = config.retention_ms;
+        applyRetention(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+    if (config.partitioning != Partitioning::None && config.block_rows > 0)
+        spdlog::warn("Blocked storage needs a single database file; storing one row per sample");
+    enableCompression(config.compression);
+}
+
 EngineImpl::~EngineImpl() {
+    // Store the samples compression still holds back.
+    if (compressor) {
+        compressed_rows.clear();
+        compressor->flush(compressed_rows);
+        for (const CompressedRow& row : compressed_rows) {
+            insertRow(row.timestamp_ms, row.values, row.fresh);
+        }
+        spdlog::info("Compression stored {} of {} signal values", compressor->stored(), compressor->offered());
+    }
+    // Writes the last, partly filled block before the database closes.
+    blocks.close();
     if (db) {
         sqlite3_close(db);
         db = nullptr;
     }
 }
 
-void EngineImpl::initDatabase(const std::string& db_path) {
-    int rc = sqlite3_open(db_path.c_str(), &db);
-    if (rc != SQLITE_OK) {
-        spdlog::error("Cannot open database: {}", sqlite3_errmsg(db));
-        sqlite3_close(db);
-        db = nullptr;
-        return;
+WriterLock::~WriterLock() {
+    if (fd >= 0) {
+        flock(fd, LOCK_UN);
+        ::close(fd);
     }
+}
 
-    const char* create_table_sql = 
+bool WriterLock::acquire(const std::string& db_path, bool exclusive) {
+    const std::string path = db_path + "-lock";
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        spdlog::warn("Cannot open lock file {}: {}", path, std::strerror(errno));
+        return true;
+    }
+    if (flock(fd, (exclusive ? LOCK_EX : LOCK_SH) | LOCK_NB) != 0) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+    return true;
+}
+
+// "?, " once per signal.
+static std::string signalPlaceholders() {
+    std::string out;
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        out += "?, ";
+    }
+    return out;
+}
+
+const std::string& engineValuesInsertSql() {
+    static const std::string sql =
+        "INSERT INTO engine_values (" + signalNames() + ", timestamp) VALUES (" + signalPlaceholders() + "?);";
+    return sql;
+}
+
+const std::string& alertEventsInsertSql() {
+    static const std::string sql = "INSERT INTO alert_events (rule, raised, " + signalNames() +
+                                   ", timestamp) VALUES (?, ?, " + signalPlaceholders() + "?);";
+    return sql;
+}
+
+bool initEngineSchema(sqlite3* db) {
+    const std::string create_table_sql =
         "CREATE TABLE IF NOT EXISTS engine_values ("
-        "id INTEGER PRIMARY KEY AUTOINCREMENT,"
-        "rpm INTEGER NOT NULL,"
-        "temperature INTEGER NOT NULL,"
-        "oil_pressure INTEGER NOT NULL,"
-        "speed INTEGER NOT NULL,"
+        "id INTEGER PRIMARY KEY AUTOINCREMENT," +
+        signalNames(" INTEGER,") + " INTEGER,"
         "timestamp INTEGER NOT NULL"
         ");";
 
     char* err_msg = nullptr;
-    rc = sqlite3_exec(db, create_table_sql, nullptr, nullptr, &err_msg);
+    int rc = sqlite3_exec(db, create_table_sql.c_str(), nullptr, nullptr, &err_msg);
     if (rc != SQLITE_OK) {
         spdlog::error("SQL error: {}", err_msg);
         sqlite3_free(err_msg);
-        sqlite3_close(db);
-        db = nullptr;
+        return false;
     }
 
     // Ensure expected columns exist for backward compatibility with older DB files.
-    if (db) {
+    {
         sqlite3_stmt* stmt = nullptr;
         const char* pragma_sql = "PRAGMA table_info(engine_values);";
         rc = sqlite3_prepare_v2(db, pragma_sql, -1, &stmt, nullptr);
@@ -69,13 +134,11 @@ void EngineImpl::initDatabase(const std::string& db_path) {
         }
 
         // Define expected columns and the SQL to add them if missing.
-        std::vector<std::pair<std::string, std::string>> expected = {
-            {"rpm", "INTEGER NOT NULL DEFAULT 0"},
-            {"temperature", "INTEGER NOT NULL DEFAULT 0"},
-            {"oil_pressure", "INTEGER NOT NULL DEFAULT 0"},
-            {"speed", "INTEGER NOT NULL DEFAULT 0"},
-            {"timestamp", "INTEGER NOT NULL DEFAULT 0"}
-        };
+        std::vector<std::pair<std::string, std::string>> expected;
+        for (const SignalField& field : kSignalFields) {
+            expected.emplace_back(field.name, "INTEGER NOT NULL DEFAULT 0");
+        }
+        expected.emplace_back("timestamp", "INTEGER NOT NULL DEFAULT 0");
 
         for (const auto &col : expected) {
             if (existing_cols.find(col.first) == existing_cols.end()) {
@@ -91,34 +154,149 @@ void EngineImpl::initDatabase(const std::string& db_path) {
             }
         }
     }
+
+    {
+        const std::string create_alerts_sql =
+            "CREATE TABLE IF NOT EXISTS alert_events ("
+            "id INTEGER PRIMARY KEY AUTOINCREMENT,"
+            "rule TEXT NOT NULL,"
+            "raised INTEGER NOT NULL," +
+            signalNames(" INTEGER NOT NULL,") + " INTEGER NOT NULL,"
+            "timestamp INTEGER NOT NULL"
+            ");";
+        rc = sqlite3_exec(db, create_alerts_sql.c_str(), nullptr, nullptr, &err_msg);
+        if (rc != SQLITE_OK) {
+            spdlog::error("SQL error: {}", err_msg);
+            sqlite3_free(err_msg);
+        }
+    }
+    return true;
 }
 
-void EngineImpl::storeCurrentValues(int rpm, int temperature, int oil_pressure, int speed) {
-    if (!db) {
+bool engineValuesNullable(sqlite3* db) {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, "PRAGMA table_info(engine_values);", -1, &stmt, nullptr) != SQLITE_OK) {
+        return false;
+    }
+    bool nullable = true;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+        const bool not_null = sqlite3_column_int(stmt, 3) != 0;
+        if (name && std::string(name) != "timestamp" && std::string(name) != "id" && not_null) {
+            nullable = false;
+        }
+    }
+    sqlite3_finalize(stmt);
+    return nullable;
+}
+
+void EngineImpl::initDatabase(const std::string& db_path) {
+    int rc = sqlite3_open(db_path.c_str(), &db);
+    if (rc != SQLITE_OK) {
+        spdlog::error("Cannot open database: {}", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        db = nullptr;
+        return;
+    }
+
+    // WAL lets exports and other readers run while samples are being written.
+    sqlite3_exec(db, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
+
+    if (!initEngineSchema(db)) {
+        sqlite3_close(db);
+        db = nullptr;
+        return;
+    }
+    sparse_rows = engineValuesNullable(db);
+    // Interpolated reads (HistoryInterpolator) walk each signal in timestamp order.
+    sqlite3_exec(db, "CREATE INDEX IF NOT EXISTS idx_engine_values_timestamp ON engine_values(timestamp);",
+                 nullptr, nullptr, nullptr);
+}
+
+// Compressed rows store only some signals, which needs nullable columns.
+void EngineImpl::enableCompression(const CompressionConfig& config) {
+    if (!config.enabled()) {
+        return;
+    }
+    if (!sparse_rows) {
+        spdlog::warn("engine_values has NOT NULL columns; storing samples without compression");
         return;
     }
+    compressor = std::make_unique<SampleCompressor>(config);
+}
+
+uint64_t EngineImpl::valuesOffered() const {
+    return compressor ? compressor->offered() : 0;
+}
+
+uint64_t EngineImpl::valuesStored() const {
+    return compressor ? compressor->stored() : 0;
+}
+
+// Retention deletes whole partition files, so it only needs to run when a new
+// partition starts rather than on every insert.
+void EngineImpl::applyRetention(int64_t now_ms) {
+    if (retention_ms > 0) {
+        partitions.dropBefore(now_ms - retention_ms);
+    }
+}
 
+void EngineImpl::storeCurrentValues(int rpm, int temperature, int oil_pressure, int speed) {
     auto now = std::chrono::system_clock::now();
-    auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+    EngineSnapshot snapshot;
+    snapshot.values = EngineSample{rpm, temperature, oil_pressure, speed};
+    snapshot.timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         now.time_since_epoch()
     ).count();
+    storeSample(snapshot);
+}
 
-    const char* insert_sql = 
-        "INSERT INTO engine_values (rpm, temperature, oil_pressure, speed, timestamp) "
-        "VALUES (?, ?, ?, ?, ?);";
+void EngineImpl::storeSample(const EngineSnapshot& snapshot) {
+    if (compressor) {
+        compressed_rows.clear();
+        compressor->offer(snapshot, compressed_rows);
+        for (const CompressedRow& row : compressed_rows) {
+            insertRow(row.timestamp_ms, row.values, row.fresh);
+        }
+        return;
+    }
+    insertRow(snapshot.timestamp_ms, snapshot.values, snapshot.fresh);
+}
+
+void EngineImpl::insertRow(int64_t timestamp_ms, const EngineSample& values, uint8_t fresh) {
+    if (partitions.isOpen()) {
+        // Compared by start time: copying the live path would allocate for every row.
+        const bool had_live = !partitions.livePath().empty();
+        const int64_t previous_start_ms = partitions.liveStartMs();
+        partitions.insert(timestamp_ms, values, fresh);
+        if (had_live && partitions.liveStartMs() != previous_start_ms) {
+            applyRetention(timestamp_ms);
+        }
+        return;
+    }
+    if (blocks.isOpen()) {
+        blocks.add(timestamp_ms, values, sparse_rows ? fresh : kAllSignals);
+        return;
+    }
+    if (!db) {
+        return;
+    }
 
     sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2(db, insert_sql, -1, &stmt, nullptr);
+    int rc = sqlite3_prepare_v2(db, engineValuesInsertSql().c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
         spdlog::error("Failed to prepare statement: {}", sqlite3_errmsg(db));
         return;
     }
 
-    sqlite3_bind_int(stmt, 1, rpm);
-    sqlite3_bind_int(stmt, 2, temperature);
-    sqlite3_bind_int(stmt, 3, oil_pressure);
-    sqlite3_bind_int(stmt, 4, speed);
-    sqlite3_bind_int64(stmt, 5, timestamp);
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        if (!sparse_rows || (fresh & (1u << i))) {
+            sqlite3_bind_int(stmt, static_cast<int>(i) + 1, signalValue(values, i));
+        } else {
+            sqlite3_bind_null(stmt, static_cast<int>(i) + 1);
+        }
+    }
+    sqlite3_bind_int64(stmt, static_cast<int>(kSignalCount) + 1, timestamp_ms);
 
     rc = sqlite3_step(stmt);
     if (rc != SQLITE_DONE) {
@@ -128,24 +306,77 @@ void EngineImpl::storeCurrentValues(int rpm, int temperature, int oil_pressure,
     sqlite3_finalize(stmt);
 }
 
-int EngineImpl::getRpm() {
+void EngineImpl::storeAlertEvent(const std::string& rule, bool raised, int64_t timestamp_ms, const EngineSample& values) {
+    if (partitions.isOpen()) {
+        partitions.insertAlert(rule, raised, timestamp_ms, values);
+        return;
+    }
+    if (!db) {
+        return;
+    }
+
+    sqlite3_stmt* stmt;
+    int rc = sqlite3_prepare_v2(db, alertEventsInsertSql().c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        spdlog::error("Failed to prepare statement: {}", sqlite3_errmsg(db));
+        return;
+    }
+
+    sqlite3_bind_text(stmt, 1, rule.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int(stmt, 2, raised ? 1 : 0);
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        sqlite3_bind_int(stmt, static_cast<int>(i) + 3, signalValue(values, i));
+    }
+    sqlite3_bind_int64(stmt, static_cast<int>(kSignalCount) + 3, timestamp_ms);
+
+    rc = sqlite3_step(stmt);
+    if (rc != SQLITE_DONE) {
+        spdlog::error("Failed to execute statement: {}", sqlite3_errmsg(db));
+    }
+
+    sqlite3_finalize(stmt);
+}
+
+// Simulates a crash on every third rpm read when crashEnabled is set.
+static void maybeCrash() {
     if (crashEnabled && ++untilCrashCounter >= 3) {
         untilCrashCounter = 0;
         // Simulate a crash
         int* p = nullptr;
         *p = 42; // Dereference null pointer to cause a crash
     }
-    return receiver.GetRpm();
+}
+
+int EngineImpl::getRpm() {
+    maybeCrash();
+    return receiver.read(signals::rpm);
 }
 
 int EngineImpl::getTemperature() {
-    return receiver.GetTemperature();
+    return receiver.read(signals::temperature);
 }
 
 int EngineImpl::getOilPressure() {
-    return receiver.GetOilPressure();
+    return receiver.read(signals::oil_pressure);
 }
 
 int EngineImpl::getSpeed() {
-    return receiver.GetSpeed();
+    return receiver.read(signals::speed);
+}
+
+EngineSample EngineImpl::sample(uint8_t mask) {
+    EngineSample s;
+    if (mask & (1u << signals::rpm)) {
+        maybeCrash();
+    }
+    forEachSignal([&](auto i) {
+        if (mask & (1u << i)) {
+            s.*kSignalFields[i].member = receiver.read(i);
+        }
+    });
+    return s;
+}
+
+EngineSample EngineImpl::sample() {
+    return sample(kAllSignals);
 }
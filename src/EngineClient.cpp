@@ -0,0 +1,585 @@
+#include "EngineClient.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <random>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+constexpr unsigned char kRequestMarker = 0xA5;
+// Larger frames are a protocol error; the server's export chunks stay far below.
+constexpr uint32_t kMaxFrameBytes = 16 * 1024 * 1024;
+constexpr size_t kReceiveBufferBytes = 16 * 1024;
+// Poll timeout while nothing is due, so stop() is noticed without a wake-up.
+constexpr int kIdlePollMs = 100;
+
+const EngineData& emptyMessage() {
+    return EngineData::default_instance();
+}
+
+// A plain poll byte is answered once per read, however many arrive together, so
+// pipelined polls are sent as framed empty requests instead.
+const std::string kPollFrame{static_cast<char>(kRequestMarker), 0, 0, 0, 0};
+
+} // namespace
+
+struct EngineClient::Connection {
+    enum class State { Idle, Connecting, Connected };
+    State state = State::Idle;
+    int fd = -1;
+    // The alert subscription connection; only connected while there are subscribers.
+    bool stream = false;
+    // Encoded requests not yet accepted by the socket: out[out_offset, end).
+    std::string out;
+    size_t out_offset = 0;
+    // Received bytes not yet parsed: in[in_head, in_tail).
+    std::vector<char> in = std::vector<char>(kReceiveBufferBytes);
+    size_t in_head = 0;
+    size_t in_tail = 0;
+    std::deque<Pending> pending;
+    // Every frame is parsed into this message.
+    EngineData frame;
+    // Consecutive failed attempts; reset by the first frame of a connection.
+    int failures = 0;
+    std::chrono::steady_clock::time_point retry_at{};
+};
+
+EngineClient::EngineClient(ClientConfig config) : config(std::move(config)) {}
+
+EngineClient::~EngineClient()
+{
+    stop();
+}
+
+bool EngineClient::start()
+{
+    if (running)
+        return true;
+    if (config.unix_path.empty())
+    {
+        in_addr address{};
+        if (inet_pton(AF_INET, config.host.c_str(), &address) != 1)
+        {
+            spdlog::error("Client: invalid IPv4 address {}", config.host);
+            return false;
+        }
+    }
+    else if (config.unix_path.size() >= sizeof(sockaddr_un::sun_path))
+    {
+        spdlog::error("Client: Unix socket path too long: {}", config.unix_path);
+        return false;
+    }
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd < 0)
+    {
+        spdlog::error("Client: eventfd failed: {}", std::strerror(errno));
+        return false;
+    }
+    connections.clear();
+    for (size_t i = 0; i < std::max<size_t>(1, config.pool_size); ++i)
+        connections.push_back(std::make_unique<Connection>());
+    connections.push_back(std::make_unique<Connection>());
+    connections.back()->stream = true;
+    running = true;
+    io_thread = std::thread(&EngineClient::run, this);
+    return true;
+}
+
+void EngineClient::stop()
+{
+    {
+        // Under the lock so no submission arrives after the I/O thread's last look.
+        std::lock_guard<std::mutex> lock(submit_mutex);
+        if (!running)
+            return;
+        running = false;
+    }
+    const uint64_t one = 1;
+    if (::write(wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+        spdlog::warn("Client: wake-up failed: {}", std::strerror(errno));
+    if (io_thread.joinable())
+        io_thread.join();
+    ::close(wake_fd);
+    wake_fd = -1;
+}
+
+bool EngineClient::poll(ResponseCallback callback)
+{
+    Submission submission;
+    submission.frame = kPollFrame;
+    submission.pending.callback = std::move(callback);
+    return submit(std::move(submission));
+}
+
+bool EngineClient::request(const Request& request, ResponseCallback callback)
+{
+    Submission submission;
+    submission.frame = encode(request);
+    submission.pending.callback = std::move(callback);
+    submission.pending.stream = request.has_export_history();
+    return submit(std::move(submission));
+}
+
+ResponseAwaiter EngineClient::asyncPoll()
+{
+    return ResponseAwaiter(*this, kPollFrame, false);
+}
+
+ResponseAwaiter EngineClient::asyncRequest(const Request& request)
+{
+    return ResponseAwaiter(*this, encode(request), false);
+}
+
+uint64_t EngineClient::subscribeAlerts(ResponseCallback callback)
+{
+    Submission submission;
+    submission.kind = Submission::kSubscribe;
+    submission.id = next_subscription++;
+    submission.pending.callback = std::move(callback);
+    const uint64_t id = submission.id;
+    return submit(std::move(submission)) ? id : 0;
+}
+
+void EngineClient::unsubscribe(uint64_t id)
+{
+    Submission submission;
+    submission.kind = Submission::kUnsubscribe;
+    submission.id = id;
+    submit(std::move(submission));
+}
+
+EngineClientCounters EngineClient::getCounters() const
+{
+    EngineClientCounters counters;
+    counters.requests = requests.load(std::memory_order_relaxed);
+    counters.frames = frames.load(std::memory_order_relaxed);
+    counters.disconnects = disconnects.load(std::memory_order_relaxed);
+    counters.connected = connected.load(std::memory_order_relaxed);
+    return counters;
+}
+
+bool ResponseAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    EngineClient::Submission submission;
+    submission.frame = std::move(frame);
+    submission.pending.stream = stream;
+    // May run on the I/O thread before submit() returns; nothing below touches
+    // the awaiter after a successful submit.
+    submission.pending.callback = [this, handle](ClientStatus status, const EngineData& data) {
+        response.status = status;
+        if (status == ClientStatus::Ok)
+            response.data.CopyFrom(data);
+        handle.resume();
+    };
+    if (!client.submit(std::move(submission)))
+    {
+        response.status = ClientStatus::Rejected;
+        return false;
+    }
+    return true;
+}
+
+// Queues a submission for the I/O thread, which is woken only if it may be
+// waiting: a burst of submissions costs one eventfd write.
+bool EngineClient::submit(Submission submission)
+{
+    {
+        std::lock_guard<std::mutex> lock(submit_mutex);
+        if (!running)
+            return false;
+        if (submission.kind == Submission::kRequest)
+        {
+            if (waiting.load(std::memory_order_relaxed) >= config.max_queued)
+                return false;
+            waiting.fetch_add(1, std::memory_order_relaxed);
+            requests.fetch_add(1, std::memory_order_relaxed);
+        }
+        submissions.push_back(std::move(submission));
+        // Written under the lock: stop() closes wake_fd once running is false.
+        if (!wake_pending)
+        {
+            wake_pending = true;
+            const uint64_t one = 1;
+            if (::write(wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+                spdlog::warn("Client: wake-up failed: {}", std::strerror(errno));
+        }
+    }
+    return true;
+}
+
+std::string EngineClient::encode(const Request& request)
+{
+    const std::string body = request.SerializeAsString();
+    std::string frame(1, static_cast<char>(kRequestMarker));
+    const uint32_t size = htonl(static_cast<uint32_t>(body.size()));
+    frame.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    return frame + body;
+}
+
+void EngineClient::run()
+{
+    std::vector<pollfd> fds;
+    while (running)
+    {
+        takeSubmissions();
+        const auto now = std::chrono::steady_clock::now();
+        auto next_retry = now + std::chrono::milliseconds(kIdlePollMs);
+        for (auto& c : connections)
+        {
+            if (c->state != Connection::State::Idle || (c->stream && subscribers.empty()))
+                continue;
+            if (c->retry_at <= now)
+                connect(*c);
+            else
+                next_retry = std::min(next_retry, c->retry_at);
+        }
+        dispatch();
+
+        fds.clear();
+        fds.push_back({wake_fd, POLLIN, 0});
+        for (auto& c : connections)
+        {
+            short events = 0;
+            if (c->state == Connection::State::Connecting)
+                events = POLLOUT;
+            else if (c->state == Connection::State::Connected)
+                events = static_cast<short>(POLLIN | (c->out_offset < c->out.size() ? POLLOUT : 0));
+            fds.push_back({c->fd, events, 0});
+        }
+        const auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(next_retry - now).count();
+        const int ready = ::poll(fds.data(), fds.size(), static_cast<int>(std::max<int64_t>(0, timeout)));
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            spdlog::error("Client: poll failed: {}", std::strerror(errno));
+            break;
+        }
+        if (fds[0].revents & POLLIN)
+        {
+            uint64_t count;
+            while (::read(wake_fd, &count, sizeof(count)) > 0) {}
+        }
+        for (size_t i = 0; i < connections.size(); ++i)
+        {
+            Connection& c = *connections[i];
+            const short revents = fds[i + 1].revents;
+            if (revents == 0 || c.fd < 0)
+                continue;
+            if (c.state == Connection::State::Connecting)
+            {
+                finishConnect(c);
+                continue;
+            }
+            if ((revents & (POLLIN | POLLHUP | POLLERR)) && !receive(c))
+                continue;
+            if ((revents & POLLOUT) && !flush(c))
+                continue;
+        }
+    }
+
+    // Complete everything still outstanding.
+    takeSubmissions();
+    for (auto& c : connections)
+        disconnect(*c, ClientStatus::Closed);
+    for (Submission& s : backlog)
+        s.pending.callback(ClientStatus::Closed, emptyMessage());
+    waiting.fetch_sub(backlog.size(), std::memory_order_relaxed);
+    backlog.clear();
+    subscribers.clear();
+}
+
+void EngineClient::takeSubmissions()
+{
+    {
+        std::lock_guard<std::mutex> lock(submit_mutex);
+        taken.swap(submissions);
+        wake_pending = false;
+    }
+    for (Submission& s : taken)
+    {
+        if (s.kind == Submission::kRequest)
+        {
+            backlog.push_back(std::move(s));
+        }
+        else if (s.kind == Submission::kSubscribe)
+        {
+            subscribers.emplace_back(s.id, std::move(s.pending.callback));
+        }
+        else
+        {
+            std::erase_if(subscribers, [&](const auto& sub) { return sub.first == s.id; });
+            Connection* stream = streamConnection();
+            if (subscribers.empty() && stream->state != Connection::State::Idle)
+                disconnect(*stream, ClientStatus::Closed);
+        }
+    }
+    taken.clear();
+}
+
+// Writes queued requests to the least loaded connected pool members.
+void EngineClient::dispatch()
+{
+    while (!backlog.empty())
+    {
+        Connection* target = nullptr;
+        for (auto& c : connections)
+        {
+            if (c->stream || c->state != Connection::State::Connected || c->pending.size() >= config.max_in_flight)
+                continue;
+            if (!target || c->pending.size() < target->pending.size())
+                target = c.get();
+        }
+        if (!target)
+            return;
+        Submission& s = backlog.front();
+        target->out += s.frame;
+        target->pending.push_back(std::move(s.pending));
+        backlog.pop_front();
+        waiting.fetch_sub(1, std::memory_order_relaxed);
+        // Requests taken in the same pass share one send per connection.
+        if (backlog.empty() || target->pending.size() >= config.max_in_flight)
+            flush(*target);
+    }
+    for (auto& c : connections)
+    {
+        if (c->state == Connection::State::Connected && c->out_offset < c->out.size())
+            flush(*c);
+    }
+}
+
+void EngineClient::connect(Connection& c)
+{
+    const bool unix_socket = !config.unix_path.empty();
+    c.fd = ::socket(unix_socket ? AF_UNIX : AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (c.fd < 0)
+    {
+        spdlog::error("Client: socket failed: {}", std::strerror(errno));
+        disconnect(c, ClientStatus::Disconnected);
+        return;
+    }
+    int result;
+    if (unix_socket)
+    {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, config.unix_path.c_str(), sizeof(addr.sun_path) - 1);
+        result = ::connect(c.fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    }
+    else
+    {
+        int one = 1;
+        ::setsockopt(c.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(config.port);
+        inet_pton(AF_INET, config.host.c_str(), &addr.sin_addr);
+        result = ::connect(c.fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    }
+    if (result == 0)
+    {
+        c.state = Connection::State::Connecting;
+        finishConnect(c);
+    }
+    else if (errno == EINPROGRESS || errno == EAGAIN)
+    {
+        c.state = Connection::State::Connecting;
+    }
+    else
+    {
+        disconnect(c, ClientStatus::Disconnected);
+    }
+}
+
+void EngineClient::finishConnect(Connection& c)
+{
+    int error = 0;
+    socklen_t len = sizeof(error);
+    if (::getsockopt(c.fd, SOL_SOCKET, SO_ERROR, &error, &len) < 0 || error != 0)
+    {
+        disconnect(c, ClientStatus::Disconnected);
+        return;
+    }
+    c.state = Connection::State::Connected;
+    connected.fetch_add(1, std::memory_order_relaxed);
+    if (c.stream)
+    {
+        Request subscribe;
+        subscribe.set_subscribe_alerts(true);
+        c.out = encode(subscribe);
+        flush(c);
+    }
+}
+
+// Closes the connection, completes its outstanding requests with `status` and
+// schedules the reconnect.
+void EngineClient::disconnect(Connection& c, ClientStatus status)
+{
+    if (c.fd >= 0)
+        ::close(c.fd);
+    if (c.state == Connection::State::Connected)
+        connected.fetch_sub(1, std::memory_order_relaxed);
+    const bool was_open = c.state != Connection::State::Idle;
+    c.fd = -1;
+    c.state = Connection::State::Idle;
+    c.out.clear();
+    c.out_offset = 0;
+    c.in_head = c.in_tail = 0;
+    std::deque<Pending> pending;
+    pending.swap(c.pending);
+    for (Pending& p : pending)
+        p.callback(status, emptyMessage());
+    if (c.stream && was_open)
+    {
+        for (auto& [id, callback] : subscribers)
+            callback(status, emptyMessage());
+    }
+    if (status != ClientStatus::Disconnected)
+        return;
+
+    disconnects.fetch_add(1, std::memory_order_relaxed);
+    // Full jitter over the upper half, so a fleet of clients spreads out.
+    ++c.failures;
+    const int64_t min_ms = std::max<int64_t>(1, config.reconnect_min.count());
+    const int64_t max_ms = std::max(min_ms, static_cast<int64_t>(config.reconnect_max.count()));
+    const int64_t base = std::min(max_ms, min_ms << std::min(c.failures - 1, 20));
+    thread_local std::minstd_rand jitter(std::random_device{}());
+    const int64_t delay = base / 2 + static_cast<int64_t>(jitter() % static_cast<uint64_t>(base / 2 + 1));
+    c.retry_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay);
+    if (c.failures == 1)
+        spdlog::warn("Client: connection lost, reconnecting");
+}
+
+bool EngineClient::flush(Connection& c)
+{
+    while (c.out_offset < c.out.size())
+    {
+        const ssize_t sent = ::send(c.fd, c.out.data() + c.out_offset, c.out.size() - c.out_offset, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (sent < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return true;
+            if (errno == EINTR)
+                continue;
+            disconnect(c, ClientStatus::Disconnected);
+            return false;
+        }
+        c.out_offset += static_cast<size_t>(sent);
+    }
+    // Keeps the capacity for the next requests.
+    c.out.clear();
+    c.out_offset = 0;
+    return true;
+}
+
+bool EngineClient::receive(Connection& c)
+{
+    for (;;)
+    {
+        if (c.in_tail == c.in.size())
+        {
+            if (c.in_head > 0)
+            {
+                std::memmove(c.in.data(), c.in.data() + c.in_head, c.in_tail - c.in_head);
+                c.in_tail -= c.in_head;
+                c.in_head = 0;
+            }
+            else
+            {
+                c.in.resize(c.in.size() * 2);
+            }
+        }
+        const ssize_t n = ::read(c.fd, c.in.data() + c.in_tail, c.in.size() - c.in_tail);
+        if (n > 0)
+        {
+            c.in_tail += static_cast<size_t>(n);
+            deliver(c);
+            if (c.fd < 0)
+                return false;
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return true;
+        if (n < 0 && errno == EINTR)
+            continue;
+        disconnect(c, ClientStatus::Disconnected);
+        return false;
+    }
+}
+
+// Parses every complete frame in the receive buffer in place and hands it out.
+void EngineClient::deliver(Connection& c)
+{
+    while (c.in_tail - c.in_head >= sizeof(uint32_t))
+    {
+        uint32_t size;
+        std::memcpy(&size, c.in.data() + c.in_head, sizeof(size));
+        size = ntohl(size);
+        if (size > kMaxFrameBytes)
+        {
+            spdlog::error("Client: oversized frame ({} bytes)", size);
+            disconnect(c, ClientStatus::Disconnected);
+            return;
+        }
+        const size_t frame_end = c.in_head + sizeof(size) + size;
+        if (frame_end > c.in_tail)
+        {
+            // Make room for the rest of a frame that does not fit behind in_head.
+            if (frame_end > c.in.size())
+            {
+                std::memmove(c.in.data(), c.in.data() + c.in_head, c.in_tail - c.in_head);
+                c.in_tail -= c.in_head;
+                c.in_head = 0;
+                if (sizeof(size) + size > c.in.size())
+                    c.in.resize(sizeof(size) + size);
+            }
+            return;
+        }
+        if (!c.frame.ParseFromArray(c.in.data() + c.in_head + sizeof(size), static_cast<int>(size)))
+        {
+            spdlog::error("Client: malformed frame");
+            disconnect(c, ClientStatus::Disconnected);
+            return;
+        }
+        c.in_head = frame_end;
+        c.failures = 0;
+        frames.fetch_add(1, std::memory_order_relaxed);
+        if (c.stream)
+        {
+            for (auto& [id, callback] : subscribers)
+                callback(ClientStatus::Ok, c.frame);
+        }
+        else if (!c.pending.empty())
+        {
+            const bool more = c.pending.front().stream && c.frame.has_export_chunk() &&
+                              !c.frame.export_chunk().last() && !c.frame.export_chunk().failed();
+            if (more)
+            {
+                c.pending.front().callback(ClientStatus::Ok, c.frame);
+            }
+            else
+            {
+                Pending done = std::move(c.pending.front());
+                c.pending.pop_front();
+                done.callback(ClientStatus::Ok, c.frame);
+            }
+        }
+    }
+    if (c.in_head == c.in_tail)
+        c.in_head = c.in_tail = 0;
+}
+
+EngineClient::Connection* EngineClient::streamConnection()
+{
+    return connections.back().get();
+}
@@ -0,0 +1,391 @@
+#include "HistoryAggregate.h"
+#include "BlockStore.h"
+#include "PartitionedStore.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <sqlite3.h>
+#include <spdlog/spdlog.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MIDDLEWARESW_HAVE_AVX2 1
+#endif
+
+namespace aggregate {
+
+BlockStats scanScalar(const int32_t* values, size_t n) {
+    BlockStats out;
+    for (size_t i = 0; i < n; ++i) {
+        out.sum += values[i];
+        out.min = std::min(out.min, values[i]);
+        out.max = std::max(out.max, values[i]);
+    }
+    return out;
+}
+
+#ifdef MIDDLEWARESW_HAVE_AVX2
+
+// Eight values per step: min and max in 32-bit lanes, the sum widened to two
+// vectors of four 64-bit lanes so it cannot overflow.
+__attribute__((target("avx2"))) BlockStats scanAvx2(const int32_t* values, size_t n) {
+    __m256i min8 = _mm256_set1_epi32(std::numeric_limits<int>::max());
+    __m256i max8 = _mm256_set1_epi32(std::numeric_limits<int>::min());
+    __m256i sum_low = _mm256_setzero_si256();
+    __m256i sum_high = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        min8 = _mm256_min_epi32(min8, v);
+        max8 = _mm256_max_epi32(max8, v);
+        sum_low = _mm256_add_epi64(sum_low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        sum_high = _mm256_add_epi64(sum_high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) int32_t mins[8];
+    alignas(32) int32_t maxs[8];
+    alignas(32) int64_t sums[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(mins), min8);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(maxs), max8);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_add_epi64(sum_low, sum_high));
+    BlockStats out = scanScalar(values + i, n - i);
+    for (int lane = 0; lane < 8; ++lane) {
+        out.min = std::min(out.min, mins[lane]);
+        out.max = std::max(out.max, maxs[lane]);
+    }
+    out.sum += sums[0] + sums[1] + sums[2] + sums[3];
+    return out;
+}
+
+bool avx2Available() {
+    return __builtin_cpu_supports("avx2");
+}
+
+#else
+
+BlockStats scanAvx2(const int32_t* values, size_t n) {
+    return scanScalar(values, n);
+}
+
+bool avx2Available() {
+    return false;
+}
+
+#endif
+
+} // namespace aggregate
+
+namespace {
+
+using Scan = aggregate::BlockStats (*)(const int32_t*, size_t);
+
+// One signal's share of one reader's rows.
+struct Accumulator {
+    uint64_t count = 0;
+    int64_t sum = 0;
+    int min = std::numeric_limits<int>::max();
+    int max = std::numeric_limits<int>::min();
+    // Counts of value - field.min over the field's range.
+    std::vector<uint64_t> histogram;
+    // Values outside the range.
+    std::vector<int> outside;
+};
+
+struct Partial {
+    uint64_t rows = 0;
+    std::array<Accumulator, kSignalCount> signals;
+    bool failed = false;
+
+    Partial() {
+        for (size_t i = 0; i < kSignalCount; ++i)
+            signals[i].histogram.assign(static_cast<size_t>(kSignalFields[i].max - kSignalFields[i].min) + 1, 0);
+    }
+};
+
+// A time range of one database, read by one thread.
+struct Slice {
+    std::string path;
+    int64_t from_ms = 0;
+    int64_t to_ms = 0;
+};
+
+void accumulate(Accumulator& acc, const SignalField& field, const int32_t* values, size_t n, Scan scan) {
+    if (n == 0)
+        return;
+    const aggregate::BlockStats block = scan(values, n);
+    acc.count += n;
+    acc.sum += block.sum;
+    acc.min = std::min(acc.min, block.min);
+    acc.max = std::max(acc.max, block.max);
+    uint64_t* const histogram = acc.histogram.data();
+    if (block.min >= field.min && block.max <= field.max) {
+        // The usual case: the block min/max show that every value is in range.
+        for (size_t i = 0; i < n; ++i)
+            ++histogram[values[i] - field.min];
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (values[i] >= field.min && values[i] <= field.max)
+            ++histogram[values[i] - field.min];
+        else
+            acc.outside.push_back(values[i]);
+    }
+}
+
+sqlite3* openReadOnly(const std::string& path) {
+    sqlite3* db = nullptr;
+    if (sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        spdlog::error("Cannot open database {} for aggregation: {}", path, sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return nullptr;
+    }
+    sqlite3_busy_timeout(db, 1000);
+    return db;
+}
+
+// Reads `sql` (one int64 result, bound to from_ms and to_ms). NULL and a missing
+// engine_values table leave `value` unset and return true.
+bool queryBound(sqlite3* db, const char* sql, int64_t from_ms, int64_t to_ms, int64_t& value, bool& found) {
+    sqlite3_stmt* stmt = nullptr;
+    found = false;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK)
+        return true;
+    sqlite3_bind_int64(stmt, 1, from_ms);
+    sqlite3_bind_int64(stmt, 2, to_ms);
+    const int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW && sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+        value = sqlite3_column_int64(stmt, 0);
+        found = true;
+    }
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+        spdlog::error("Aggregate range query failed: {}", sqlite3_errmsg(db));
+        return false;
+    }
+    return true;
+}
+
+// Cuts the stored part of [from_ms, to_ms) in `path` into up to `count` slices of
+// equal length. MIN and MAX are separate queries so each is one index lookup.
+bool sliceDatabase(const std::string& path, int64_t from_ms, int64_t to_ms, size_t count, std::vector<Slice>& slices) {
+    sqlite3* db = openReadOnly(path);
+    if (!db)
+        return false;
+    int64_t first = 0, last = 0;
+    bool has_first = false, has_last = false;
+    bool ok =
+        queryBound(db, "SELECT MIN(timestamp) FROM engine_values WHERE timestamp >= ? AND timestamp < ?;", from_ms,
+                   to_ms, first, has_first) &&
+        queryBound(db, "SELECT MAX(timestamp) FROM engine_values WHERE timestamp >= ? AND timestamp < ?;", from_ms,
+                   to_ms, last, has_last);
+    // Blocks (BlockWriter) only bound their samples; the slices still cover them.
+    int64_t block_first = 0, block_last = 0;
+    bool has_block_first = false, has_block_last = false;
+    ok = ok &&
+         queryBound(db, "SELECT MIN(MAX(start_ts, ?1)) FROM engine_blocks WHERE end_ts >= ?1 AND start_ts < ?2;",
+                    from_ms, to_ms, block_first, has_block_first) &&
+         queryBound(db, "SELECT MAX(MIN(end_ts, ?2 - 1)) FROM engine_blocks WHERE end_ts >= ?1 AND start_ts < ?2;",
+                    from_ms, to_ms, block_last, has_block_last);
+    sqlite3_close(db);
+    if (has_block_first && has_block_last) {
+        first = has_first ? std::min(first, block_first) : block_first;
+        last = has_last ? std::max(last, block_last) : block_last;
+        has_first = has_last = true;
+    }
+    if (!ok || !has_first || !has_last)
+        return ok;
+    // Unsigned: the span of [first, last] may exceed int64.
+    const uint64_t span = static_cast<uint64_t>(last) - static_cast<uint64_t>(first) + 1;
+    const uint64_t n = std::max<uint64_t>(1, std::min<uint64_t>(count, span));
+    const uint64_t width = span / n + (span % n != 0);
+    for (uint64_t k = 0; k < n; ++k) {
+        const uint64_t begin = k * width;
+        if (begin >= span)
+            break;
+        Slice slice;
+        slice.path = path;
+        slice.from_ms = static_cast<int64_t>(static_cast<uint64_t>(first) + begin);
+        slice.to_ms = begin + width >= span ? to_ms : static_cast<int64_t>(static_cast<uint64_t>(first) + begin + width);
+        slices.push_back(slice);
+    }
+    return true;
+}
+
+// Column blocks of one reader, reused across its slices.
+struct Columns {
+    std::array<std::vector<int32_t>, kSignalCount> values;
+    std::array<size_t, kSignalCount> counts{};
+    // Decoded samples of one engine_blocks row.
+    std::vector<StoredSample> samples;
+};
+
+void flush(Columns& columns, Partial& partial, Scan scan) {
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        accumulate(partial.signals[s], kSignalFields[s], columns.values[s].data(), columns.counts[s], scan);
+        columns.counts[s] = 0;
+    }
+}
+
+bool readSlice(const Slice& slice, Partial& partial, Columns& columns, size_t block_rows, Scan scan) {
+    sqlite3* db = openReadOnly(slice.path);
+    if (!db)
+        return false;
+    static const std::string select_sql =
+        "SELECT " + signalNames() + " FROM engine_values WHERE timestamp >= ? AND timestamp < ?;";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, select_sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        spdlog::error("Failed to prepare aggregate statement: {}", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return false;
+    }
+    sqlite3_bind_int64(stmt, 1, slice.from_ms);
+    sqlite3_bind_int64(stmt, 2, slice.to_ms);
+    size_t rows = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        for (size_t s = 0; s < kSignalCount; ++s) {
+            if (sqlite3_column_type(stmt, static_cast<int>(s)) != SQLITE_NULL)
+                columns.values[s][columns.counts[s]++] = sqlite3_column_int(stmt, static_cast<int>(s));
+        }
+        ++partial.rows;
+        if (++rows == block_rows) {
+            flush(columns, partial, scan);
+            rows = 0;
+        }
+    }
+    bool ok = rc == SQLITE_DONE;
+    if (!ok)
+        spdlog::error("Aggregate query failed: {}", sqlite3_errmsg(db));
+    sqlite3_finalize(stmt);
+
+    // Samples packed into engine_blocks, if the database has any.
+    BlockCursor blocks;
+    if (ok && blocks.open(db)) {
+        blocks.seek(std::numeric_limits<int64_t>::min(), slice.from_ms, slice.to_ms);
+        while (blocks.next(columns.samples)) {
+            for (const StoredSample& sample : columns.samples) {
+                for (size_t s = 0; s < kSignalCount; ++s) {
+                    if (sample.present & (1u << s))
+                        columns.values[s][columns.counts[s]++] = signalValue(sample.values, s);
+                }
+                ++partial.rows;
+                if (++rows == block_rows) {
+                    flush(columns, partial, scan);
+                    rows = 0;
+                }
+            }
+        }
+        ok = !blocks.failed();
+        blocks.close();
+    }
+    flush(columns, partial, scan);
+    sqlite3_close(db);
+    return ok;
+}
+
+void merge(Partial& into, const Partial& from) {
+    into.rows += from.rows;
+    into.failed = into.failed || from.failed;
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        Accumulator& a = into.signals[s];
+        const Accumulator& b = from.signals[s];
+        a.count += b.count;
+        a.sum += b.sum;
+        a.min = std::min(a.min, b.min);
+        a.max = std::max(a.max, b.max);
+        for (size_t i = 0; i < a.histogram.size(); ++i)
+            a.histogram[i] += b.histogram[i];
+        a.outside.insert(a.outside.end(), b.outside.begin(), b.outside.end());
+    }
+}
+
+// Nearest-rank quantile over the sorted outside values below the range, the
+// histogram, then the outside values above it.
+int quantile(const Accumulator& acc, const SignalField& field, size_t below, double q) {
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(acc.count))));
+    if (rank <= below)
+        return acc.outside[rank - 1];
+    rank -= below;
+    for (size_t b = 0; b < acc.histogram.size(); ++b) {
+        if (rank <= acc.histogram[b])
+            return field.min + static_cast<int>(b);
+        rank -= acc.histogram[b];
+    }
+    return acc.outside[below + rank - 1];
+}
+
+SignalAggregate finish(Accumulator& acc, const SignalField& field) {
+    SignalAggregate out;
+    out.count = acc.count;
+    if (acc.count == 0)
+        return out;
+    out.sum = acc.sum;
+    out.min = acc.min;
+    out.max = acc.max;
+    out.mean = static_cast<double>(acc.sum) / static_cast<double>(acc.count);
+    std::sort(acc.outside.begin(), acc.outside.end());
+    const size_t below = static_cast<size_t>(
+        std::lower_bound(acc.outside.begin(), acc.outside.end(), field.min) - acc.outside.begin());
+    out.p50 = quantile(acc, field, below, 0.50);
+    out.p90 = quantile(acc, field, below, 0.90);
+    out.p99 = quantile(acc, field, below, 0.99);
+    return out;
+}
+
+} // namespace
+
+bool aggregateHistory(const std::string& db_path, int64_t from_ms, int64_t to_ms, AggregateResult& result,
+                      const AggregateOptions& options) {
+    const auto started = std::chrono::steady_clock::now();
+    result = AggregateResult{};
+    const size_t threads =
+        options.threads > 0 ? options.threads : std::max<size_t>(1, std::thread::hardware_concurrency());
+    const size_t block_rows = std::max<size_t>(1, options.block_rows);
+    result.simd = options.simd && aggregate::avx2Available();
+    const Scan scan = result.simd ? aggregate::scanAvx2 : aggregate::scanScalar;
+
+    std::vector<std::string> databases;
+    std::error_code ec;
+    if (std::filesystem::is_directory(db_path, ec)) {
+        for (const PartitionInfo& p : PartitionedStore::overlapping(db_path, from_ms, to_ms))
+            databases.push_back(p.path);
+    } else {
+        databases.push_back(db_path);
+    }
+    // Enough slices per database that all threads have work even with one partition.
+    std::vector<Slice> slices;
+    for (const std::string& path : databases) {
+        if (!sliceDatabase(path, from_ms, to_ms, threads, slices))
+            return false;
+    }
+
+    const size_t workers = std::max<size_t>(1, std::min(threads, slices.size()));
+    result.threads = workers;
+    std::vector<Partial> partials(workers);
+    std::atomic<size_t> next{0};
+    auto work = [&](Partial& partial) {
+        Columns columns;
+        for (auto& column : columns.values)
+            column.resize(block_rows);
+        for (size_t i = next++; i < slices.size() && !partial.failed; i = next++)
+            partial.failed = !readSlice(slices[i], partial, columns, block_rows, scan);
+    };
+    std::vector<std::thread> pool;
+    for (size_t w = 1; w < workers; ++w)
+        pool.emplace_back(work, std::ref(partials[w]));
+    work(partials[0]);
+    for (std::thread& t : pool)
+        t.join();
+
+    for (size_t w = 1; w < workers; ++w)
+        merge(partials[0], partials[w]);
+    Partial& total = partials[0];
+    result.rows = total.rows;
+    for (size_t s = 0; s < kSignalCount; ++s)
+        result.signals[s] = finish(total.signals[s], kSignalFields[s]);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return !total.failed;
+}
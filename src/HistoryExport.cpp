@@ -0,0 +1,249 @@
+#include "HistoryExport.h"
+#include "Compression.h"
+#include "PartitionedStore.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+constexpr char kBinaryMagic[4] = {'M', 'W', 'C', 'B'};
+constexpr uint32_t kBinaryVersion = 1;
+
+template <typename T>
+void appendLittleEndian(std::string& out, T value) {
+    static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "binary export assumes a little-endian host");
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Row columns of one binary block. Kept per thread so repeated chunks reuse them.
+struct Columns {
+    std::vector<int64_t> id, timestamp;
+    std::vector<int32_t> values[kSignalCount];
+
+    void clear() {
+        id.clear();
+        timestamp.clear();
+        for (auto& v : values)
+            v.clear();
+    }
+};
+
+template <typename T>
+void appendColumn(std::string& out, const std::vector<T>& column) {
+    out.append(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+}
+
+// Writes one CSV row to `out` or adds it to the binary columns. Signals missing
+// from `present` are empty CSV fields; `values` already holds what binary repeats.
+void appendRow(std::string& out, Columns& columns, ExportFormat format, int64_t id, int64_t timestamp,
+               const int32_t* values, uint8_t present) {
+    if (format == ExportFormat::Csv) {
+        // Two int64 and kSignalCount int32 fields with their separators. The numbers
+        // always fit; the bound leaves room for the byte written after each one.
+        char line[2 * 21 + kSignalCount * 12 + 1];
+        char* const end = line + sizeof(line) - 1;
+        char* p = std::to_chars(line, end, id).ptr;
+        *p++ = ',';
+        p = std::to_chars(p, end, timestamp).ptr;
+        for (size_t i = 0; i < kSignalCount; ++i) {
+            *p++ = ',';
+            if (present & (1u << i))
+                p = std::to_chars(p, end, values[i]).ptr;
+        }
+        *p++ = '\n';
+        out.append(line, static_cast<size_t>(p - line));
+    } else {
+        columns.id.push_back(id);
+        columns.timestamp.push_back(timestamp);
+        for (size_t i = 0; i < kSignalCount; ++i)
+            columns.values[i].push_back(values[i]);
+    }
+}
+
+void appendBlock(std::string& out, const Columns& columns) {
+    if (columns.id.empty())
+        return;
+    appendLittleEndian(out, static_cast<uint32_t>(columns.id.size()));
+    appendColumn(out, columns.id);
+    appendColumn(out, columns.timestamp);
+    for (const auto& column : columns.values)
+        appendColumn(out, column);
+}
+
+} // namespace
+
+HistoryCursor::HistoryCursor() = default;
+
+HistoryCursor::~HistoryCursor() {
+    close();
+}
+
+bool HistoryCursor::open(const std::string& db_path, int64_t from_ms, int64_t to_ms, ExportFormat format,
+                         int64_t step_ms) {
+    close();
+    if (step_ms > 0) {
+        interpolator = std::make_unique<HistoryInterpolator>();
+        if (!interpolator->open(db_path, from_ms)) {
+            close();
+            return false;
+        }
+        next_ms = from_ms;
+        if (!interpolator->empty()) {
+            next_ms = std::max(from_ms, interpolator->firstTimestamp());
+            to_ms = std::min(to_ms, interpolator->lastTimestamp() + 1);
+        } else {
+            to_ms = next_ms;
+        }
+    }
+    this->step_ms = step_ms;
+    std::error_code ec;
+    if (std::filesystem::is_directory(db_path, ec)) {
+        for (const PartitionInfo& p : PartitionedStore::overlapping(db_path, from_ms, to_ms))
+            partitions.push_back(p.path);
+    } else if (step_ms <= 0) {
+        partitions.push_back(db_path);
+    }
+    next_partition = 0;
+    finished = true;
+    if (!partitions.empty() && !openPartition(partitions[next_partition++])) {
+        close();
+        return false;
+    }
+    this->format = format;
+    this->from_ms = from_ms;
+    this->to_ms = to_ms;
+    rows = 0;
+    std::fill(std::begin(carried), std::end(carried), 0);
+    started = false;
+    finished = false;
+    error = false;
+    return true;
+}
+
+bool HistoryCursor::openPartition(const std::string& path) {
+    if (sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        spdlog::error("Cannot open database {} for export: {}", path, sqlite3_errmsg(db));
+        closePartition();
+        return false;
+    }
+    // The writer holds its lock only for single-row inserts; wait instead of failing.
+    sqlite3_busy_timeout(db, 1000);
+    if (!scan.open(db)) {
+        spdlog::error("Failed to prepare export statement: {}", sqlite3_errmsg(db));
+        closePartition();
+        return false;
+    }
+    last_id = 0;
+    return true;
+}
+
+void HistoryCursor::closePartition() {
+    scan.close();
+    if (db) {
+        sqlite3_close(db);
+        db = nullptr;
+    }
+}
+
+void HistoryCursor::close() {
+    closePartition();
+    interpolator.reset();
+    partitions.clear();
+    next_partition = 0;
+}
+
+bool HistoryCursor::next(std::string& out, size_t max_rows) {
+    if (finished || error)
+        return false;
+    if (!started) {
+        started = true;
+        if (format == ExportFormat::Csv) {
+            out.append("id,timestamp_ms," + signalNames(",") + "\n");
+        } else {
+            out.append(kBinaryMagic, sizeof(kBinaryMagic));
+            appendLittleEndian(out, kBinaryVersion);
+        }
+    }
+    return step_ms > 0 ? nextInterpolated(out, max_rows) : nextStored(out, max_rows);
+}
+
+bool HistoryCursor::nextStored(std::string& out, size_t max_rows) {
+    thread_local Columns columns;
+    columns.clear();
+    size_t n = 0;
+    if (db) {
+        scan.seek(last_id, from_ms, to_ms);
+        StoredSample sample;
+        while (n < max_rows && scan.next(sample)) {
+            int32_t values[kSignalCount];
+            for (size_t i = 0; i < kSignalCount; ++i) {
+                // Signals not sampled in this row (multi-rate sampling) are NULL.
+                values[i] = (sample.present & (1u << i)) ? (carried[i] = signalValue(sample.values, i)) : carried[i];
+            }
+            appendRow(out, columns, format, sample.id, sample.timestamp_ms, values, sample.present);
+            last_id = sample.id;
+            ++n;
+        }
+        const bool failed = scan.failed();
+        // Pausing ends the read transaction between chunks.
+        scan.pause();
+        if (failed) {
+            error = true;
+            return false;
+        }
+    }
+    rows += n;
+    appendBlock(out, columns);
+
+    if (n < max_rows) {
+        // A short chunk means this partition is exhausted; move on to the next one.
+        closePartition();
+        if (next_partition < partitions.size()) {
+            if (!openPartition(partitions[next_partition++])) {
+                error = true;
+                return false;
+            }
+            return true;
+        }
+        finish(out);
+    }
+    return true;
+}
+
+bool HistoryCursor::nextInterpolated(std::string& out, size_t max_rows) {
+    thread_local Columns columns;
+    columns.clear();
+    size_t n = 0;
+    while (n < max_rows && next_ms < to_ms) {
+        EngineSample sample;
+        uint8_t known = 0;
+        if (!interpolator->at(next_ms, sample, known)) {
+            error = true;
+            return false;
+        }
+        int32_t values[kSignalCount];
+        for (size_t i = 0; i < kSignalCount; ++i)
+            values[i] = signalValue(sample, i);
+        appendRow(out, columns, format, static_cast<int64_t>(rows + n + 1), next_ms, values, known);
+        ++n;
+        next_ms = step_ms > to_ms - next_ms ? to_ms : next_ms + step_ms;
+    }
+    // As with stored rows, no read transaction stays open between chunks.
+    interpolator->pause();
+    rows += n;
+    appendBlock(out, columns);
+    if (next_ms >= to_ms)
+        finish(out);
+    return true;
+}
+
+void HistoryCursor::finish(std::string& out) {
+    finished = true;
+    if (format == ExportFormat::Binary)
+        appendLittleEndian(out, uint32_t{0});
+    close();
+}
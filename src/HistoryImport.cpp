@@ -0,0 +1,343 @@
+#include "HistoryImport.h"
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string_view>
+#include <vector>
+#include <sqlite3.h>
+#include <spdlog/spdlog.h>
+#include "Engine.h"
+
+namespace {
+
+// Row layout: the timestamp, then the signals in signal order.
+constexpr int Timestamp = 0;
+constexpr int kColumns = static_cast<int>(kSignalCount) + 1;
+
+constexpr size_t kReadBlockBytes = 1 << 20;
+// Row value of a signal a CSV row left empty (not sampled); inserted as NULL.
+constexpr int64_t kNull = std::numeric_limits<int64_t>::min();
+
+bool exec(sqlite3* db, const char* sql) {
+    char* err = nullptr;
+    if (sqlite3_exec(db, sql, nullptr, nullptr, &err) != SQLITE_OK) {
+        spdlog::error("SQL error in '{}': {}", sql, err ? err : "unknown");
+        sqlite3_free(err);
+        return false;
+    }
+    return true;
+}
+
+// Inserts rows through one prepared statement, committing every `chunk_rows`.
+class BulkWriter {
+public:
+    BulkWriter(sqlite3* db, size_t chunk_rows) : db(db), chunk_rows(chunk_rows) {}
+    ~BulkWriter() {
+        if (stmt)
+            sqlite3_finalize(stmt);
+    }
+
+    bool prepare() {
+        if (sqlite3_prepare_v2(db, engineValuesInsertSql().c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+            spdlog::error("Failed to prepare statement: {}", sqlite3_errmsg(db));
+            return false;
+        }
+        return true;
+    }
+
+    bool insert(const std::array<int64_t, kColumns>& row) {
+        if (in_chunk == 0 && !exec(db, "BEGIN;"))
+            return false;
+        // engineValuesInsertSql() binds the signals first and the timestamp last.
+        for (int i = 1; i < kColumns; ++i) {
+            if (row[i] == kNull)
+                sqlite3_bind_null(stmt, i);
+            else
+                sqlite3_bind_int(stmt, i, static_cast<int>(row[i]));
+        }
+        sqlite3_bind_int64(stmt, kColumns, row[Timestamp]);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            spdlog::error("Failed to execute statement: {}", sqlite3_errmsg(db));
+            sqlite3_reset(stmt);
+            return false;
+        }
+        sqlite3_reset(stmt);
+        ++rows;
+        if (++in_chunk == chunk_rows)
+            return commit();
+        return true;
+    }
+
+    bool commit() {
+        if (in_chunk == 0)
+            return true;
+        in_chunk = 0;
+        if (!exec(db, "COMMIT;"))
+            return false;
+        committed = rows;
+        return true;
+    }
+
+    void rollback() {
+        if (in_chunk > 0)
+            exec(db, "ROLLBACK;");
+        in_chunk = 0;
+        rows = committed;
+    }
+
+    uint64_t rows = 0;
+    uint64_t committed = 0;
+
+private:
+    sqlite3* db;
+    sqlite3_stmt* stmt = nullptr;
+    size_t chunk_rows;
+    size_t in_chunk = 0;
+};
+
+std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+        s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r'))
+        s.remove_suffix(1);
+    return s;
+}
+
+class CsvLoader {
+public:
+    CsvLoader(BulkWriter& writer, ImportStats& stats) : writer(writer), stats(stats) {
+        // Without a header the export order applies: id,timestamp_ms,rpm,...
+        mapping = {-1, Timestamp};
+        for (int i = 1; i < kColumns; ++i)
+            mapping.push_back(i);
+    }
+
+    bool line(std::string_view text) {
+        text = trim(text);
+        if (text.empty())
+            return true;
+        if (first_line) {
+            first_line = false;
+            const char c = text.front();
+            if (!(c >= '0' && c <= '9') && c != '-')
+                return header(text);
+        }
+        std::array<int64_t, kColumns> row{};
+        int seen = 0;
+        size_t field = 0;
+        while (true) {
+            const size_t comma = text.find(',');
+            std::string_view value = trim(text.substr(0, comma));
+            if (field < mapping.size() && mapping[field] > Timestamp && value.empty()) {
+                row[mapping[field]] = kNull;
+                ++seen;
+            } else if (field < mapping.size() && mapping[field] >= 0) {
+                int64_t v;
+                auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), v);
+                if (ec != std::errc() || end != value.data() + value.size()) {
+                    ++stats.skipped;
+                    return true;
+                }
+                row[mapping[field]] = v;
+                ++seen;
+            }
+            ++field;
+            if (comma == std::string_view::npos)
+                break;
+            text.remove_prefix(comma + 1);
+        }
+        if (seen != kColumns) {
+            ++stats.skipped;
+            return true;
+        }
+        return writer.insert(row);
+    }
+
+private:
+    bool header(std::string_view text) {
+        mapping.clear();
+        int found = 0;
+        while (true) {
+            const size_t comma = text.find(',');
+            std::string_view name = trim(text.substr(0, comma));
+            int column = signalIndex(name);
+            if (column >= 0)
+                ++column;
+            else if (name == "timestamp_ms" || name == "timestamp")
+                column = Timestamp;
+            found += column >= 0;
+            mapping.push_back(column);
+            if (comma == std::string_view::npos)
+                break;
+            text.remove_prefix(comma + 1);
+        }
+        if (found != kColumns) {
+            spdlog::error("CSV header must name timestamp_ms and {}", signalNames());
+            return false;
+        }
+        return true;
+    }
+
+    BulkWriter& writer;
+    ImportStats& stats;
+    std::vector<int> mapping;
+    bool first_line = true;
+};
+
+bool loadCsv(FILE* file, BulkWriter& writer, ImportStats& stats) {
+    CsvLoader loader(writer, stats);
+    std::vector<char> block(kReadBlockBytes);
+    std::string carry;
+    size_t n;
+    while ((n = std::fread(block.data(), 1, block.size(), file)) > 0) {
+        std::string_view data(block.data(), n);
+        size_t nl;
+        while ((nl = data.find('\n')) != std::string_view::npos) {
+            bool ok;
+            if (!carry.empty()) {
+                carry.append(data.substr(0, nl));
+                ok = loader.line(carry);
+                carry.clear();
+            } else {
+                ok = loader.line(data.substr(0, nl));
+            }
+            if (!ok)
+                return false;
+            data.remove_prefix(nl + 1);
+        }
+        carry.append(data);
+    }
+    return carry.empty() || loader.line(carry);
+}
+
+// Binary files are read block by block; only one block's columns are in memory.
+bool loadBinary(FILE* file, BulkWriter& writer) {
+    char header[8];
+    if (std::fread(header, 1, sizeof(header), file) != sizeof(header) || std::memcmp(header, "MWCB", 4) != 0) {
+        spdlog::error("Not a binary history file");
+        return false;
+    }
+    uint32_t version;
+    std::memcpy(&version, header + 4, sizeof(version));
+    if (version != 1) {
+        spdlog::error("Unsupported binary history version {}", version);
+        return false;
+    }
+    std::vector<int64_t> ids, timestamps;
+    std::vector<int32_t> values[kSignalCount];
+    while (true) {
+        uint32_t rows;
+        if (std::fread(&rows, sizeof(rows), 1, file) != 1) {
+            spdlog::error("Binary history file is truncated");
+            return false;
+        }
+        if (rows == 0)
+            return true;
+        ids.resize(rows);
+        timestamps.resize(rows);
+        bool ok = std::fread(ids.data(), sizeof(int64_t), rows, file) == rows &&
+                  std::fread(timestamps.data(), sizeof(int64_t), rows, file) == rows;
+        for (auto& column : values) {
+            column.resize(rows);
+            ok = ok && std::fread(column.data(), sizeof(int32_t), rows, file) == rows;
+        }
+        if (!ok) {
+            spdlog::error("Binary history file is truncated");
+            return false;
+        }
+        std::array<int64_t, kColumns> row;
+        for (uint32_t i = 0; i < rows; ++i) {
+            row[Timestamp] = timestamps[i];
+            for (size_t s = 0; s < kSignalCount; ++s)
+                row[s + 1] = values[s][i];
+            if (!writer.insert(row))
+                return false;
+        }
+    }
+}
+
+// Returns the CREATE INDEX statements of engine_values' secondary indexes.
+std::vector<std::string> secondaryIndexes(sqlite3* db) {
+    std::vector<std::string> sql;
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, "SELECT sql FROM sqlite_master WHERE type = 'index' AND tbl_name = 'engine_values' AND sql IS NOT NULL;",
+                           -1, &stmt, nullptr) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW)
+            sql.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)));
+        sqlite3_finalize(stmt);
+    }
+    return sql;
+}
+
+} // namespace
+
+bool importHistory(const std::string& db_path, const std::string& file_path, ImportStats& stats,
+                   const ImportOptions& options) {
+    stats = ImportStats{};
+    std::error_code ec;
+    if (std::filesystem::is_directory(db_path, ec)) {
+        spdlog::error("{} is a partition directory; import into a single database file", db_path);
+        return false;
+    }
+    // The load drops the timestamp index and takes ids a running server's block
+    // writer may already have reserved, so it needs the database to itself.
+    WriterLock lock;
+    if (!lock.acquire(db_path, true)) {
+        spdlog::error("{} is in use by a running server; stop it before importing", db_path);
+        return false;
+    }
+    FILE* file = std::fopen(file_path.c_str(), "rb");
+    if (!file) {
+        spdlog::error("Cannot open {}: {}", file_path, std::strerror(errno));
+        return false;
+    }
+    char magic[4] = {};
+    const bool binary = std::fread(magic, 1, sizeof(magic), file) == sizeof(magic) && std::memcmp(magic, "MWCB", 4) == 0;
+    std::rewind(file);
+
+    // Creates or migrates the schema the same way the server does.
+    { EngineImpl schema(db_path); }
+    sqlite3* db = nullptr;
+    if (sqlite3_open(db_path.c_str(), &db) != SQLITE_OK) {
+        spdlog::error("Cannot open database: {}", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        std::fclose(file);
+        return false;
+    }
+    sqlite3_busy_timeout(db, 5000);
+    // A crash during the load may lose the rows of the open chunk; the source file
+    // is still there to retry from.
+    exec(db, "PRAGMA synchronous=OFF;");
+    exec(db, "PRAGMA cache_size=-65536;");
+
+    const std::vector<std::string> indexes = secondaryIndexes(db);
+    for (const std::string& sql : indexes) {
+        // "CREATE INDEX name ON ..." / "CREATE UNIQUE INDEX name ON ..."
+        const size_t on = sql.find(" ON ");
+        const size_t name_start = sql.rfind(' ', on - 1) + 1;
+        exec(db, ("DROP INDEX IF EXISTS " + sql.substr(name_start, on - name_start) + ";").c_str());
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    bool ok;
+    {
+        BulkWriter writer(db, options.chunk_rows > 0 ? options.chunk_rows : 1);
+        ok = writer.prepare() && (binary ? loadBinary(file, writer) : loadCsv(file, writer, stats));
+        if (ok)
+            ok = writer.commit();
+        else
+            writer.rollback();
+        stats.rows = writer.committed;
+    }
+    for (const std::string& sql : indexes)
+        exec(db, sql.c_str());
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    sqlite3_close(db);
+    std::fclose(file);
+    return ok;
+}
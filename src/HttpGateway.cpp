@@ -0,0 +1,322 @@
+#include "HttpGateway.h"
+#include <array>
+#include <charconv>
+#include <cstring>
+
+namespace http {
+
+namespace {
+
+constexpr std::string_view kWebSocketGuid = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        char x = a[i], y = b[i];
+        if (x >= 'A' && x <= 'Z')
+            x = static_cast<char>(x - 'A' + 'a');
+        if (y >= 'A' && y <= 'Z')
+            y = static_cast<char>(y - 'A' + 'a');
+        if (x != y)
+            return false;
+    }
+    return true;
+}
+
+std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+        s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+        s.remove_suffix(1);
+    return s;
+}
+
+// Calls `f` with each comma-separated, trimmed token of a header value.
+template <typename F>
+void forEachToken(std::string_view value, F f) {
+    while (!value.empty()) {
+        const size_t comma = value.find(',');
+        f(trim(value.substr(0, comma)));
+        if (comma == std::string_view::npos)
+            break;
+        value.remove_prefix(comma + 1);
+    }
+}
+
+template <typename T>
+void appendNumber(std::string& out, T value) {
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, result.ptr);
+}
+
+const char* reasonPhrase(int status) {
+    switch (status) {
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 426: return "Upgrade Required";
+    case 431: return "Request Header Fields Too Large";
+    default: return "Error";
+    }
+}
+
+uint32_t rotl(uint32_t x, int n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+// SHA-1 is only used for the handshake's Sec-WebSocket-Accept, as RFC 6455 requires.
+std::array<uint8_t, 20> sha1(std::string_view data) {
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    std::string message(data);
+    const uint64_t bit_length = static_cast<uint64_t>(data.size()) * 8;
+    message.push_back(static_cast<char>(0x80));
+    while (message.size() % 64 != 56)
+        message.push_back('\0');
+    for (int shift = 56; shift >= 0; shift -= 8)
+        message.push_back(static_cast<char>(bit_length >> shift));
+
+    for (size_t block = 0; block < message.size(); block += 64) {
+        uint32_t w[80];
+        for (int i = 0; i < 16; ++i) {
+            const auto* p = reinterpret_cast<const uint8_t*>(message.data() + block + 4 * i);
+            w[i] = (uint32_t{p[0]} << 24) | (uint32_t{p[1]} << 16) | (uint32_t{p[2]} << 8) | p[3];
+        }
+        for (int i = 16; i < 80; ++i)
+            w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; ++i) {
+            uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            const uint32_t t = rotl(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl(b, 30);
+            b = a;
+            a = t;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+    std::array<uint8_t, 20> digest;
+    for (int i = 0; i < 5; ++i) {
+        digest[4 * i] = static_cast<uint8_t>(h[i] >> 24);
+        digest[4 * i + 1] = static_cast<uint8_t>(h[i] >> 16);
+        digest[4 * i + 2] = static_cast<uint8_t>(h[i] >> 8);
+        digest[4 * i + 3] = static_cast<uint8_t>(h[i]);
+    }
+    return digest;
+}
+
+std::string base64(const uint8_t* data, size_t size) {
+    static constexpr char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < size; i += 3) {
+        uint32_t group = uint32_t{data[i]} << 16;
+        if (i + 1 < size)
+            group |= uint32_t{data[i + 1]} << 8;
+        if (i + 2 < size)
+            group |= data[i + 2];
+        out.push_back(kAlphabet[(group >> 18) & 0x3F]);
+        out.push_back(kAlphabet[(group >> 12) & 0x3F]);
+        out.push_back(i + 1 < size ? kAlphabet[(group >> 6) & 0x3F] : '=');
+        out.push_back(i + 2 < size ? kAlphabet[group & 0x3F] : '=');
+    }
+    return out;
+}
+
+} // namespace
+
+ParseStatus parseRequestHead(std::string_view buffer, RequestHead& head) {
+    head = RequestHead{};
+    const size_t end = buffer.find("\r\n\r\n");
+    if (end == std::string_view::npos)
+        return ParseStatus::Incomplete;
+    head.length = end + 4;
+    std::string_view rest = buffer.substr(0, end + 2);
+
+    // Request line: METHOD SP target SP HTTP/1.x
+    const size_t line_end = rest.find("\r\n");
+    const std::string_view line = rest.substr(0, line_end);
+    rest.remove_prefix(line_end + 2);
+    const size_t sp1 = line.find(' ');
+    const size_t sp2 = sp1 == std::string_view::npos ? sp1 : line.find(' ', sp1 + 1);
+    if (sp2 == std::string_view::npos || sp1 == 0)
+        return ParseStatus::Malformed;
+    head.method = line.substr(0, sp1);
+    const std::string_view target = line.substr(sp1 + 1, sp2 - sp1 - 1);
+    const std::string_view version = line.substr(sp2 + 1);
+    if (target.empty() || target.front() != '/')
+        return ParseStatus::Malformed;
+    head.path = target.substr(0, target.find('?'));
+    bool http11;
+    if (version == "HTTP/1.1")
+        http11 = true;
+    else if (version == "HTTP/1.0")
+        http11 = false;
+    else
+        return ParseStatus::Malformed;
+
+    bool close = false, keep_alive = false, connection_upgrade = false, upgrade = false;
+    while (!rest.empty()) {
+        const size_t eol = rest.find("\r\n");
+        const std::string_view field = rest.substr(0, eol);
+        rest.remove_prefix(eol + 2);
+        const size_t colon = field.find(':');
+        if (colon == std::string_view::npos || colon == 0)
+            return ParseStatus::Malformed;
+        const std::string_view name = field.substr(0, colon);
+        const std::string_view value = trim(field.substr(colon + 1));
+        if (equalsIgnoreCase(name, "Connection")) {
+            forEachToken(value, [&](std::string_view token) {
+                close |= equalsIgnoreCase(token, "close");
+                keep_alive |= equalsIgnoreCase(token, "keep-alive");
+                connection_upgrade |= equalsIgnoreCase(token, "upgrade");
+            });
+        } else if (equalsIgnoreCase(name, "Upgrade")) {
+            forEachToken(value, [&](std::string_view token) { upgrade |= equalsIgnoreCase(token, "websocket"); });
+        } else if (equalsIgnoreCase(name, "Sec-WebSocket-Key")) {
+            head.websocket_key = value;
+        } else if (equalsIgnoreCase(name, "Sec-WebSocket-Version")) {
+            std::from_chars(value.data(), value.data() + value.size(), head.websocket_version);
+        } else if (equalsIgnoreCase(name, "Content-Length")) {
+            uint64_t length = 0;
+            const auto result = std::from_chars(value.data(), value.data() + value.size(), length);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size())
+                return ParseStatus::Malformed;
+            head.has_body |= length > 0;
+        } else if (equalsIgnoreCase(name, "Transfer-Encoding")) {
+            head.has_body = true;
+        }
+    }
+    head.keep_alive = http11 ? !close : keep_alive && !close;
+    head.upgrade_websocket = upgrade && connection_upgrade;
+    return ParseStatus::Ok;
+}
+
+void appendResponse(std::string& out, int status, std::string_view content_type, std::string_view body,
+                    bool keep_alive) {
+    out += "HTTP/1.1 ";
+    appendNumber(out, status);
+    out += ' ';
+    out += reasonPhrase(status);
+    out += "\r\nContent-Type: ";
+    out += content_type;
+    out += "\r\nContent-Length: ";
+    appendNumber(out, body.size());
+    // Dashboards are usually served from another origin, and a snapshot is stale at once.
+    out += "\r\nCache-Control: no-store\r\nAccess-Control-Allow-Origin: *\r\n";
+    if (status == 405)
+        out += "Allow: GET\r\n";
+    if (status == 426)
+        out += "Upgrade: websocket\r\nConnection: Upgrade\r\n";
+    else if (!keep_alive)
+        out += "Connection: close\r\n";
+    out += "\r\n";
+    out += body;
+}
+
+void appendUpgradeResponse(std::string& out, std::string_view websocket_key) {
+    out += "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: ";
+    out += websocketAccept(websocket_key);
+    out += "\r\n\r\n";
+}
+
+std::string websocketAccept(std::string_view key) {
+    std::string input(key);
+    input += kWebSocketGuid;
+    const std::array<uint8_t, 20> digest = sha1(input);
+    return base64(digest.data(), digest.size());
+}
+
+void appendSnapshotJson(std::string& out, const EngineSnapshot& snapshot, bool field_timestamps) {
+    out += "{\"sequence\":";
+    appendNumber(out, snapshot.sequence);
+    out += ",\"timestamp_ms\":";
+    appendNumber(out, snapshot.timestamp_ms);
+    forEachSignal([&](auto i) {
+        out += kSignalFields[i].json_key;
+        appendNumber(out, snapshot.values.*kSignalFields[i].member);
+    });
+    if (field_timestamps) {
+        out += ",\"field_timestamp_ms\":[";
+        for (size_t i = 0; i < snapshot.field_timestamp_ms.size(); ++i) {
+            if (i > 0)
+                out += ',';
+            appendNumber(out, snapshot.field_timestamp_ms[i]);
+        }
+        out += ']';
+    }
+    out += '}';
+}
+
+void appendWebSocketFrame(std::string& out, uint8_t opcode, std::string_view payload) {
+    out.push_back(static_cast<char>(0x80 | opcode));
+    const uint64_t size = payload.size();
+    if (size < 126) {
+        out.push_back(static_cast<char>(size));
+    } else if (size <= 0xFFFF) {
+        out.push_back(static_cast<char>(126));
+        out.push_back(static_cast<char>(size >> 8));
+        out.push_back(static_cast<char>(size));
+    } else {
+        out.push_back(static_cast<char>(127));
+        for (int shift = 56; shift >= 0; shift -= 8)
+            out.push_back(static_cast<char>(size >> shift));
+    }
+    out += payload;
+}
+
+ParseStatus parseWebSocketFrame(char* buffer, size_t size, size_t max_payload, WebSocketFrame& frame) {
+    if (size < 2)
+        return ParseStatus::Incomplete;
+    const auto* bytes = reinterpret_cast<const uint8_t*>(buffer);
+    frame.fin = (bytes[0] & 0x80) != 0;
+    frame.opcode = bytes[0] & 0x0F;
+    const bool control = (frame.opcode & 0x8) != 0;
+    const bool known = frame.opcode <= kBinary || (frame.opcode >= kClose && frame.opcode <= kPong);
+    // No extensions are negotiated, so the reserved bits must be clear.
+    if ((bytes[0] & 0x70) != 0 || !known || (bytes[1] & 0x80) == 0)
+        return ParseStatus::Malformed;
+    uint64_t length = bytes[1] & 0x7F;
+    size_t offset = 2;
+    if (length >= 126) {
+        const size_t extended = length == 126 ? 2 : 8;
+        if (size < offset + extended)
+            return ParseStatus::Incomplete;
+        length = 0;
+        for (size_t i = 0; i < extended; ++i)
+            length = (length << 8) | bytes[offset + i];
+        offset += extended;
+    }
+    if ((control && (!frame.fin || length > 125)) || length > max_payload)
+        return ParseStatus::Malformed;
+    if (size < offset + 4 + length)
+        return ParseStatus::Incomplete;
+    const uint8_t* mask = bytes + offset;
+    char* payload = buffer + offset + 4;
+    for (size_t i = 0; i < length; ++i)
+        payload[i] = static_cast<char>(payload[i] ^ mask[i % 4]);
+    frame.payload = std::string_view(payload, static_cast<size_t>(length));
+    frame.length = offset + 4 + static_cast<size_t>(length);
+    return ParseStatus::Ok;
+}
+
+} // namespace http
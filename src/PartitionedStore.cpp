@@ -0,0 +1,239 @@
+#include "PartitionedStore.h"
+#include "Engine.h"
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+constexpr int64_t kHourMs = 3600 * 1000;
+constexpr int64_t kDayMs = 24 * kHourMs;
+constexpr const char* kPrefix = "engine_values_";
+
+int64_t partitionLength(Partitioning granularity) {
+    return granularity == Partitioning::Hour ? kHourMs : kDayMs;
+}
+
+std::string partitionName(int64_t start_ms, Partitioning granularity) {
+    const time_t seconds = static_cast<time_t>(start_ms / 1000);
+    struct tm utc;
+    gmtime_r(&seconds, &utc);
+    char name[64];
+    if (granularity == Partitioning::Hour)
+        std::snprintf(name, sizeof(name), "%s%04d%02d%02d%02d.db", kPrefix, utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday, utc.tm_hour);
+    else
+        std::snprintf(name, sizeof(name), "%s%04d%02d%02d.db", kPrefix, utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday);
+    return name;
+}
+
+// Parses a partition file name back into its time range.
+bool parsePartitionName(const std::string& name, PartitionInfo& info) {
+    const std::string prefix = kPrefix;
+    if (name.compare(0, prefix.size(), prefix) != 0 || name.size() < prefix.size() + 3 ||
+        name.compare(name.size() - 3, 3, ".db") != 0)
+        return false;
+    const std::string digits = name.substr(prefix.size(), name.size() - prefix.size() - 3);
+    if ((digits.size() != 8 && digits.size() != 10) || !std::all_of(digits.begin(), digits.end(), ::isdigit))
+        return false;
+    struct tm utc{};
+    utc.tm_year = std::stoi(digits.substr(0, 4)) - 1900;
+    utc.tm_mon = std::stoi(digits.substr(4, 2)) - 1;
+    utc.tm_mday = std::stoi(digits.substr(6, 2));
+    utc.tm_hour = digits.size() == 10 ? std::stoi(digits.substr(8, 2)) : 0;
+    info.start_ms = static_cast<int64_t>(timegm(&utc)) * 1000;
+    info.end_ms = info.start_ms + (digits.size() == 10 ? kHourMs : kDayMs);
+    return true;
+}
+
+void unlinkDatabase(const std::string& path) {
+    std::error_code ec;
+    for (const char* suffix : {"", "-wal", "-shm", "-journal"})
+        std::filesystem::remove(path + suffix, ec);
+}
+
+} // namespace
+
+PartitionedStore::~PartitionedStore() {
+    close();
+}
+
+bool PartitionedStore::open(const std::string& directory, Partitioning granularity) {
+    close();
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (!std::filesystem::is_directory(directory)) {
+        spdlog::error("Cannot create partition directory {}: {}", directory, ec.message());
+        return false;
+    }
+    this->directory = directory;
+    this->granularity = granularity == Partitioning::Hour ? Partitioning::Hour : Partitioning::Day;
+    return true;
+}
+
+void PartitionedStore::close() {
+    closeLive();
+    directory.clear();
+}
+
+void PartitionedStore::closeLive() {
+    if (insert_stmt) {
+        sqlite3_finalize(insert_stmt);
+        insert_stmt = nullptr;
+    }
+    if (alert_stmt) {
+        sqlite3_finalize(alert_stmt);
+        alert_stmt = nullptr;
+    }
+    if (db) {
+        sqlite3_close(db);
+        db = nullptr;
+    }
+    live = PartitionInfo{};
+}
+
+bool PartitionedStore::prepare(sqlite3_stmt** stmt, const char* sql) {
+    if (sqlite3_prepare_v2(db, sql, -1, stmt, nullptr) != SQLITE_OK) {
+        spdlog::error("Failed to prepare statement: {}", sqlite3_errmsg(db));
+        return false;
+    }
+    return true;
+}
+
+// Makes the partition covering `timestamp_ms` the live one. Statements are prepared
+// once per partition and reused for every insert.
+bool PartitionedStore::roll(int64_t timestamp_ms) {
+    if (db && timestamp_ms >= live.start_ms && timestamp_ms < live.end_ms)
+        return true;
+    closeLive();
+    if (directory.empty())
+        return false;
+    const int64_t length = partitionLength(granularity);
+    const int64_t start = timestamp_ms - ((timestamp_ms % length) + length) % length;
+    const std::string path = (std::filesystem::path(directory) / partitionName(start, granularity)).string();
+    if (sqlite3_open(path.c_str(), &db) != SQLITE_OK) {
+        spdlog::error("Cannot open partition {}: {}", path, sqlite3_errmsg(db));
+        sqlite3_close(db);
+        db = nullptr;
+        return false;
+    }
+    sqlite3_exec(db, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
+    const bool ok = initEngineSchema(db) &&
+        sqlite3_exec(db, "CREATE INDEX IF NOT EXISTS idx_engine_values_timestamp ON engine_values(timestamp);",
+                     nullptr, nullptr, nullptr) == SQLITE_OK &&
+        prepare(&insert_stmt, engineValuesInsertSql().c_str()) &&
+        prepare(&alert_stmt, alertEventsInsertSql().c_str());
+    if (!ok) {
+        spdlog::error("Cannot initialize partition {}", path);
+        closeLive();
+        return false;
+    }
+    live.path = path;
+    live.start_ms = start;
+    live.end_ms = start + length;
+    spdlog::info("Writing partition {}", path);
+    return true;
+}
+
+bool PartitionedStore::insert(int64_t timestamp_ms, int rpm, int temperature, int oil_pressure, int speed) {
+    return insert(timestamp_ms, EngineSample{rpm, temperature, oil_pressure, speed}, kAllSignals);
+}
+
+bool PartitionedStore::insert(int64_t timestamp_ms, const EngineSample& values, uint8_t fresh) {
+    if (!roll(timestamp_ms))
+        return false;
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        if (fresh & (1u << i))
+            sqlite3_bind_int(insert_stmt, static_cast<int>(i) + 1, signalValue(values, i));
+        else
+            sqlite3_bind_null(insert_stmt, static_cast<int>(i) + 1);
+    }
+    sqlite3_bind_int64(insert_stmt, static_cast<int>(kSignalCount) + 1, timestamp_ms);
+    const int rc = sqlite3_step(insert_stmt);
+    sqlite3_reset(insert_stmt);
+    if (rc != SQLITE_DONE) {
+        spdlog::error("Failed to execute statement: {}", sqlite3_errmsg(db));
+        return false;
+    }
+    return true;
+}
+
+bool PartitionedStore::insertAlert(const std::string& rule, bool raised, int64_t timestamp_ms,
+                                   const EngineSample& values) {
+    if (!roll(timestamp_ms))
+        return false;
+    sqlite3_bind_text(alert_stmt, 1, rule.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int(alert_stmt, 2, raised ? 1 : 0);
+    for (size_t i = 0; i < kSignalCount; ++i)
+        sqlite3_bind_int(alert_stmt, static_cast<int>(i) + 3, signalValue(values, i));
+    sqlite3_bind_int64(alert_stmt, static_cast<int>(kSignalCount) + 3, timestamp_ms);
+    const int rc = sqlite3_step(alert_stmt);
+    sqlite3_reset(alert_stmt);
+    if (rc != SQLITE_DONE) {
+        spdlog::error("Failed to execute statement: {}", sqlite3_errmsg(db));
+        return false;
+    }
+    return true;
+}
+
+size_t PartitionedStore::dropBefore(int64_t cutoff_ms) {
+    size_t dropped = 0;
+    for (const PartitionInfo& p : list(directory)) {
+        if (p.end_ms > cutoff_ms || p.path == live.path)
+            continue;
+        unlinkDatabase(p.path);
+        spdlog::info("Retention removed partition {}", p.path);
+        ++dropped;
+    }
+    return dropped;
+}
+
+std::vector<PartitionInfo> PartitionedStore::list(const std::string& directory) {
+    std::vector<PartitionInfo> partitions;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        PartitionInfo info;
+        if (entry.is_regular_file() && parsePartitionName(entry.path().filename().string(), info)) {
+            info.path = entry.path().string();
+            partitions.push_back(std::move(info));
+        }
+    }
+    std::sort(partitions.begin(), partitions.end(),
+              [](const PartitionInfo& a, const PartitionInfo& b) { return a.start_ms < b.start_ms; });
+    return partitions;
+}
+
+std::vector<PartitionInfo> PartitionedStore::overlapping(const std::string& directory, int64_t from_ms, int64_t to_ms) {
+    std::vector<PartitionInfo> partitions = list(directory);
+    std::erase_if(partitions, [&](const PartitionInfo& p) { return p.end_ms <= from_ms || p.start_ms >= to_ms; });
+    return partitions;
+}
+
+int PartitionedStore::attach(sqlite3* db, const std::string& directory, int64_t from_ms, int64_t to_ms) {
+    const std::vector<PartitionInfo> partitions = overlapping(directory, from_ms, to_ms);
+    if (static_cast<int>(partitions.size()) > sqlite3_limit(db, SQLITE_LIMIT_ATTACHED, -1)) {
+        spdlog::error("{} partitions exceed SQLite's attach limit", partitions.size());
+        return -1;
+    }
+    std::string view = "CREATE TEMP VIEW engine_values_all AS ";
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        char* quoted = sqlite3_mprintf("ATTACH DATABASE %Q AS p%d;", partitions[i].path.c_str(), static_cast<int>(i));
+        const int rc = sqlite3_exec(db, quoted, nullptr, nullptr, nullptr);
+        sqlite3_free(quoted);
+        if (rc != SQLITE_OK) {
+            spdlog::error("Cannot attach {}: {}", partitions[i].path, sqlite3_errmsg(db));
+            return -1;
+        }
+        if (i > 0)
+            view += " UNION ALL ";
+        view += "SELECT id, " + signalNames() + ", timestamp FROM p" + std::to_string(i) + ".engine_values";
+    }
+    if (partitions.empty())
+        view += "SELECT 0 AS id, " + signalNames(", ", "0 AS ") + ", 0 AS timestamp WHERE 0";
+    if (sqlite3_exec(db, (view + ";").c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+        spdlog::error("Cannot create partition view: {}", sqlite3_errmsg(db));
+        return -1;
+    }
+    return static_cast<int>(partitions.size());
+}
@@ -0,0 +1,128 @@
+#include "RollingStats.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Histograms cover the kSignalFields ranges, which Receiver also uses. Values
+// outside are counted in the edge bins, and quantiles are clamped to the window's
+// min/max.
+std::array<int, kSignalCount> toArray(const EngineSample& s) {
+    return applySignals([](auto... v) { return std::array<int, kSignalCount>{v...}; }, s);
+}
+
+size_t binOf(size_t signal, int value) {
+    const SignalField& r = kSignalFields[signal];
+    if (value <= r.min)
+        return 0;
+    if (value >= r.max)
+        return RollingWindow::kHistogramBins - 1;
+    return static_cast<size_t>(static_cast<int64_t>(value - r.min) * RollingWindow::kHistogramBins / (r.max - r.min));
+}
+
+} // namespace
+
+RollingWindow::RollingWindow(int64_t window_ms) : window_ms(window_ms) {}
+
+void RollingWindow::add(int64_t timestamp_ms, const EngineSample& sample) {
+    const auto values = toArray(sample);
+    const double dt = entries.empty() ? 0.0 : static_cast<double>(timestamp_ms - entries.back().timestamp_ms);
+    const double alpha = entries.empty() ? 1.0 : 1.0 - std::exp(-std::max(dt, 0.0) / static_cast<double>(window_ms));
+
+    evictOlderThan(timestamp_ms - window_ms);
+    const uint64_t n = next_n++;
+    entries.push_back({n, timestamp_ms, values});
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        SignalState& s = signals[i];
+        const int v = values[i];
+        s.sum += v;
+        while (!s.min_queue.empty() && s.min_queue.back().value >= v)
+            s.min_queue.pop_back();
+        s.min_queue.push_back({n, v});
+        while (!s.max_queue.empty() && s.max_queue.back().value <= v)
+            s.max_queue.pop_back();
+        s.max_queue.push_back({n, v});
+        ++s.histogram[binOf(i, v)];
+        s.ewma += alpha * (v - s.ewma);
+    }
+}
+
+void RollingWindow::evictOlderThan(int64_t cutoff_ms) {
+    while (!entries.empty() && entries.front().timestamp_ms <= cutoff_ms) {
+        const Entry& e = entries.front();
+        for (size_t i = 0; i < kSignalCount; ++i) {
+            SignalState& s = signals[i];
+            s.sum -= e.values[i];
+            --s.histogram[binOf(i, e.values[i])];
+            if (s.min_queue.front().n == e.n)
+                s.min_queue.pop_front();
+            if (s.max_queue.front().n == e.n)
+                s.max_queue.pop_front();
+        }
+        entries.pop_front();
+    }
+}
+
+// Linear interpolation inside the bin holding the q-th sample.
+double RollingWindow::quantile(size_t signal, double q) const {
+    const SignalState& s = signals[signal];
+    const double target = q * static_cast<double>(entries.size());
+    const SignalField& r = kSignalFields[signal];
+    const double width = static_cast<double>(r.max - r.min) / kHistogramBins;
+    double cumulative = 0.0;
+    double result = r.max;
+    for (size_t b = 0; b < kHistogramBins; ++b) {
+        const double count = s.histogram[b];
+        if (count > 0 && cumulative + count >= target) {
+            result = r.min + width * (static_cast<double>(b) + (target - cumulative) / count);
+            break;
+        }
+        cumulative += count;
+    }
+    return std::clamp(result, static_cast<double>(s.min_queue.front().value),
+                      static_cast<double>(s.max_queue.front().value));
+}
+
+WindowSummary RollingWindow::summary() const {
+    WindowSummary out;
+    out.window_ms = window_ms;
+    out.count = static_cast<uint32_t>(entries.size());
+    if (entries.empty())
+        return out;
+    const Entry& oldest = entries.front();
+    const Entry& newest = entries.back();
+    const double elapsed_s = static_cast<double>(newest.timestamp_ms - oldest.timestamp_ms) / 1000.0;
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        const SignalState& s = signals[i];
+        SignalSummary& o = out.signals[i];
+        o.mean = static_cast<double>(s.sum) / static_cast<double>(entries.size());
+        o.min = s.min_queue.front().value;
+        o.max = s.max_queue.front().value;
+        o.rate_per_s = elapsed_s > 0.0 ? (newest.values[i] - oldest.values[i]) / elapsed_s : 0.0;
+        o.ewma = s.ewma;
+        o.p50 = quantile(i, 0.50);
+        o.p90 = quantile(i, 0.90);
+        o.p99 = quantile(i, 0.99);
+    }
+    return out;
+}
+
+RollingStats::RollingStats(const std::vector<int64_t>& windows_ms) {
+    for (int64_t w : windows_ms) {
+        if (w > 0)
+            windows.emplace_back(w);
+    }
+}
+
+void RollingStats::add(int64_t timestamp_ms, const EngineSample& sample) {
+    for (RollingWindow& w : windows)
+        w.add(timestamp_ms, sample);
+}
+
+std::vector<WindowSummary> RollingStats::summary() const {
+    std::vector<WindowSummary> out;
+    out.reserve(windows.size());
+    for (const RollingWindow& w : windows)
+        out.push_back(w.summary());
+    return out;
+}
@@ -0,0 +1,338 @@
+#include "RuleEngine.h"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+struct Token {
+    enum Kind { End, Number, Ident, Symbol } kind = End;
+    std::string text;
+    double number = 0.0;
+};
+
+class Lexer {
+public:
+    explicit Lexer(const std::string& src) : src(src) {}
+
+    bool next(Token& tok, std::string& error) {
+        while (pos < src.size() && std::isspace(static_cast<unsigned char>(src[pos])))
+            ++pos;
+        tok = Token{};
+        if (pos >= src.size())
+            return true;
+        const char c = src[pos];
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+            char* end = nullptr;
+            tok.number = std::strtod(src.c_str() + pos, &end);
+            const size_t len = static_cast<size_t>(end - (src.c_str() + pos));
+            if (len == 0) {
+                error = "invalid number at column " + std::to_string(pos + 1);
+                return false;
+            }
+            tok.kind = Token::Number;
+            tok.text = src.substr(pos, len);
+            pos += len;
+            return true;
+        }
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            size_t start = pos;
+            while (pos < src.size() && (std::isalnum(static_cast<unsigned char>(src[pos])) || src[pos] == '_'))
+                ++pos;
+            tok.kind = Token::Ident;
+            tok.text = src.substr(start, pos - start);
+            return true;
+        }
+        static const char* two_char[] = {"<=", ">=", "==", "!=", "&&", "||"};
+        for (const char* op : two_char) {
+            if (src.compare(pos, 2, op) == 0) {
+                tok.kind = Token::Symbol;
+                tok.text = op;
+                pos += 2;
+                return true;
+            }
+        }
+        if (std::strchr("<>!+-*/()", c) != nullptr) {
+            tok.kind = Token::Symbol;
+            tok.text = std::string(1, c);
+            ++pos;
+            return true;
+        }
+        error = std::string("unexpected character '") + c + "' at column " + std::to_string(pos + 1);
+        return false;
+    }
+
+private:
+    const std::string& src;
+    size_t pos = 0;
+};
+
+// Recursive-descent compiler from condition text to postfix bytecode. Tracks the
+// operand stack depth so evaluation can use a fixed-size stack.
+class Compiler {
+public:
+    Compiler(const std::string& src, std::vector<RuleEngine::Instr>& out) : lexer(src), out(out) {}
+
+    bool compile(int64_t& hold_ms, std::string& error) {
+        if (!advance(error) || !parseOr(error))
+            return false;
+        hold_ms = 0;
+        if (tok.kind == Token::Ident && tok.text == "for") {
+            if (!advance(error))
+                return false;
+            if (tok.kind != Token::Number) {
+                error = "expected duration after 'for'";
+                return false;
+            }
+            double amount = tok.number;
+            if (!advance(error))
+                return false;
+            if (tok.kind == Token::Ident && (tok.text == "ms" || tok.text == "s")) {
+                if (tok.text == "s")
+                    amount *= 1000.0;
+                if (!advance(error))
+                    return false;
+            } else {
+                error = "expected 'ms' or 's' after duration";
+                return false;
+            }
+            hold_ms = static_cast<int64_t>(amount);
+        }
+        if (tok.kind != Token::End) {
+            error = "unexpected '" + tok.text + "'";
+            return false;
+        }
+        return true;
+    }
+
+private:
+    bool advance(std::string& error) { return lexer.next(tok, error); }
+
+    bool isSymbol(const char* s) const { return tok.kind == Token::Symbol && tok.text == s; }
+    bool isWord(const char* s) const { return tok.kind == Token::Ident && tok.text == s; }
+
+    bool emit(RuleEngine::Op op, int stack_delta, std::string& error, uint8_t signal = 0, double constant = 0.0) {
+        out.push_back({op, signal, constant});
+        depth += stack_delta;
+        if (depth > static_cast<int>(RuleEngine::kMaxStackDepth)) {
+            error = "expression too deeply nested";
+            return false;
+        }
+        return true;
+    }
+
+    bool parseOr(std::string& error) {
+        if (!parseAnd(error))
+            return false;
+        while (isSymbol("||") || isWord("or")) {
+            if (!advance(error) || !parseAnd(error) || !emit(RuleEngine::Op::Or, -1, error))
+                return false;
+        }
+        return true;
+    }
+
+    bool parseAnd(std::string& error) {
+        if (!parseComparison(error))
+            return false;
+        while (isSymbol("&&") || isWord("and") || isWord("while")) {
+            if (!advance(error) || !parseComparison(error) || !emit(RuleEngine::Op::And, -1, error))
+                return false;
+        }
+        return true;
+    }
+
+    bool parseComparison(std::string& error) {
+        if (!parseSum(error))
+            return false;
+        static const std::pair<const char*, RuleEngine::Op> ops[] = {
+            {"<", RuleEngine::Op::Lt}, {"<=", RuleEngine::Op::Le}, {">", RuleEngine::Op::Gt},
+            {">=", RuleEngine::Op::Ge}, {"==", RuleEngine::Op::Eq}, {"!=", RuleEngine::Op::Ne},
+        };
+        for (const auto& [text, op] : ops) {
+            if (isSymbol(text)) {
+                return advance(error) && parseSum(error) && emit(op, -1, error);
+            }
+        }
+        return true;
+    }
+
+    bool parseSum(std::string& error) {
+        if (!parseProduct(error))
+            return false;
+        while (isSymbol("+") || isSymbol("-")) {
+            const RuleEngine::Op op = isSymbol("+") ? RuleEngine::Op::Add : RuleEngine::Op::Sub;
+            if (!advance(error) || !parseProduct(error) || !emit(op, -1, error))
+                return false;
+        }
+        return true;
+    }
+
+    bool parseProduct(std::string& error) {
+        if (!parseUnary(error))
+            return false;
+        while (isSymbol("*") || isSymbol("/")) {
+            const RuleEngine::Op op = isSymbol("*") ? RuleEngine::Op::Mul : RuleEngine::Op::Div;
+            if (!advance(error) || !parseUnary(error) || !emit(op, -1, error))
+                return false;
+        }
+        return true;
+    }
+
+    bool parseUnary(std::string& error) {
+        if (isSymbol("-") || isSymbol("!")) {
+            const RuleEngine::Op op = isSymbol("-") ? RuleEngine::Op::Neg : RuleEngine::Op::Not;
+            return advance(error) && parseUnary(error) && emit(op, 0, error);
+        }
+        return parsePrimary(error);
+    }
+
+    bool parsePrimary(std::string& error) {
+        if (tok.kind == Token::Number) {
+            const double value = tok.number;
+            return advance(error) && emit(RuleEngine::Op::PushConst, 1, error, 0, value);
+        }
+        if (isSymbol("(")) {
+            if (!advance(error) || !parseOr(error))
+                return false;
+            if (!isSymbol(")")) {
+                error = "expected ')'";
+                return false;
+            }
+            return advance(error);
+        }
+        if (isWord("rate")) {
+            if (!advance(error))
+                return false;
+            if (!isSymbol("(")) {
+                error = "expected '(' after rate";
+                return false;
+            }
+            if (!advance(error))
+                return false;
+            const int signal = tok.kind == Token::Ident ? signalIndex(tok.text) : -1;
+            if (signal < 0) {
+                error = "rate() needs a signal name";
+                return false;
+            }
+            if (!advance(error))
+                return false;
+            if (!isSymbol(")")) {
+                error = "expected ')' after rate signal";
+                return false;
+            }
+            return advance(error) && emit(RuleEngine::Op::LoadRate, 1, error, static_cast<uint8_t>(signal));
+        }
+        if (tok.kind == Token::Ident) {
+            const int signal = signalIndex(tok.text);
+            if (signal < 0) {
+                error = "unknown signal '" + tok.text + "'";
+                return false;
+            }
+            return advance(error) && emit(RuleEngine::Op::LoadSignal, 1, error, static_cast<uint8_t>(signal));
+        }
+        error = tok.kind == Token::End ? "unexpected end of rule" : "unexpected '" + tok.text + "'";
+        return false;
+    }
+
+    Lexer lexer;
+    std::vector<RuleEngine::Instr>& out;
+    Token tok;
+    int depth = 0;
+};
+
+std::string trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return b == std::string::npos ? std::string() : s.substr(b, e - b + 1);
+}
+
+} // namespace
+
+bool RuleEngine::addRule(const std::string& text, std::string* error) {
+    std::string message;
+    const size_t colon = text.find(':');
+    const std::string name = colon == std::string::npos ? std::string() : trim(text.substr(0, colon));
+    if (name.empty()) {
+        message = "rule must start with '<name>:'";
+    } else {
+        std::vector<Instr> compiled;
+        int64_t hold_ms = 0;
+        const std::string condition = text.substr(colon + 1);
+        Compiler compiler(condition, compiled);
+        if (compiler.compile(hold_ms, message)) {
+            Rule rule;
+            rule.name = name;
+            rule.code_begin = static_cast<uint32_t>(code.size());
+            code.insert(code.end(), compiled.begin(), compiled.end());
+            rule.code_end = static_cast<uint32_t>(code.size());
+            rule.hold_ms = hold_ms;
+            rules.push_back(std::move(rule));
+            return true;
+        }
+    }
+    if (error)
+        *error = message;
+    return false;
+}
+
+void RuleEngine::evaluate(const EngineSnapshot& snapshot, std::vector<AlertEvent>& events) {
+    const EngineSample& s = snapshot.values;
+    double values[kSignalCount];
+    for (size_t i = 0; i < kSignalCount; ++i)
+        values[i] = static_cast<double>(signalValue(s, i));
+    // A signal that was not resampled carries its old value, so its rate only moves
+    // when a fresh sample arrives and is measured against when that was taken.
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        if (!(snapshot.fresh & (1u << i)))
+            continue;
+        const int64_t timestamp_ms = snapshot.field_timestamp_ms[i];
+        if ((sampled & (1u << i)) && timestamp_ms > previous_timestamp_ms[i])
+            rates[i] = (values[i] - previous[i]) / (static_cast<double>(timestamp_ms - previous_timestamp_ms[i]) / 1000.0);
+        previous[i] = values[i];
+        previous_timestamp_ms[i] = timestamp_ms;
+        sampled |= static_cast<uint8_t>(1u << i);
+    }
+
+    double stack[kMaxStackDepth];
+    const Instr* const base = code.data();
+    for (Rule& rule : rules) {
+        size_t sp = 0;
+        for (const Instr* ip = base + rule.code_begin; ip != base + rule.code_end; ++ip) {
+            switch (ip->op) {
+            case Op::PushConst: stack[sp++] = ip->constant; break;
+            case Op::LoadSignal: stack[sp++] = values[ip->signal]; break;
+            case Op::LoadRate: stack[sp++] = rates[ip->signal]; break;
+            case Op::Add: --sp; stack[sp - 1] += stack[sp]; break;
+            case Op::Sub: --sp; stack[sp - 1] -= stack[sp]; break;
+            case Op::Mul: --sp; stack[sp - 1] *= stack[sp]; break;
+            case Op::Div: --sp; stack[sp - 1] = stack[sp] != 0.0 ? stack[sp - 1] / stack[sp] : 0.0; break;
+            case Op::Neg: stack[sp - 1] = -stack[sp - 1]; break;
+            case Op::Not: stack[sp - 1] = stack[sp - 1] == 0.0 ? 1.0 : 0.0; break;
+            case Op::Lt: --sp; stack[sp - 1] = stack[sp - 1] < stack[sp]; break;
+            case Op::Le: --sp; stack[sp - 1] = stack[sp - 1] <= stack[sp]; break;
+            case Op::Gt: --sp; stack[sp - 1] = stack[sp - 1] > stack[sp]; break;
+            case Op::Ge: --sp; stack[sp - 1] = stack[sp - 1] >= stack[sp]; break;
+            case Op::Eq: --sp; stack[sp - 1] = stack[sp - 1] == stack[sp]; break;
+            case Op::Ne: --sp; stack[sp - 1] = stack[sp - 1] != stack[sp]; break;
+            case Op::And: --sp; stack[sp - 1] = (stack[sp - 1] != 0.0) && (stack[sp] != 0.0); break;
+            case Op::Or: --sp; stack[sp - 1] = (stack[sp - 1] != 0.0) || (stack[sp] != 0.0); break;
+            }
+        }
+        const bool condition = stack[0] != 0.0;
+
+        if (!condition) {
+            rule.true_since_ms = -1;
+            if (rule.active) {
+                rule.active = false;
+                events.push_back({rule.name, false, snapshot.sequence, snapshot.timestamp_ms, s});
+            }
+            continue;
+        }
+        if (rule.true_since_ms < 0)
+            rule.true_since_ms = snapshot.timestamp_ms;
+        if (!rule.active && snapshot.timestamp_ms - rule.true_since_ms >= rule.hold_ms) {
+            rule.active = true;
+            events.push_back({rule.name, true, snapshot.sequence, snapshot.timestamp_ms, s});
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#include "SampleScheduler.h"
+#include <algorithm>
+
+SampleScheduler::SampleScheduler(const std::array<Clock::duration, kSignalCount>& periods, Clock::time_point start)
+    : periods(periods) {
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        this->periods[i] = std::max(this->periods[i], Clock::duration(std::chrono::microseconds(1)));
+        deadlines[i] = start;
+        multi_rate = multi_rate || this->periods[i] != this->periods[0];
+    }
+}
+
+uint8_t SampleScheduler::due(Clock::time_point now) {
+    uint8_t mask = 0;
+    for (size_t i = 0; i < kSignalCount; ++i) {
+        if (deadlines[i] > now)
+            continue;
+        mask |= static_cast<uint8_t>(1u << i);
+        const auto missed = (now - deadlines[i]) / periods[i];
+        deadlines[i] += (missed + 1) * periods[i];
+    }
+    return mask;
+}
+
+SampleScheduler::Clock::time_point SampleScheduler::nextDeadline() const {
+    return *std::min_element(deadlines.begin(), deadlines.end());
+}
+
+SampleScheduler::Clock::duration SampleScheduler::periodFor(double rate_hz, Clock::duration fallback) {
+    if (rate_hz <= 0.0)
+        return fallback;
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate_hz));
+}
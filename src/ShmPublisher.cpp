@@ -0,0 +1,69 @@
+#include "ShmPublisher.h"
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <spdlog/spdlog.h>
+
+ShmPublisher::~ShmPublisher() {
+    close();
+}
+
+bool ShmPublisher::open(const std::string& name, uint32_t ring_capacity) {
+    close();
+    // Start from a fresh segment so stale readers of a previous run see it vanish.
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_EXCL, 0644);
+    if (fd < 0) {
+        spdlog::error("shm_open({}) failed: {}", name, std::strerror(errno));
+        return false;
+    }
+    const size_t size = shm::segmentSize(ring_capacity);
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        spdlog::error("ftruncate({}) failed: {}", name, std::strerror(errno));
+        ::close(fd);
+        shm_unlink(name.c_str());
+        return false;
+    }
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        spdlog::error("mmap({}) failed: {}", name, std::strerror(errno));
+        shm_unlink(name.c_str());
+        return false;
+    }
+
+    // ftruncate zero-fills the segment, so all slot sequences start at 0 ("never
+    // written"). Construct the header in place and publish magic last.
+    header = new (addr) shm::Header;
+    header->version = shm::kVersion;
+    header->ring_capacity = ring_capacity;
+    header->reserved = 0;
+    header->ring_written.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = shm::kMagic;
+    mapped_size = size;
+    segment_name = name;
+    spdlog::info("Shared-memory snapshot published at {} (ring capacity {})", name, ring_capacity);
+    return true;
+}
+
+void ShmPublisher::close() {
+    if (!header)
+        return;
+    munmap(header, mapped_size);
+    shm_unlink(segment_name.c_str());
+    header = nullptr;
+    mapped_size = 0;
+    segment_name.clear();
+}
+
+void ShmPublisher::publish(const shm::Record& record) {
+    if (!header)
+        return;
+    shm::writeSlot(header->latest, record.sequence, record);
+    if (header->ring_capacity > 0) {
+        const uint64_t n = header->ring_written.load(std::memory_order_relaxed);
+        shm::writeSlot(shm::ringSlots(header)[n % header->ring_capacity], n, record);
+        header->ring_written.store(n + 1, std::memory_order_release);
+    }
+}
@@ -0,0 +1,112 @@
+#include "SlabPool.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+constexpr size_t kHugePageBytes = 2 * 1024 * 1024;
+
+size_t roundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+} // namespace
+
+SlabPool::~SlabPool() {
+    release();
+}
+
+bool SlabPool::init(const char* name, size_t block_bytes, size_t capacity, bool hugepages) {
+    release();
+    stats_ = SlabStats{};
+    stats_.name = name;
+    if (capacity == 0 || block_bytes == 0)
+        return true;
+    const size_t block = roundUp(std::max(block_bytes, sizeof(FreeBlock)), kCacheLineBytes);
+    const size_t bytes = roundUp(block * capacity, kHugePageBytes);
+    void* memory = MAP_FAILED;
+    if (hugepages) {
+        memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        stats_.hugepages = memory != MAP_FAILED;
+    }
+    if (memory == MAP_FAILED) {
+        memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            spdlog::error("Slab pool {}: mmap of {} bytes failed: {}", name, bytes, std::strerror(errno));
+            return false;
+        }
+        if (hugepages)
+            madvise(memory, bytes, MADV_HUGEPAGE);
+    }
+    base = static_cast<char*>(memory);
+    mapped_bytes = bytes;
+    this->block_bytes = block;
+    this->capacity = capacity;
+    stats_.block_bytes = block;
+    stats_.capacity = capacity;
+    return true;
+}
+
+void SlabPool::release() {
+    if (base)
+        munmap(base, mapped_bytes);
+    base = nullptr;
+    mapped_bytes = 0;
+    block_bytes = 0;
+    capacity = 0;
+    next_unused = 0;
+    free_list = nullptr;
+}
+
+void* SlabPool::allocate() {
+    void* block;
+    if (free_list) {
+        block = free_list;
+        free_list = free_list->next;
+    } else if (next_unused < capacity) {
+        block = base + next_unused++ * block_bytes;
+    } else {
+        return nullptr;
+    }
+    ++stats_.allocations;
+    stats_.high_water = std::max(stats_.high_water, ++stats_.in_use);
+    return block;
+}
+
+void SlabPool::deallocate(void* block) {
+    free_list = new (block) FreeBlock{free_list};
+    --stats_.in_use;
+}
+
+void* SlabResource::do_allocate(size_t bytes, size_t alignment) {
+    if (alignment <= kCacheLineBytes) {
+        SlabPool* fitting = nullptr;
+        for (SlabPool* pool : pools) {
+            if (bytes > pool->blockBytes())
+                continue;
+            if (void* block = pool->allocate())
+                return block;
+            if (!fitting)
+                fitting = pool;
+        }
+        // Charged to the first pool that was large enough, or else the largest.
+        if (!fitting && !pools.empty())
+            fitting = pools.back();
+        if (fitting)
+            fitting->countFallback();
+    }
+    return upstream->allocate(bytes, alignment);
+}
+
+void SlabResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    for (SlabPool* pool : pools) {
+        if (pool->owns(p)) {
+            pool->deallocate(p);
+            return;
+        }
+    }
+    upstream->deallocate(p, bytes, alignment);
+}
@@ -0,0 +1,198 @@
+#include "Trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <spdlog/spdlog.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace {
+
+struct Event {
+    const char* name;
+    uint64_t begin;
+    uint64_t end;
+};
+
+// Written only by its thread; head is published with release so a reader sees
+// complete events up to it. Events the writer overwrites while a reader copies them
+// are detected from head and discarded.
+struct Ring {
+    Event events[Trace::kRingEvents];
+    std::atomic<uint64_t> head{0};
+    uint32_t tid = 0;
+    std::atomic<const char*> thread_name{nullptr};
+};
+
+// Rings outlive their threads so spans of finished threads can still be written.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Ring>> rings;
+    // TSC and steady_clock read together when tracing was enabled.
+    uint64_t anchor_ticks = 0;
+    std::chrono::steady_clock::time_point anchor_time;
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+thread_local Ring* thread_ring = nullptr;
+thread_local const char* thread_name = nullptr;
+
+Ring* ringForThread() {
+    if (!thread_ring) {
+        auto ring = std::make_unique<Ring>();
+        ring->thread_name.store(thread_name, std::memory_order_relaxed);
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        ring->tid = static_cast<uint32_t>(r.rings.size() + 1);
+        thread_ring = ring.get();
+        r.rings.push_back(std::move(ring));
+    }
+    return thread_ring;
+}
+
+void appendEscaped(std::string& out, const char* text) {
+    for (const char* p = text; *p; ++p) {
+        if (*p == '"' || *p == '\\')
+            out.push_back('\\');
+        out.push_back(*p);
+    }
+}
+
+} // namespace
+
+uint64_t Trace::now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+void Trace::enable() {
+    Registry& r = registry();
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (r.anchor_ticks == 0) {
+            r.anchor_time = std::chrono::steady_clock::now();
+            r.anchor_ticks = now();
+        }
+    }
+    on.store(true, std::memory_order_relaxed);
+}
+
+void Trace::disable() {
+    on.store(false, std::memory_order_relaxed);
+}
+
+void Trace::record(const char* name, uint64_t begin, uint64_t end) {
+    Ring* ring = ringForThread();
+    const uint64_t head = ring->head.load(std::memory_order_relaxed);
+    ring->events[head % kRingEvents] = Event{name, begin, end};
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void Trace::setThreadName(const char* name) {
+    thread_name = name;
+    if (thread_ring)
+        thread_ring->thread_name.store(name, std::memory_order_relaxed);
+}
+
+std::string Trace::chromeJson() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    if (r.anchor_ticks == 0) {
+        out += "]}\n";
+        return out;
+    }
+    // Ticks per microsecond, measured against steady_clock since enable(). Short
+    // traces wait a little so the ratio is not dominated by the two clock reads.
+    auto elapsed = std::chrono::steady_clock::now() - r.anchor_time;
+    if (elapsed < std::chrono::milliseconds(10)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10) - elapsed);
+        elapsed = std::chrono::steady_clock::now() - r.anchor_time;
+    }
+    const double ticks_per_us = static_cast<double>(now() - r.anchor_ticks) /
+        std::chrono::duration<double, std::micro>(elapsed).count();
+
+    bool first = true;
+    char buffer[160];
+    std::vector<Event> events;
+    for (const auto& ring : r.rings) {
+        const char* name = ring->thread_name.load(std::memory_order_relaxed);
+        int len = std::snprintf(buffer, sizeof(buffer),
+                                "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"",
+                                first ? "" : ",", ring->tid);
+        out.append(buffer, static_cast<size_t>(len));
+        if (name)
+            appendEscaped(out, name);
+        else
+            out += "thread " + std::to_string(ring->tid);
+        out += "\"}}";
+        first = false;
+
+        const uint64_t head = ring->head.load(std::memory_order_acquire);
+        const uint64_t begin = head > kRingEvents ? head - kRingEvents : 0;
+        events.clear();
+        for (uint64_t i = begin; i < head; ++i)
+            events.push_back(ring->events[i % kRingEvents]);
+        // Anything the writer may have overwritten during the copy is dropped.
+        const uint64_t after = ring->head.load(std::memory_order_acquire);
+        const uint64_t valid = after > kRingEvents ? after - kRingEvents : 0;
+        const size_t skip = static_cast<size_t>(std::min<uint64_t>(valid > begin ? valid - begin : 0, events.size()));
+
+        for (size_t i = skip; i < events.size(); ++i) {
+            const Event& e = events[i];
+            // Spans that started before enable() have no meaningful position.
+            if (e.begin < r.anchor_ticks || e.end < e.begin)
+                continue;
+            out += ",{\"name\":\"";
+            appendEscaped(out, e.name);
+            len = std::snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                                ring->tid, (e.begin - r.anchor_ticks) / ticks_per_us, (e.end - e.begin) / ticks_per_us);
+            out.append(buffer, static_cast<size_t>(len));
+        }
+    }
+    out += "]}\n";
+    return out;
+}
+
+bool Trace::writeChromeJson(const std::string& path) {
+    const std::string json = chromeJson();
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        spdlog::error("Cannot write trace to {}", path);
+        return false;
+    }
+    const bool ok = std::fwrite(json.data(), 1, json.size(), file) == json.size();
+    if (std::fclose(file) != 0 || !ok) {
+        spdlog::error("Cannot write trace to {}", path);
+        return false;
+    }
+    spdlog::info("Trace written to {}", path);
+    return true;
+}
+
+void Trace::clear() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const auto& ring : r.rings)
+        ring->head.store(0, std::memory_order_relaxed);
+}
+
+uint64_t Trace::recorded() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    uint64_t total = 0;
+    for (const auto& ring : r.rings)
+        total += ring->head.load(std::memory_order_acquire);
+    return total;
+}
@@ -0,0 +1,80 @@
+#include "Transport.h"
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+// Thin forwarding wrappers. They call the global libc symbols so link-time
+// overrides (as used by test_server.cpp) keep working.
+
+int PosixTransport::socket(int domain, int type, int protocol)
+{
+    return ::socket(domain, type, protocol);
+}
+
+bool PosixTransport::setNonBlocking(int fd)
+{
+    int flags = ::fcntl(fd, F_GETFL, 0);
+    return flags != -1 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+}
+
+int PosixTransport::setsockopt(int fd, int level, int optname, const void* optval, socklen_t optlen)
+{
+    return ::setsockopt(fd, level, optname, optval, optlen);
+}
+
+int PosixTransport::bind(int fd, const sockaddr* addr, socklen_t addrlen)
+{
+    return ::bind(fd, addr, addrlen);
+}
+
+int PosixTransport::listen(int fd, int backlog)
+{
+    return ::listen(fd, backlog);
+}
+
+int PosixTransport::accept(int fd, sockaddr* addr, socklen_t* addrlen)
+{
+    return ::accept(fd, addr, addrlen);
+}
+
+ssize_t PosixTransport::read(int fd, void* buf, size_t count)
+{
+    return ::read(fd, buf, count);
+}
+
+ssize_t PosixTransport::send(int fd, const void* buf, size_t len, int flags)
+{
+    return ::send(fd, buf, len, flags);
+}
+
+ssize_t PosixTransport::sendto(int fd, const void* buf, size_t len, int flags, const sockaddr* dest, socklen_t destlen)
+{
+    return ::sendto(fd, buf, len, flags, dest, destlen);
+}
+
+int PosixTransport::close(int fd)
+{
+    return ::close(fd);
+}
+
+int PosixTransport::poll(pollfd* fds, nfds_t nfds, int timeout)
+{
+    return ::poll(fds, nfds, timeout);
+}
+
+// eventfd counter: wake() adds one, drainWake() resets it to zero.
+int PosixTransport::openWakeFd()
+{
+    return ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
+
+void PosixTransport::wake(int fd)
+{
+    ::eventfd_write(fd, 1);
+}
+
+void PosixTransport::drainWake(int fd)
+{
+    eventfd_t value;
+    ::eventfd_read(fd, &value);
+}
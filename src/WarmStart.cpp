@@ -0,0 +1,260 @@
+#include "WarmStart.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <sqlite3.h>
+#include <spdlog/spdlog.h>
+#include "BlockStore.h"
+#include "PartitionedStore.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::string_view columnBlob(sqlite3_stmt* stmt, int column) {
+    const void* data = sqlite3_column_blob(stmt, column);
+    const int bytes = sqlite3_column_bytes(stmt, column);
+    return data ? std::string_view(static_cast<const char*>(data), static_cast<size_t>(bytes)) : std::string_view();
+}
+
+// Newer first by (timestamp, id).
+bool newer(const StoredSample& a, const StoredSample& b) {
+    return a.timestamp_ms != b.timestamp_ms ? a.timestamp_ms > b.timestamp_ms : a.id > b.id;
+}
+
+// The samples of one database newest first by timestamp, whatever order they were
+// written in (imports add old samples with new ids): engine_values rows through
+// the timestamp index, merged with the engine_blocks rows through the end_ts index.
+// A block is decoded once no unread sample can be newer than its end_ts; its
+// samples wait in a heap until they are the newest.
+class RecentSamples {
+public:
+    RecentSamples() = default;
+    RecentSamples(const RecentSamples&) = delete;
+    RecentSamples& operator=(const RecentSamples&) = delete;
+    ~RecentSamples() { close(); }
+
+    // Returns false if `db` has no engine_values.
+    bool open(sqlite3* db) {
+        static const std::string rows_sql = "SELECT id, timestamp, " + signalNames() +
+                                            " FROM engine_values ORDER BY timestamp DESC, id DESC;";
+        static const std::string blocks_sql = "SELECT id, samples, timestamp, " + signalNames() +
+                                              ", end_ts FROM engine_blocks ORDER BY end_ts DESC;";
+        if (sqlite3_prepare_v2(db, rows_sql.c_str(), -1, &rows_stmt, nullptr) != SQLITE_OK) {
+            rows_stmt = nullptr;
+            return false;
+        }
+        // Databases that never stored blocks have no engine_blocks table.
+        if (sqlite3_prepare_v2(db, blocks_sql.c_str(), -1, &blocks_stmt, nullptr) != SQLITE_OK)
+            blocks_stmt = nullptr;
+        blocks_done = !blocks_stmt;
+        return true;
+    }
+
+    void close() {
+        sqlite3_finalize(rows_stmt);
+        sqlite3_finalize(blocks_stmt);
+        rows_stmt = nullptr;
+        blocks_stmt = nullptr;
+    }
+
+    // The next sample; false at the end and on errors (see failed()).
+    bool next(StoredSample& out) {
+        if (error)
+            return false;
+        if (!has_row && !rows_done && !fillRow())
+            return fail();
+        if (!blocks_done && !blocks_started && !stepBlock())
+            return fail();
+        // Decode every block that may hold a sample newer than the candidates.
+        while (!blocks_done && (heap.empty() || block_end_ts >= heap.front().timestamp_ms) &&
+               (!has_row || block_end_ts >= row.timestamp_ms)) {
+            if (!loadBlock())
+                return fail();
+        }
+        if (!has_row && heap.empty())
+            return false;
+        if (has_row && (heap.empty() || newer(row, heap.front()))) {
+            out = row;
+            has_row = false;
+        } else {
+            std::pop_heap(heap.begin(), heap.end(), older);
+            out = heap.back();
+            heap.pop_back();
+        }
+        return true;
+    }
+
+    bool failed() const { return error; }
+
+private:
+    static bool older(const StoredSample& a, const StoredSample& b) { return newer(b, a); }
+
+    bool fail() {
+        error = true;
+        return false;
+    }
+
+    bool fillRow() {
+        const int rc = sqlite3_step(rows_stmt);
+        if (rc == SQLITE_DONE) {
+            rows_done = true;
+            return true;
+        }
+        if (rc != SQLITE_ROW)
+            return false;
+        row.id = sqlite3_column_int64(rows_stmt, 0);
+        row.timestamp_ms = sqlite3_column_int64(rows_stmt, 1);
+        row.present = 0;
+        for (size_t s = 0; s < kSignalCount; ++s) {
+            const int column = 2 + static_cast<int>(s);
+            // NULL: the signal was not sampled in this row (multi-rate sampling).
+            if (sqlite3_column_type(rows_stmt, column) == SQLITE_NULL) {
+                signalValue(row.values, s) = 0;
+            } else {
+                signalValue(row.values, s) = sqlite3_column_int(rows_stmt, column);
+                row.present |= static_cast<uint8_t>(1u << s);
+            }
+        }
+        has_row = true;
+        return true;
+    }
+
+    // Moves to the next block row and reads its end_ts.
+    bool stepBlock() {
+        blocks_started = true;
+        const int rc = sqlite3_step(blocks_stmt);
+        if (rc == SQLITE_DONE) {
+            blocks_done = true;
+            return true;
+        }
+        if (rc != SQLITE_ROW)
+            return false;
+        block_end_ts = sqlite3_column_int64(blocks_stmt, 3 + static_cast<int>(kSignalCount));
+        return true;
+    }
+
+    bool loadBlock() {
+        const int64_t first_id = sqlite3_column_int64(blocks_stmt, 0);
+        const int64_t count = sqlite3_column_int64(blocks_stmt, 1);
+        std::array<std::string_view, kSignalCount> signals;
+        for (size_t s = 0; s < kSignalCount; ++s)
+            signals[s] = columnBlob(blocks_stmt, 3 + static_cast<int>(s));
+        if (count < 0 ||
+            !decodeBlock(first_id, static_cast<size_t>(count), columnBlob(blocks_stmt, 2), signals, block)) {
+            spdlog::error("Sample block {} is malformed", first_id);
+            return false;
+        }
+        for (const StoredSample& sample : block) {
+            heap.push_back(sample);
+            std::push_heap(heap.begin(), heap.end(), older);
+        }
+        return stepBlock();
+    }
+
+    sqlite3_stmt* rows_stmt = nullptr;
+    sqlite3_stmt* blocks_stmt = nullptr;
+    bool error = false;
+    bool rows_done = false;
+    bool has_row = false;
+    StoredSample row;
+    bool blocks_started = false;
+    bool blocks_done = false;
+    int64_t block_end_ts = 0;
+    std::vector<StoredSample> block;
+    std::vector<StoredSample> heap;
+};
+
+// Scans one database from its newest sample backwards. Returns false on a read error;
+// `more` is cleared once the scan reached since_ms, the budget or the row cap.
+bool scanDatabase(const std::string& path, int64_t since_ms, std::vector<EngineSnapshot>& samples,
+                  Clock::time_point deadline, const WarmStartOptions& options, WarmStartStats& stats, bool& more) {
+    sqlite3* db = nullptr;
+    if (sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        spdlog::error("Cannot open database {} for warm start: {}", path, sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return false;
+    }
+    RecentSamples scan;
+    if (!scan.open(db)) {
+        // A database written before engine_values existed has nothing to warm from.
+        sqlite3_close(db);
+        return true;
+    }
+    StoredSample stored;
+    while (scan.next(stored)) {
+        EngineSnapshot snapshot;
+        snapshot.values = stored.values;
+        snapshot.fresh = stored.present;
+        snapshot.timestamp_ms = stored.timestamp_ms;
+        if (snapshot.timestamp_ms < since_ms && !samples.empty()) {
+            more = false;
+            break;
+        }
+        samples.push_back(snapshot);
+        if (snapshot.timestamp_ms < since_ms) {
+            more = false;
+            break;
+        }
+        // The clock is only read every 256 rows; a row costs well under a microsecond.
+        if (samples.size() >= options.max_rows || (samples.size() % 256 == 0 && Clock::now() >= deadline)) {
+            stats.truncated = true;
+            more = false;
+            break;
+        }
+    }
+    const bool ok = !scan.failed();
+    if (!ok)
+        spdlog::error("Warm start query failed on {}: {}", path, sqlite3_errmsg(db));
+    scan.close();
+    sqlite3_close(db);
+    return ok;
+}
+
+} // namespace
+
+bool loadRecentSamples(const StorageConfig& storage, int64_t since_ms, std::vector<EngineSnapshot>& samples,
+                       WarmStartStats& stats, const WarmStartOptions& options) {
+    const auto started = Clock::now();
+    const auto deadline = started + std::chrono::milliseconds(options.budget_ms);
+    samples.clear();
+    stats = WarmStartStats{};
+
+    std::vector<std::string> paths;
+    std::error_code ec;
+    if (storage.partitioning != Partitioning::None) {
+        for (const PartitionInfo& p : PartitionedStore::list(storage.path))
+            paths.push_back(p.path);
+        std::reverse(paths.begin(), paths.end());
+    } else if (std::filesystem::exists(storage.path, ec)) {
+        paths.push_back(storage.path);
+    }
+
+    bool ok = true;
+    bool more = true;
+    for (size_t i = 0; i < paths.size() && more && ok; ++i)
+        ok = scanDatabase(paths[i], since_ms, samples, deadline, options, stats, more);
+
+    std::reverse(samples.begin(), samples.end());
+    // Unsampled signals carry their previous value forward, as they did live.
+    EngineSnapshot previous;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        EngineSnapshot& s = samples[i];
+        for (size_t f = 0; f < kSignalCount; ++f) {
+            if (s.fresh & (1u << f)) {
+                s.field_timestamp_ms[f] = s.timestamp_ms;
+            } else {
+                signalValue(s.values, f) = signalValue(previous.values, f);
+                s.field_timestamp_ms[f] = previous.field_timestamp_ms[f];
+            }
+        }
+        s.sequence = i + 1;
+        previous = s;
+    }
+    stats.rows = samples.size();
+    stats.seconds = std::chrono::duration<double>(Clock::now() - started).count();
+    return ok;
+}
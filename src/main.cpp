@@ -4,10 +4,25 @@
 #include <cstdlib>
 #include <csignal>
 #include <atomic>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sys/resource.h>
+#include "HistoryAggregate.h"
+#include "HistoryExport.h"
+#include "HistoryImport.h"
 #include "Server.hpp"
+#include "Trace.h"
 #include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
 
 std::atomic<bool> running(true);
+std::atomic<bool> trace_toggle(false);
 
 void handle_sigint(int) {
     spdlog::info("handle_sigint...");
@@ -19,9 +34,195 @@ void handle_sigterm(int) {
     running = false;
 }
 
+// SIGUSR1 switches tracing on or off; the main loop does the work.
+void handle_sigusr1(int) {
+    trace_toggle = true;
+}
+
+// `middlewaresw export ...`: streams stored history to a file or stdout, chunk by
+// chunk, while a running server keeps writing to the same database.
+int runExport(int argc, char* argv[]) {
+    // stdout may carry the exported data, so log to stderr.
+    spdlog::set_default_logger(spdlog::stderr_color_mt("export"));
+    std::string db_path = "engine_data.db";
+    std::string out_path;
+    int64_t from_ms = 0;
+    int64_t to_ms = std::numeric_limits<int64_t>::max();
+    ExportFormat format = ExportFormat::Csv;
+    int64_t step_ms = 0;
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--db" && i + 1 < argc) {
+            db_path = argv[++i];
+        } else if (arg == "--from" && i + 1 < argc) {
+            from_ms = std::atoll(argv[++i]);
+        } else if (arg == "--to" && i + 1 < argc) {
+            to_ms = std::atoll(argv[++i]);
+        } else if (arg == "--format" && i + 1 < argc) {
+            const std::string name = argv[++i];
+            if (name == "binary") {
+                format = ExportFormat::Binary;
+            } else if (name != "csv") {
+                spdlog::error("Unknown export format: {}", name);
+                return 1;
+            }
+        } else if (arg == "--step" && i + 1 < argc) {
+            step_ms = std::max<int64_t>(0, std::atoll(argv[++i]));
+        } else if (arg == "--out" && i + 1 < argc) {
+            out_path = argv[++i];
+        } else {
+            spdlog::error("Usage: {} export [--db <path>] [--from <ms>] [--to <ms>] [--format csv|binary] [--step <ms>] [--out <file>]", argv[0]);
+            return 1;
+        }
+    }
+
+    HistoryCursor cursor;
+    if (!cursor.open(db_path, from_ms, to_ms, format, step_ms))
+        return 1;
+    FILE* out = out_path.empty() ? stdout : std::fopen(out_path.c_str(), "wb");
+    if (!out) {
+        spdlog::error("Cannot open {}: {}", out_path, std::strerror(errno));
+        return 1;
+    }
+    const auto started = std::chrono::steady_clock::now();
+    std::string chunk;
+    bool ok = true;
+    while (ok) {
+        chunk.clear();
+        if (!cursor.next(chunk))
+            break;
+        ok = std::fwrite(chunk.data(), 1, chunk.size(), out) == chunk.size();
+    }
+    if (out != stdout)
+        std::fclose(out);
+    else
+        std::fflush(out);
+    if (!ok || cursor.failed()) {
+        spdlog::error("Export failed");
+        return 1;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    spdlog::info("Exported {} rows in {:.3f} s", cursor.rowsExported(), seconds);
+    return 0;
+}
+
+// `middlewaresw import ...`: bulk-loads a CSV or binary history file.
+int runImport(int argc, char* argv[]) {
+    std::string db_path = "engine_data.db";
+    std::string file_path;
+    ImportOptions options;
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--db" && i + 1 < argc) {
+            db_path = argv[++i];
+        } else if (arg == "--chunk-rows" && i + 1 < argc) {
+            options.chunk_rows = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (file_path.empty() && arg[0] != '-') {
+            file_path = arg;
+        } else {
+            file_path.clear();
+            break;
+        }
+    }
+    if (file_path.empty()) {
+        spdlog::error("Usage: {} import [--db <path>] [--chunk-rows <n>] <file.csv|file.mwcb>", argv[0]);
+        return 1;
+    }
+    ImportStats stats;
+    const bool ok = importHistory(db_path, file_path, stats, options);
+    spdlog::info("Imported {} rows in {:.3f} s ({:.0f} rows/s, {} lines skipped)", stats.rows, stats.seconds,
+                 stats.rowsPerSecond(), stats.skipped);
+    return ok ? 0 : 1;
+}
+
+// `middlewaresw aggregate ...`: prints count, min, max, mean and quantiles of each
+// signal over a stored range.
+int runAggregate(int argc, char* argv[]) {
+    std::string db_path = "engine_data.db";
+    int64_t from_ms = 0;
+    int64_t to_ms = std::numeric_limits<int64_t>::max();
+    AggregateOptions options;
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--db" && i + 1 < argc) {
+            db_path = argv[++i];
+        } else if (arg == "--from" && i + 1 < argc) {
+            from_ms = std::atoll(argv[++i]);
+        } else if (arg == "--to" && i + 1 < argc) {
+            to_ms = std::atoll(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            options.threads = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--scalar") {
+            options.simd = false;
+        } else {
+            spdlog::error("Usage: {} aggregate [--db <path>] [--from <ms>] [--to <ms>] [--threads <n>] [--scalar]", argv[0]);
+            return 1;
+        }
+    }
+    AggregateResult result;
+    if (!aggregateHistory(db_path, from_ms, to_ms, result, options)) {
+        spdlog::error("Aggregation failed");
+        return 1;
+    }
+    std::printf("%-14s %12s %8s %8s %12s %8s %8s %8s\n", "signal", "count", "min", "max", "mean", "p50", "p90", "p99");
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        const SignalAggregate& a = result.signals[s];
+        std::printf("%-14s %12llu %8d %8d %12.3f %8d %8d %8d\n", kSignalFields[s].name,
+                    static_cast<unsigned long long>(a.count), a.min, a.max, a.mean, a.p50, a.p90, a.p99);
+    }
+    spdlog::info("Aggregated {} rows in {:.3f} s ({} threads, {} kernels)", result.rows, result.seconds,
+                 result.threads, result.simd ? "AVX2" : "scalar");
+    return 0;
+}
+
+// Parses a comma-separated <signal>=<number> list such as "rpm=1000,temperature=1"
+// into `values`; signals not listed keep their value.
+bool parseSignalList(const std::string& list, std::array<double, kSignalCount>& values) {
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t comma = list.find(',', pos);
+        if (comma == std::string::npos)
+            comma = list.size();
+        const std::string item = list.substr(pos, comma - pos);
+        const size_t eq = item.find('=');
+        const int signal = signalIndex(item.substr(0, eq));
+        if (eq == std::string::npos || signal < 0)
+            return false;
+        values[signal] = std::atof(item.c_str() + eq + 1);
+        pos = comma + 1;
+    }
+    return true;
+}
+
+// Raises the soft descriptor limit, up to the hard limit, so the connection cap
+// rather than the usual soft limit of 1024 decides how many clients fit.
+void raiseDescriptorLimit(size_t max_connections) {
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+        return;
+    // Headroom for listeners, the wake descriptor and database files.
+    const rlim_t wanted = max_connections == 0 ? limit.rlim_max : std::min<rlim_t>(limit.rlim_max, max_connections + 64);
+    if (wanted <= limit.rlim_cur)
+        return;
+    limit.rlim_cur = wanted;
+    if (setrlimit(RLIMIT_NOFILE, &limit) != 0)
+        spdlog::warn("Cannot raise the descriptor limit to {}: {}", wanted, std::strerror(errno));
+    else
+        spdlog::info("Descriptor limit raised to {}", wanted);
+}
+
 int main(int argc, char* argv[]) {
+    if (argc >= 2 && std::strcmp(argv[1], "export") == 0) {
+        return runExport(argc, argv);
+    }
+    if (argc >= 2 && std::strcmp(argv[1], "import") == 0) {
+        return runImport(argc, argv);
+    }
+    if (argc >= 2 && std::strcmp(argv[1], "aggregate") == 0) {
+        return runAggregate(argc, argv);
+    }
     if (argc < 2) {
-        spdlog::error("Usage: {} <UpdateIntervalMs>", argv[0]);
+        spdlog::error("Usage: {} <UpdateIntervalMs> [--shm [name]] [--shm-ring <samples>] [--unix [path]] [--seqpacket] [--http [port]] [--multicast [group:port]] [--multicast-if <address>] [--stats-windows <ms,ms,...|none>] [--rules <file>] [--max-clients <n>] [--rate-limit <req/s>[:burst]] [--max-wait <ms>] [--export-workers <n>] [--max-exports <n>] [--export-nice <n>] [--hugepages] [--partition hour|day] [--data-dir <dir>] [--retention-hours <n>] [--block-rows <n>] [--block-ms <ms>] [--no-warm-start] [--port <n>] [--backlog <n>] [--sndbuf <bytes>] [--rcvbuf <bytes>] [--no-nodelay] [--quickack] [--busy-poll <us>] [--keepalive <idle_s>:<interval_s>:<count>] [--user-timeout <ms>] [--incoming-cpu <cpu>] [--sample-rate <signal>=<hz>,...] [--deadband <signal>=<deviation>,...] [--swinging-door <signal>=<deviation>,...] [--max-silence <s>] [--trace <file.json>] [--queue-capacity <samples>] [--persist-overflow block|drop-newest|drop-oldest]", argv[0]);
         return 1;
     }
     int updateIntervalMs = std::atoi(argv[1]);
@@ -30,7 +231,191 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    Server server;
+    ServerConfig config;
+    // Tracing writes here when switched off; SIGUSR1 uses the default without --trace.
+    std::string trace_path = "middlewaresw_trace.json";
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--shm") {
+            config.shm.enabled = true;
+            if (i + 1 < argc && argv[i + 1][0] == '/') {
+                config.shm.name = argv[++i];
+            }
+        } else if (arg == "--shm-ring" && i + 1 < argc) {
+            config.shm.enabled = true;
+            config.shm.ring_capacity = static_cast<uint32_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--unix") {
+            config.unix_socket.enabled = true;
+            if (i + 1 < argc && argv[i + 1][0] == '/') {
+                config.unix_socket.path = argv[++i];
+            }
+        } else if (arg == "--seqpacket") {
+            config.unix_socket.enabled = true;
+            config.unix_socket.seqpacket = true;
+        } else if (arg == "--http") {
+            config.http.enabled = true;
+            if (i + 1 < argc && argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9') {
+                config.http.port = static_cast<uint16_t>(std::atoi(argv[++i]));
+            }
+        } else if (arg == "--multicast") {
+            config.multicast.enabled = true;
+            if (i + 1 < argc && std::strchr(argv[i + 1], ':') != nullptr) {
+                const std::string endpoint = argv[++i];
+                const size_t colon = endpoint.rfind(':');
+                config.multicast.group = endpoint.substr(0, colon);
+                config.multicast.port = static_cast<uint16_t>(std::atoi(endpoint.c_str() + colon + 1));
+            }
+        } else if (arg == "--multicast-if" && i + 1 < argc) {
+            config.multicast.enabled = true;
+            config.multicast.interface_address = argv[++i];
+        } else if (arg == "--stats-windows" && i + 1 < argc) {
+            // Comma-separated window lengths in ms; "none" disables rolling statistics.
+            config.stats.windows_ms.clear();
+            const std::string list = argv[++i];
+            size_t pos = 0;
+            while (list != "none" && pos < list.size()) {
+                size_t comma = list.find(',', pos);
+                if (comma == std::string::npos)
+                    comma = list.size();
+                config.stats.windows_ms.push_back(std::atoll(list.substr(pos, comma - pos).c_str()));
+                pos = comma + 1;
+            }
+        } else if (arg == "--max-clients" && i + 1 < argc) {
+            config.limits.max_connections = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--rate-limit" && i + 1 < argc) {
+            // <requests/s>[:burst] per client.
+            const std::string limit = argv[++i];
+            config.limits.requests_per_second = std::atof(limit.c_str());
+            const size_t colon = limit.find(':');
+            if (colon != std::string::npos)
+                config.limits.burst = std::max(1.0, std::atof(limit.c_str() + colon + 1));
+        } else if (arg == "--max-wait" && i + 1 < argc) {
+            config.limits.max_wait_ms = static_cast<uint32_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--hugepages") {
+            config.memory.hugepages = true;
+        } else if (arg == "--export-workers" && i + 1 < argc) {
+            config.history.workers = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--max-exports" && i + 1 < argc) {
+            config.history.max_jobs = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--export-nice" && i + 1 < argc) {
+            config.history.worker_nice = std::atoi(argv[++i]);
+        } else if (arg == "--partition" && i + 1 < argc) {
+            const std::string granularity = argv[++i];
+            if (granularity == "hour") {
+                config.storage.partitioning = Partitioning::Hour;
+            } else if (granularity == "day") {
+                config.storage.partitioning = Partitioning::Day;
+            } else {
+                spdlog::error("--partition takes hour or day");
+                return 1;
+            }
+        } else if (arg == "--data-dir" && i + 1 < argc) {
+            config.storage.path = argv[++i];
+        } else if (arg == "--retention-hours" && i + 1 < argc) {
+            config.storage.retention_ms = std::max(0LL, std::atoll(argv[++i])) * 3600 * 1000;
+        } else if (arg == "--block-rows" && i + 1 < argc) {
+            config.storage.block_rows = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--block-ms" && i + 1 < argc) {
+            config.storage.block_ms = std::max(0LL, std::atoll(argv[++i]));
+        } else if (arg == "--port" && i + 1 < argc) {
+            config.socket.port = static_cast<uint16_t>(std::atoi(argv[++i]));
+        } else if (arg == "--backlog" && i + 1 < argc) {
+            config.socket.backlog = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--sndbuf" && i + 1 < argc) {
+            config.socket.send_buffer_bytes = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--rcvbuf" && i + 1 < argc) {
+            config.socket.receive_buffer_bytes = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--no-nodelay") {
+            config.socket.tcp_nodelay = false;
+        } else if (arg == "--quickack") {
+            config.socket.tcp_quickack = true;
+        } else if (arg == "--busy-poll" && i + 1 < argc) {
+            config.socket.busy_poll_us = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--keepalive" && i + 1 < argc) {
+            // <idle_s>:<interval_s>:<count>
+            config.socket.keepalive = true;
+            if (std::sscanf(argv[++i], "%d:%d:%d", &config.socket.keepalive_idle_s,
+                            &config.socket.keepalive_interval_s, &config.socket.keepalive_count) != 3) {
+                spdlog::error("--keepalive takes <idle_s>:<interval_s>:<count>");
+                return 1;
+            }
+        } else if (arg == "--user-timeout" && i + 1 < argc) {
+            config.socket.user_timeout_ms = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--incoming-cpu" && i + 1 < argc) {
+            config.socket.incoming_cpu = std::atoi(argv[++i]);
+        } else if (arg == "--sample-rate" && i + 1 < argc) {
+            if (!parseSignalList(argv[++i], config.sampling.rate_hz)) {
+                spdlog::error("--sample-rate takes <signal>=<hz>,... with signals {}", signalNames());
+                return 1;
+            }
+        } else if ((arg == "--deadband" || arg == "--swinging-door") && i + 1 < argc) {
+            std::array<double, kSignalCount> deviations;
+            deviations.fill(-1.0);
+            if (!parseSignalList(argv[++i], deviations)) {
+                spdlog::error("{} takes <signal>=<deviation>,... with signals {}", arg, signalNames());
+                return 1;
+            }
+            for (size_t s = 0; s < kSignalCount; ++s) {
+                if (deviations[s] >= 0.0) {
+                    config.storage.compression.signals[s].mode =
+                        arg == "--deadband" ? CompressionMode::Deadband : CompressionMode::SwingingDoor;
+                    config.storage.compression.signals[s].deviation = deviations[s];
+                }
+            }
+        } else if (arg == "--max-silence" && i + 1 < argc) {
+            config.storage.compression.max_silence_ms = std::max(0, std::atoi(argv[++i])) * 1000LL;
+        } else if (arg == "--trace" && i + 1 < argc) {
+            trace_path = argv[++i];
+            Trace::enable();
+        } else if (arg == "--queue-capacity" && i + 1 < argc) {
+            const size_t capacity = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+            config.pipeline.transform.capacity = capacity;
+            config.pipeline.publish.capacity = capacity;
+            config.pipeline.persist.capacity = capacity;
+        } else if (arg == "--persist-overflow" && i + 1 < argc) {
+            const std::string policy = argv[++i];
+            if (policy == "block") {
+                config.pipeline.persist.overflow = OverflowPolicy::Block;
+            } else if (policy == "drop-newest") {
+                config.pipeline.persist.overflow = OverflowPolicy::DropNewest;
+            } else if (policy == "drop-oldest") {
+                config.pipeline.persist.overflow = OverflowPolicy::DropOldest;
+            } else {
+                spdlog::error("--persist-overflow takes block, drop-newest or drop-oldest");
+                return 1;
+            }
+        } else if (arg == "--no-warm-start") {
+            config.warm_start.enabled = false;
+        } else if (arg == "--rules" && i + 1 < argc) {
+            // One alert rule per line; blank lines and lines starting with '#' are skipped.
+            std::ifstream file(argv[++i]);
+            if (!file) {
+                spdlog::error("Cannot open rules file {}", argv[i]);
+                return 1;
+            }
+            std::string line;
+            while (std::getline(file, line)) {
+                const size_t first = line.find_first_not_of(" \t\r");
+                if (first != std::string::npos && line[first] != '#')
+                    config.alerts.rules.push_back(line);
+            }
+        } else {
+            spdlog::error("Unknown option: {}", arg);
+            return 1;
+        }
+    }
+
+    if (config.storage.partitioning != Partitioning::None) {
+        // Partitions live in a directory; keep the single-file name from turning into one.
+        if (config.storage.path == StorageConfig{}.path)
+            config.storage.path = "engine_data";
+        config.history.db_path = config.storage.path;
+    } else {
+        config.storage.path = config.history.db_path;
+    }
+
+    raiseDescriptorLimit(config.limits.max_connections);
+    Server server(config);
     server.start(updateIntervalMs);
 
     // Set up signal handler for interrupt and shutdown
@@ -38,19 +423,30 @@ int main(int argc, char* argv[]) {
 
     // Set up signal handler for graceful shutdown
     std::signal(SIGTERM, handle_sigterm);
+    std::signal(SIGUSR1, handle_sigusr1);
 
     // Main loop
     while (running) {
+        if (trace_toggle.exchange(false)) {
+            if (Trace::enabled()) {
+                Trace::disable();
+                Trace::writeChromeJson(trace_path);
+            } else {
+                spdlog::info("Tracing enabled");
+                Trace::enable();
+            }
+        }
         // Debug: Fetch and print the latest data from the server
-        const int latest_rpm = server.getLatestRpm();
-        const int latest_temperature = server.getLatestTemperature();
-        const int latest_oil_pressure = server.getLatestOilPressure();
-        const int latest_speed = server.getLatestSpeed();
-        spdlog::info("Engine RPM:[{}], Temperature:[{}], Oil Pressure:[{}] psi, Speed:[{}] km/h", latest_rpm, latest_temperature, latest_oil_pressure, latest_speed);
+        const EngineSample latest = server.getLatestSample();
+        spdlog::info("Engine RPM:[{}], Temperature:[{}], Oil Pressure:[{}] psi, Speed:[{}] km/h", latest.rpm, latest.temperature, latest.oil_pressure, latest.speed);
         std::this_thread::sleep_for(std::chrono::milliseconds(updateIntervalMs));
     }
 
     spdlog::info("Shutting down...");
     server.stop();
+    if (Trace::enabled()) {
+        Trace::disable();
+        Trace::writeChromeJson(trace_path);
+    }
     return 0;
 }
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+
+// Allocation counting for tests. The test binary interposes malloc, calloc and
+// realloc (see alloc_hook.cpp) and counts calls made by tracked threads outside a
+// Pause scope, so a test can assert that a code path does not allocate.
+namespace alloc_hook {
+
+// Starts counting allocations made by the calling thread.
+void trackThisThread();
+// Allocations counted so far across all tracked threads.
+size_t count();
+
+// Allocations made by the calling thread while a Pause is alive are not counted,
+// e.g. those of a test double standing in for the kernel.
+class Pause {
+public:
+    Pause();
+    ~Pause();
+    Pause(const Pause&) = delete;
+    Pause& operator=(const Pause&) = delete;
+};
+
+} // namespace alloc_hook
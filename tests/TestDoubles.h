@@ -0,0 +1,309 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include "Engine.h"
+
+// Polls `condition` until it holds or the timeout expires.
+inline bool waitFor(const std::function<bool()>& condition, int timeoutMs = 2000) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (condition())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return condition();
+}
+
+// A masked WebSocket frame, as a browser sends it.
+inline std::string webSocketClientFrame(uint8_t opcode, const std::string& payload, bool fin = true) {
+    static const uint8_t mask[4] = {0x37, 0xFA, 0x21, 0x3D};
+    std::string frame;
+    frame.push_back(static_cast<char>((fin ? 0x80 : 0x00) | opcode));
+    if (payload.size() < 126) {
+        frame.push_back(static_cast<char>(0x80 | payload.size()));
+    } else {
+        frame.push_back(static_cast<char>(0x80 | 126));
+        frame.push_back(static_cast<char>(payload.size() >> 8));
+        frame.push_back(static_cast<char>(payload.size()));
+    }
+    frame.append(reinterpret_cast<const char*>(mask), 4);
+    for (size_t i = 0; i < payload.size(); ++i)
+        frame.push_back(static_cast<char>(payload[i] ^ mask[i % 4]));
+    return frame;
+}
+
+// Deterministic engine for BasicServer tests: always returns `next` and counts stores.
+// Assign `next` before start(); use setNext() while the server is running.
+struct FakeEngine {
+    EngineSample next{1200, 90, 45, 80};
+    std::atomic<int> samples{0};
+    std::atomic<int> stores{0};
+    std::atomic<int> alerts_stored{0};
+    std::mutex m;
+
+    // Reads per signal, whole or selective.
+    std::atomic<int> signal_reads[kSignalCount] = {0, 0, 0, 0};
+
+    EngineSample sample() {
+        return sample(kAllSignals);
+    }
+    EngineSample sample(uint8_t signals) {
+        std::unique_lock<std::mutex> lock(m);
+        // Bounded so that a failed test cannot hang stop().
+        gate_cv.wait_for(lock, std::chrono::seconds(5), [&] { return !gated || permits > 0; });
+        if (permits > 0)
+            --permits;
+        ++samples;
+        EngineSample out;
+        for (size_t i = 0; i < kSignalCount; ++i) {
+            if (signals & (1u << i)) {
+                ++signal_reads[i];
+                signalValue(out, i) = signalValue(next, i);
+            }
+        }
+        return out;
+    }
+    void setNext(const EngineSample& value) {
+        std::lock_guard<std::mutex> lock(m);
+        next = value;
+    }
+    // After gate() sampling blocks until release() lets `n` more samples through;
+    // ungate() lets them all through again.
+    void gate() {
+        std::lock_guard<std::mutex> lock(m);
+        gated = true;
+        permits = 0;
+    }
+    void release(int n = 1) {
+        std::lock_guard<std::mutex> lock(m);
+        permits += n;
+        gate_cv.notify_all();
+    }
+    void ungate() {
+        std::lock_guard<std::mutex> lock(m);
+        gated = false;
+        gate_cv.notify_all();
+    }
+    std::condition_variable gate_cv;
+    bool gated = false;
+    int permits = 0;
+    // Makes every store take this long, like a slow disk.
+    std::atomic<int> store_delay_ms{0};
+    void storeCurrentValues(int, int, int, int) {
+        if (int delay = store_delay_ms.load())
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        ++stores;
+    }
+    void storeAlertEvent(const std::string&, bool, int64_t, const EngineSample&) { ++alerts_stored; }
+};
+
+// In-memory stand-in for the kernel socket layer. Tests queue client connections
+// with scripted request chunks and inspect what the server wrote back.
+class InMemoryTransport {
+public:
+    // Queue a client; each chunk is returned by one read(), then EOF. With
+    // `stay_open` the client never reaches EOF and keeps receiving pushed frames.
+    // `listener` is the listening socket's position in the order of listen() calls
+    // among the open listeners (0 is the TCP listener).
+    int connectClient(std::vector<std::string> chunks, bool stay_open = false, size_t listener = 0) {
+        std::lock_guard<std::mutex> lock(m);
+        int fd = next_fd++;
+        endpoints[fd].inbound.assign(chunks.begin(), chunks.end());
+        endpoints[fd].stay_open = stay_open;
+        pending[listener].push_back(fd);
+        return fd;
+    }
+    // Queues more bytes for a connected stay_open client.
+    void sendToServer(int fd, std::string chunk) {
+        std::lock_guard<std::mutex> lock(m);
+        endpoints[fd].inbound.push_back(std::move(chunk));
+    }
+    std::string sent(int fd) {
+        std::lock_guard<std::mutex> lock(m);
+        return endpoints[fd].outbound;
+    }
+    bool closed(int fd) {
+        std::lock_guard<std::mutex> lock(m);
+        return endpoints[fd].closed;
+    }
+
+    // (domain, type) of every socket() call, in order.
+    std::vector<std::pair<int, int>> socketsCreated() {
+        std::lock_guard<std::mutex> lock(m);
+        return sockets;
+    }
+
+    struct SocketOption {
+        int fd, level, name, value;
+    };
+    // Every int-valued setsockopt() call, in order.
+    std::vector<SocketOption> socketOptions() {
+        std::lock_guard<std::mutex> lock(m);
+        return options;
+    }
+    std::vector<int> listenBacklogs() {
+        std::lock_guard<std::mutex> lock(m);
+        return backlogs;
+    }
+
+    int socket(int domain, int type, int) {
+        std::lock_guard<std::mutex> lock(m);
+        sockets.emplace_back(domain, type);
+        listener_fds.push_back(next_fd);
+        return next_fd++;
+    }
+    bool setNonBlocking(int) { return true; }
+    int setsockopt(int fd, int level, int name, const void* value, socklen_t len) {
+        std::lock_guard<std::mutex> lock(m);
+        int v = 0;
+        if (len == sizeof(int))
+            std::memcpy(&v, value, sizeof(v));
+        options.push_back({fd, level, name, v});
+        return 0;
+    }
+    int bind(int, const sockaddr*, socklen_t) { return 0; }
+    int listen(int fd, int backlog) {
+        std::lock_guard<std::mutex> lock(m);
+        backlogs.push_back(backlog);
+        listening.push_back(fd);
+        return 0;
+    }
+    int accept(int fd, sockaddr*, socklen_t*) {
+        std::lock_guard<std::mutex> lock(m);
+        std::deque<int>* queue = pendingFor(fd);
+        if (!queue || queue->empty()) {
+            errno = EAGAIN;
+            return -1;
+        }
+        int client = queue->front();
+        queue->pop_front();
+        return client;
+    }
+    ssize_t read(int fd, void* buf, size_t count) {
+        std::lock_guard<std::mutex> lock(m);
+        auto& in = endpoints[fd].inbound;
+        if (in.empty()) {
+            if (!endpoints[fd].stay_open)
+                return 0;
+            errno = EAGAIN;
+            return -1;
+        }
+        std::string chunk = in.front();
+        in.pop_front();
+        size_t n = std::min(count, chunk.size());
+        std::memcpy(buf, chunk.data(), n);
+        return static_cast<ssize_t>(n);
+    }
+    ssize_t send(int fd, const void* buf, size_t len, int) {
+        std::lock_guard<std::mutex> lock(m);
+        endpoints[fd].outbound.append(static_cast<const char*>(buf), len);
+        return static_cast<ssize_t>(len);
+    }
+    ssize_t sendto(int fd, const void* buf, size_t len, int, const sockaddr*, socklen_t) {
+        std::lock_guard<std::mutex> lock(m);
+        endpoints[fd].datagrams.emplace_back(static_cast<const char*>(buf), len);
+        return static_cast<ssize_t>(len);
+    }
+    // Every datagram sent on any socket, grouped by socket.
+    std::vector<std::string> datagrams() {
+        std::lock_guard<std::mutex> lock(m);
+        std::vector<std::string> all;
+        for (const auto& [fd, endpoint] : endpoints)
+            all.insert(all.end(), endpoint.datagrams.begin(), endpoint.datagrams.end());
+        return all;
+    }
+    int close(int fd) {
+        std::lock_guard<std::mutex> lock(m);
+        endpoints[fd].closed = true;
+        std::erase(listening, fd);
+        return 0;
+    }
+    int openWakeFd() {
+        std::lock_guard<std::mutex> lock(m);
+        wake_counts[next_fd] = 0;
+        return next_fd++;
+    }
+    void wake(int fd) {
+        std::lock_guard<std::mutex> lock(m);
+        ++wake_counts[fd];
+    }
+    void drainWake(int fd) {
+        std::lock_guard<std::mutex> lock(m);
+        wake_counts[fd] = 0;
+    }
+
+    // Listeners are readable while connections are queued; wake descriptors after
+    // wake(); clients while they have chunks left or have reached EOF. Clients are
+    // always writable.
+    int poll(pollfd* fds, nfds_t nfds, int timeout) {
+        int ready = 0;
+        {
+            std::lock_guard<std::mutex> lock(m);
+            for (nfds_t i = 0; i < nfds; ++i) {
+                fds[i].revents = 0;
+                bool listener = std::find(listener_fds.begin(), listener_fds.end(), fds[i].fd) != listener_fds.end();
+                auto wake_it = wake_counts.find(fds[i].fd);
+                if (listener) {
+                    const std::deque<int>* queue = pendingFor(fds[i].fd);
+                    if (queue && !queue->empty())
+                        fds[i].revents |= POLLIN;
+                } else if (wake_it != wake_counts.end()) {
+                    if (wake_it->second > 0)
+                        fds[i].revents |= POLLIN;
+                } else {
+                    const Endpoint& e = endpoints[fds[i].fd];
+                    short readable = (!e.inbound.empty() || !e.stay_open) ? POLLIN : 0;
+                    fds[i].revents |= (fds[i].events & (readable | POLLOUT));
+                }
+                if (fds[i].revents)
+                    ++ready;
+            }
+        }
+        if (ready == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(std::min(timeout, 2)));
+        return ready;
+    }
+
+private:
+    // Clients queued for a listening socket; nullptr if it is not listening.
+    std::deque<int>* pendingFor(int fd) {
+        auto it = std::find(listening.begin(), listening.end(), fd);
+        if (it == listening.end())
+            return nullptr;
+        return &pending[static_cast<size_t>(it - listening.begin())];
+    }
+
+    struct Endpoint {
+        std::deque<std::string> inbound;
+        std::string outbound;
+        std::vector<std::string> datagrams;
+        bool closed = false;
+        bool stay_open = false;
+    };
+    std::mutex m;
+    std::map<int, Endpoint> endpoints;
+    // Queued clients by listener position.
+    std::map<size_t, std::deque<int>> pending;
+    std::vector<int> listener_fds;
+    std::vector<int> listening;
+    std::map<int, int> wake_counts;
+    std::vector<std::pair<int, int>> sockets;
+    std::vector<SocketOption> options;
+    std::vector<int> backlogs;
+    int next_fd = 100;
+};
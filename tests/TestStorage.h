@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <gtest/gtest.h>
+#include <sqlite3.h>
+#include "BlockStore.h"
+#include "Engine.h"
+
+// Helpers for tests that write and inspect sample databases directly.
+
+// Recreates `path` with the EngineImpl schema and inserts `rows` rows through
+// engineValuesInsertSql() in one transaction. `row_at(i)` returns the StoredSample
+// of row i; signals missing from its `present` are stored as NULL and its id is
+// ignored (the database assigns ids in insertion order).
+template <typename RowAt>
+void fillDatabase(const std::string& path, size_t rows, RowAt row_at) {
+    std::filesystem::remove(path);
+    { EngineImpl engine(path); }
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr);
+    sqlite3_stmt* stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, engineValuesInsertSql().c_str(), -1, &stmt, nullptr), SQLITE_OK);
+    for (size_t i = 0; i < rows; ++i) {
+        const StoredSample row = row_at(i);
+        for (size_t s = 0; s < kSignalCount; ++s) {
+            const int column = static_cast<int>(s) + 1;
+            if (row.present & (1u << s))
+                sqlite3_bind_int(stmt, column, signalValue(row.values, s));
+            else
+                sqlite3_bind_null(stmt, column);
+        }
+        sqlite3_bind_int64(stmt, static_cast<int>(kSignalCount) + 1, row.timestamp_ms);
+        EXPECT_EQ(sqlite3_step(stmt), SQLITE_DONE);
+        sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+    sqlite3_close(db);
+}
+
+// The first column of the first row `sql` returns, or -1 if there is none.
+inline int64_t queryInt(sqlite3* db, const std::string& sql) {
+    sqlite3_stmt* stmt = nullptr;
+    EXPECT_EQ(sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr), SQLITE_OK) << sql;
+    int64_t value = -1;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+        value = sqlite3_column_int64(stmt, 0);
+    sqlite3_finalize(stmt);
+    return value;
+}
+
+// As above, on the database at `path`.
+inline int64_t queryInt(const std::string& path, const std::string& sql) {
+    sqlite3* db = nullptr;
+    EXPECT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK) << path;
+    const int64_t value = queryInt(db, sql);
+    sqlite3_close(db);
+    return value;
+}
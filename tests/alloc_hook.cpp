@@ -0,0 +1,68 @@
+#include "AllocationHook.h"
+#include <atomic>
+#include <cerrno>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+}
+
+namespace {
+
+std::atomic<size_t> allocations{0};
+// Plain thread_locals with constant initialization: reading them never allocates.
+thread_local bool tracked = false;
+thread_local int paused = 0;
+
+inline void countAllocation() {
+    if (tracked && paused == 0)
+        allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+namespace alloc_hook {
+
+void trackThisThread() { tracked = true; }
+size_t count() { return allocations.load(std::memory_order_relaxed); }
+Pause::Pause() { ++paused; }
+Pause::~Pause() { --paused; }
+
+} // namespace alloc_hook
+
+// Interposed allocation entry points; operator new ends up here as well.
+extern "C" {
+
+void* malloc(size_t size) {
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    countAllocation();
+    return __libc_realloc(ptr, size);
+}
+
+// Aligned operator new (e.g. std::pmr::new_delete_resource) comes through these.
+void* aligned_alloc(size_t alignment, size_t size) {
+    countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) {
+    countAllocation();
+    void* p = __libc_memalign(alignment, size);
+    if (!p)
+        return ENOMEM;
+    *ptr = p;
+    return 0;
+}
+
+}
@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "BlockStore.h"
+#include "Engine.h"
+#include "HistoryAggregate.h"
+#include "HistoryExport.h"
+#include "TestStorage.h"
+#include "WarmStart.h"
+
+namespace {
+
+constexpr int64_t kBaseMs = 1704067200000;
+
+// Stores `count` samples 100 ms apart from `first_ms`, with rpm = first_rpm + index.
+void storeSamples(const StorageConfig& storage, int64_t first_ms, int first_rpm, int count) {
+    EngineImpl engine(storage);
+    for (int i = 0; i < count; ++i) {
+        EngineSnapshot snapshot;
+        snapshot.values = EngineSample{first_rpm + i, 90, 40, i % 300};
+        snapshot.timestamp_ms = first_ms + 100 * i;
+        engine.storeSample(snapshot);
+    }
+}
+
+std::vector<std::string> exportLines(const std::string& path, int64_t from_ms, int64_t to_ms, size_t chunk_rows,
+                                     int64_t step_ms = 0) {
+    HistoryCursor cursor;
+    EXPECT_TRUE(cursor.open(path, from_ms, to_ms, ExportFormat::Csv, step_ms));
+    std::string csv;
+    while (cursor.next(csv, chunk_rows)) {
+    }
+    EXPECT_FALSE(cursor.failed());
+    std::vector<std::string> lines;
+    size_t pos = 0;
+    while (pos < csv.size()) {
+        const size_t nl = csv.find('\n', pos);
+        lines.push_back(csv.substr(pos, nl - pos));
+        pos = nl + 1;
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST(BlockStoreTest, BlocksRoundTripSparseSignalsAndExtremes) {
+    std::mt19937 rng(7);
+    std::vector<StoredSample> samples(1000);
+    int64_t ts = kBaseMs;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        // Mostly steady timestamps with jitter, a jump back and a large gap.
+        ts += i == 500 ? -5000 : i == 700 ? 86400000 : 100 + static_cast<int64_t>(rng() % 3);
+        samples[i].id = 41 + static_cast<int64_t>(i);
+        samples[i].timestamp_ms = ts;
+        samples[i].values = EngineSample{static_cast<int>(rng() % 8000), 90 + static_cast<int>(i % 5),
+                                         i % 2 ? std::numeric_limits<int>::min() : std::numeric_limits<int>::max(),
+                                         static_cast<int>(i)};
+        // Oil pressure is sampled every other sample only; speed never.
+        samples[i].present = static_cast<uint8_t>(kAllSignals & ~(1u << signals::speed) &
+                                                  ~(i % 2 ? 0u : 1u << signals::oil_pressure));
+        samples[i].values.speed = 0;
+        if (!(samples[i].present & (1u << signals::oil_pressure)))
+            samples[i].values.oil_pressure = 0;
+    }
+    EncodedBlock encoded;
+    encodeBlock(samples.data(), samples.size(), encoded);
+    EXPECT_EQ(encoded.start_ts, samples.front().timestamp_ms);
+    EXPECT_EQ(encoded.end_ts, samples.back().timestamp_ms);
+    // Steady timestamps and temperature cost about a byte per sample.
+    EXPECT_LT(encoded.timestamps.size(), 1100u);
+    EXPECT_LT(encoded.signals[signals::temperature].size(), 1100u);
+    EXPECT_EQ(encoded.signals[signals::speed].size(), 1u);
+
+    std::array<std::string_view, kSignalCount> columns;
+    for (size_t s = 0; s < kSignalCount; ++s)
+        columns[s] = encoded.signals[s];
+    std::vector<StoredSample> decoded;
+    ASSERT_TRUE(decodeBlock(41, samples.size(), encoded.timestamps, columns, decoded));
+    ASSERT_EQ(decoded.size(), samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) {
+        SCOPED_TRACE(i);
+        EXPECT_EQ(decoded[i].id, samples[i].id);
+        EXPECT_EQ(decoded[i].timestamp_ms, samples[i].timestamp_ms);
+        EXPECT_EQ(decoded[i].present, samples[i].present);
+        for (size_t s = 0; s < kSignalCount; ++s)
+            EXPECT_EQ(signalValue(decoded[i].values, s), signalValue(samples[i].values, s));
+    }
+
+    // Truncated or mismatched blobs are rejected rather than misread.
+    const std::string truncated = encoded.timestamps.substr(0, encoded.timestamps.size() - 1);
+    EXPECT_FALSE(decodeBlock(41, samples.size(), truncated, columns, decoded));
+    EXPECT_FALSE(decodeBlock(41, samples.size() + 1, encoded.timestamps, columns, decoded));
+    columns[signals::rpm] = std::string_view();
+    EXPECT_FALSE(decodeBlock(41, samples.size(), encoded.timestamps, columns, decoded));
+}
+
+TEST(BlockStoreTest, EngineWritesBlocksThatExportsReadLikeRows) {
+    const std::string blocked = "/tmp/test_blocks.db";
+    const std::string plain = "/tmp/test_blocks_plain.db";
+    std::filesystem::remove(blocked);
+    std::filesystem::remove(plain);
+    StorageConfig storage;
+    storage.path = blocked;
+    storage.block_rows = 8;
+    storeSamples(storage, kBaseMs, 1000, 50);
+    storage.path = plain;
+    storage.block_rows = 0;
+    storeSamples(storage, kBaseMs, 1000, 50);
+
+    // 6 full blocks and the remainder written when the engine closed.
+    EXPECT_EQ(queryInt(blocked, "SELECT COUNT(*) FROM engine_blocks;"), 7);
+    EXPECT_EQ(queryInt(blocked, "SELECT SUM(samples) FROM engine_blocks;"), 50);
+    EXPECT_EQ(queryInt(blocked, "SELECT COUNT(*) FROM engine_values;"), 0);
+
+    // Ranges starting and ending inside blocks, in chunks that split blocks.
+    for (const auto& [from_ms, to_ms] : {std::pair<int64_t, int64_t>{0, std::numeric_limits<int64_t>::max()},
+                                         {kBaseMs + 550, kBaseMs + 3050}}) {
+        for (size_t chunk : {3u, 8u, 1000u}) {
+            SCOPED_TRACE(::testing::Message() << from_ms << " chunk=" << chunk);
+            EXPECT_EQ(exportLines(blocked, from_ms, to_ms, chunk), exportLines(plain, from_ms, to_ms, chunk));
+        }
+    }
+    const std::vector<std::string> lines = exportLines(blocked, kBaseMs + 550, kBaseMs + 3050, 3);
+    ASSERT_EQ(lines.size(), 26u);
+    EXPECT_EQ(lines[1], "7," + std::to_string(kBaseMs + 600) + ",1006,90,40,6");
+    std::filesystem::remove(blocked);
+    std::filesystem::remove(plain);
+}
+
+TEST(BlockStoreTest, BlocksCloseAfterBlockMs) {
+    const std::string path = "/tmp/test_blocks_span.db";
+    std::filesystem::remove(path);
+    StorageConfig storage;
+    storage.path = path;
+    storage.block_rows = 1000;
+    storage.block_ms = 1000;
+    // 100 ms apart: ten samples per block.
+    storeSamples(storage, kBaseMs, 0, 35);
+    EXPECT_EQ(queryInt(path, "SELECT COUNT(*) FROM engine_blocks;"), 4);
+    EXPECT_EQ(queryInt(path, "SELECT MAX(end_ts - start_ts) FROM engine_blocks;"), 900);
+    std::filesystem::remove(path);
+}
+
+TEST(BlockStoreTest, SwitchingLayoutsKeepsIdsInWriteOrder) {
+    const std::string path = "/tmp/test_blocks_mixed.db";
+    std::filesystem::remove(path);
+    StorageConfig storage;
+    storage.path = path;
+    storeSamples(storage, kBaseMs, 0, 10);
+    storage.block_rows = 4;
+    storeSamples(storage, kBaseMs + 1000, 10, 10);
+    storage.block_rows = 0;
+    storeSamples(storage, kBaseMs + 2000, 20, 10);
+
+    const std::vector<std::string> lines = exportLines(path, 0, std::numeric_limits<int64_t>::max(), 7);
+    ASSERT_EQ(lines.size(), 31u);
+    for (int i = 0; i < 30; ++i) {
+        const std::string prefix = std::to_string(i + 1) + "," + std::to_string(kBaseMs + 100 * i) + "," +
+                                   std::to_string(i) + ",";
+        EXPECT_EQ(lines[i + 1].rfind(prefix, 0), 0u) << lines[i + 1];
+    }
+
+    // Warm start reads the same samples newest first and stops inside the blocks.
+    std::vector<EngineSnapshot> samples;
+    WarmStartStats stats;
+    ASSERT_TRUE(loadRecentSamples(storage, kBaseMs + 1250, samples, stats));
+    ASSERT_EQ(samples.size(), 17u);
+    EXPECT_EQ(samples.front().timestamp_ms, kBaseMs + 1300);
+    EXPECT_EQ(samples.front().values.rpm, 13);
+    EXPECT_EQ(samples.back().values.rpm, 29);
+    std::filesystem::remove(path);
+}
+
+TEST(BlockStoreTest, InterpolatedExportsReadBlocks) {
+    const std::string blocked = "/tmp/test_blocks_step.db";
+    const std::string plain = "/tmp/test_blocks_step_plain.db";
+    std::filesystem::remove(blocked);
+    std::filesystem::remove(plain);
+    // Multi-rate samples: temperature is read every fifth sample only. The blocked
+    // database starts with rows and continues in blocks.
+    auto store = [](const std::string& path, size_t block_rows, int first, int count) {
+        StorageConfig storage;
+        storage.path = path;
+        storage.block_rows = block_rows;
+        EngineImpl engine(storage);
+        for (int i = first; i < first + count; ++i) {
+            EngineSnapshot snapshot;
+            snapshot.values = EngineSample{1000 + 10 * i, i % 5 ? 0 : 80 + i, 40, i % 300};
+            snapshot.timestamp_ms = kBaseMs + 100 * i;
+            snapshot.fresh = static_cast<uint8_t>(i % 5 ? kAllSignals & ~(1u << signals::temperature) : kAllSignals);
+            engine.storeSample(snapshot);
+        }
+    };
+    store(blocked, 0, 0, 12);
+    store(blocked, 8, 12, 40);
+    store(plain, 0, 0, 52);
+    ASSERT_GT(queryInt(blocked, "SELECT COUNT(*) FROM engine_blocks;"), 0);
+
+    // Ranges starting before, inside and after the switch to blocks, in chunks that pause the reads.
+    for (const int64_t from_ms : {int64_t{0}, kBaseMs + 730, kBaseMs + 2130}) {
+        for (size_t chunk : {3u, 1000u}) {
+            SCOPED_TRACE(::testing::Message() << from_ms << " chunk=" << chunk);
+            const std::vector<std::string> lines =
+                exportLines(blocked, from_ms, std::numeric_limits<int64_t>::max(), chunk, 250);
+            EXPECT_GT(lines.size(), 10u);
+            EXPECT_EQ(lines, exportLines(plain, from_ms, std::numeric_limits<int64_t>::max(), chunk, 250));
+        }
+    }
+    // Halfway between the temperature samples at 2000 ms (100) and 2500 ms (105).
+    const std::vector<std::string> lines = exportLines(blocked, kBaseMs + 2250, kBaseMs + 2251, 10, 250);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[1], "1," + std::to_string(kBaseMs + 2250) + ",1225,103,40,23");
+    std::filesystem::remove(blocked);
+    std::filesystem::remove(plain);
+}
+
+TEST(BlockStoreTest, AggregatesMatchTheRowLayout) {
+    const std::string blocked = "/tmp/test_blocks_aggregate.db";
+    const std::string plain = "/tmp/test_blocks_aggregate_plain.db";
+    std::filesystem::remove(blocked);
+    std::filesystem::remove(plain);
+    StorageConfig storage;
+    storage.path = blocked;
+    storage.block_rows = 1000;
+    storeSamples(storage, kBaseMs, 500, 20000);
+    storage.path = plain;
+    storage.block_rows = 0;
+    storeSamples(storage, kBaseMs, 500, 20000);
+
+    for (size_t threads : {1u, 4u}) {
+        AggregateOptions options;
+        options.threads = threads;
+        options.block_rows = 100;
+        AggregateResult a, b;
+        ASSERT_TRUE(aggregateHistory(blocked, kBaseMs + 12345, kBaseMs + 150005, a, options));
+        ASSERT_TRUE(aggregateHistory(plain, kBaseMs + 12345, kBaseMs + 150005, b, options));
+        EXPECT_EQ(a.rows, b.rows);
+        EXPECT_EQ(a.rows, 1377u);
+        for (size_t s = 0; s < kSignalCount; ++s) {
+            SCOPED_TRACE(::testing::Message() << kSignalFields[s].name << " threads=" << threads);
+            EXPECT_EQ(a.signals[s].count, b.signals[s].count);
+            EXPECT_EQ(a.signals[s].sum, b.signals[s].sum);
+            EXPECT_EQ(a.signals[s].min, b.signals[s].min);
+            EXPECT_EQ(a.signals[s].max, b.signals[s].max);
+            EXPECT_EQ(a.signals[s].p50, b.signals[s].p50);
+            EXPECT_EQ(a.signals[s].p99, b.signals[s].p99);
+        }
+    }
+    // 100 samples per block (block_ms) take a fifth of the space of rows, or less.
+    EXPECT_LT(std::filesystem::file_size(blocked) * 5, std::filesystem::file_size(plain));
+    std::filesystem::remove(blocked);
+    std::filesystem::remove(plain);
+}
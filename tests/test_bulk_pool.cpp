@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BulkPool.h"
+
+namespace {
+
+// Appends its name to a shared log once per step.
+struct LoggingJob : BulkJob {
+    LoggingJob(char name, int steps, std::string& log, std::mutex& m) : name(name), steps(steps), log(log), m(m) {}
+    void step() override {
+        std::lock_guard<std::mutex> lock(m);
+        log += name;
+        ++done;
+    }
+    char name;
+    int steps;
+    int done = 0;
+    std::string& log;
+    std::mutex& m;
+};
+
+// Blocks its worker until released.
+struct GateJob : BulkJob {
+    void step() override {
+        entered.set_value();
+        released.get_future().wait();
+    }
+    std::promise<void> entered;
+    std::promise<void> released;
+};
+
+bool waitUntil(const std::function<bool()>& condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(BulkPoolTest, JobsTakeTurnsStepByStep) {
+    BulkPool pool;
+    pool.start(1, 8, 0, nullptr);
+    std::string log;
+    std::mutex m;
+    // A long job submitted first does not hold up the short ones behind it.
+    std::vector<std::shared_ptr<LoggingJob>> jobs = {std::make_shared<LoggingJob>('H', 50, log, m),
+                                                     std::make_shared<LoggingJob>('a', 3, log, m),
+                                                     std::make_shared<LoggingJob>('b', 3, log, m)};
+    for (auto& job : jobs) {
+        ASSERT_TRUE(pool.admit());
+        pool.submit(job);
+    }
+    // The owner's side: resubmit each job once its step has run, until it is done.
+    ASSERT_TRUE(waitUntil([&] {
+        bool all_done = true;
+        for (auto& job : jobs) {
+            if (!job->ready())
+                all_done = false;
+            else if (job->done < job->steps) {
+                pool.submit(job);
+                all_done = false;
+            }
+        }
+        return all_done;
+    }));
+    pool.stop();
+
+    ASSERT_EQ(log.size(), 56u);
+    EXPECT_EQ(pool.steps(), 56u);
+    EXPECT_LT(log.find_last_of("ab"), 12u) << log;
+}
+
+TEST(BulkPoolTest, CancelledStepsAreSkipped) {
+    BulkPool pool;
+    std::atomic<int> notified{0};
+    pool.start(1, 8, 0, [&] { ++notified; });
+    auto gate = std::make_shared<GateJob>();
+    std::string log;
+    std::mutex m;
+    auto cancelled = std::make_shared<LoggingJob>('x', 1, log, m);
+    auto after = std::make_shared<LoggingJob>('y', 1, log, m);
+    pool.submit(gate);
+    gate->entered.get_future().wait();
+    pool.submit(cancelled);
+    pool.submit(after);
+    cancelled->cancel();
+    gate->released.set_value();
+    ASSERT_TRUE(waitUntil([&] { return after->ready(); }));
+    pool.stop();
+
+    EXPECT_EQ(log, "y");
+    EXPECT_FALSE(cancelled->ready());
+    EXPECT_EQ(notified.load(), 2);
+}
+
+TEST(BulkPoolTest, AdmissionIsBounded) {
+    BulkPool pool;
+    pool.start(2, 2, 0, nullptr);
+    EXPECT_TRUE(pool.admit());
+    EXPECT_TRUE(pool.admit());
+    EXPECT_FALSE(pool.admit());
+    EXPECT_EQ(pool.admitted(), 2u);
+    pool.retire();
+    EXPECT_TRUE(pool.admit());
+    pool.stop();
+    EXPECT_EQ(pool.admitted(), 0u);
+}
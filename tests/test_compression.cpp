@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Compression.h"
+#include "Engine.h"
+#include "HistoryExport.h"
+
+namespace {
+
+// Steady engine: a slow drift plus +-1 noise, sampled every 10 ms.
+int steadyValue(int i) {
+    return 3000 + static_cast<int>(std::lround(20.0 * std::sin(i / 200.0))) + (i * 7919 % 3) - 1;
+}
+
+std::vector<StoredPoint> compress(SignalCompressor& compressor, const std::vector<StoredPoint>& samples) {
+    std::vector<StoredPoint> stored;
+    StoredPoint out[SignalCompressor::kMaxPoints];
+    for (const StoredPoint& s : samples) {
+        const size_t n = compressor.offer(s.timestamp_ms, s.value, out);
+        stored.insert(stored.end(), out, out + n);
+    }
+    const size_t n = compressor.flush(out);
+    stored.insert(stored.end(), out, out + n);
+    return stored;
+}
+
+// Largest difference between a sample and the line through the stored points around it.
+double maxReconstructionError(const std::vector<StoredPoint>& samples, const std::vector<StoredPoint>& stored) {
+    double worst = 0.0;
+    size_t k = 0;
+    for (const StoredPoint& s : samples) {
+        while (k + 1 < stored.size() && stored[k + 1].timestamp_ms <= s.timestamp_ms)
+            ++k;
+        double value = stored[k].value;
+        if (k + 1 < stored.size()) {
+            const double fraction = static_cast<double>(s.timestamp_ms - stored[k].timestamp_ms) /
+                (stored[k + 1].timestamp_ms - stored[k].timestamp_ms);
+            value += (stored[k + 1].value - stored[k].value) * fraction;
+        }
+        worst = std::max(worst, std::abs(value - s.value));
+    }
+    return worst;
+}
+
+std::vector<StoredPoint> steadySamples(int count) {
+    std::vector<StoredPoint> samples;
+    for (int i = 0; i < count; ++i)
+        samples.push_back(StoredPoint{1000 + 10 * i, steadyValue(i)});
+    return samples;
+}
+
+} // namespace
+
+TEST(CompressionTest, DeadbandBoundsErrorAndStoresFewSamples) {
+    const std::vector<StoredPoint> samples = steadySamples(5000);
+    SignalCompressor compressor(SignalCompression{CompressionMode::Deadband, 5.0}, 0);
+    const std::vector<StoredPoint> stored = compress(compressor, samples);
+    EXPECT_EQ(stored.front().timestamp_ms, samples.front().timestamp_ms);
+    EXPECT_LT(stored.size() * 10, samples.size());
+    EXPECT_LE(maxReconstructionError(samples, stored), 5.0);
+}
+
+TEST(CompressionTest, SwingingDoorBoundsErrorAndStoresFewSamples) {
+    const std::vector<StoredPoint> samples = steadySamples(5000);
+    SignalCompressor compressor(SignalCompression{CompressionMode::SwingingDoor, 2.0}, 0);
+    const std::vector<StoredPoint> stored = compress(compressor, samples);
+    EXPECT_LT(stored.size() * 10, samples.size());
+    EXPECT_LE(maxReconstructionError(samples, stored), 2.0 + 1e-9);
+    for (size_t i = 1; i < stored.size(); ++i)
+        EXPECT_LT(stored[i - 1].timestamp_ms, stored[i].timestamp_ms);
+}
+
+TEST(CompressionTest, SwingingDoorFollowsRampsWithTwoPoints) {
+    std::vector<StoredPoint> samples;
+    for (int i = 0; i < 100; ++i)
+        samples.push_back(StoredPoint{10 * i, 5 * i});
+    SignalCompressor compressor(SignalCompression{CompressionMode::SwingingDoor, 0.5}, 0);
+    const std::vector<StoredPoint> stored = compress(compressor, samples);
+    ASSERT_EQ(stored.size(), 2u);
+    EXPECT_EQ(stored[1].timestamp_ms, 990);
+    EXPECT_EQ(stored[1].value, 495);
+}
+
+TEST(CompressionTest, HeartbeatLimitsSilence) {
+    for (CompressionMode mode : {CompressionMode::Deadband, CompressionMode::SwingingDoor}) {
+        std::vector<StoredPoint> samples;
+        for (int i = 0; i < 1000; ++i)
+            samples.push_back(StoredPoint{10 * i, 42});
+        SignalCompressor compressor(SignalCompression{mode, 1.0}, 1000);
+        const std::vector<StoredPoint> stored = compress(compressor, samples);
+        EXPECT_GE(stored.size(), 10u);
+        EXPECT_LE(stored.size(), 22u);
+        for (size_t i = 1; i < stored.size(); ++i)
+            EXPECT_LE(stored[i].timestamp_ms - stored[i - 1].timestamp_ms, 1000);
+        EXPECT_EQ(stored.back().timestamp_ms, 9990);
+    }
+}
+
+TEST(CompressionTest, SampleCompressorGroupsPointsIntoRows) {
+    CompressionConfig config;
+    config.signals[1] = SignalCompression{CompressionMode::Deadband, 1.0};
+    SampleCompressor compressor(config);
+    ASSERT_TRUE(compressor.enabled());
+    std::vector<CompressedRow> rows;
+    for (int i = 0; i < 3; ++i) {
+        EngineSnapshot snapshot;
+        snapshot.values = EngineSample{1000 + i, 90, 40, 100};
+        snapshot.timestamp_ms = 100 + i;
+        compressor.offer(snapshot, rows);
+    }
+    // temperature is stored only in the first row; the uncompressed signals every time.
+    ASSERT_EQ(rows.size(), 3u);
+    EXPECT_EQ(rows[0].fresh, kAllSignals);
+    EXPECT_EQ(rows[2].fresh, kAllSignals & ~(1u << 1));
+    EXPECT_EQ(rows[2].values.rpm, 1002);
+    EXPECT_EQ(compressor.offered(), 12u);
+    EXPECT_EQ(compressor.stored(), 10u);
+
+    rows.clear();
+    compressor.flush(rows);
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(rows[0].timestamp_ms, 102);
+    EXPECT_EQ(rows[0].fresh, 1u << 1);
+    EXPECT_EQ(rows[0].values.temperature, 90);
+}
+
+TEST(CompressionTest, CompressedStorageIsReconstructedByInterpolatedExport) {
+    const std::string path = "/tmp/test_compression.db";
+    std::filesystem::remove(path);
+    StorageConfig storage;
+    storage.path = path;
+    storage.compression.signals[0] = SignalCompression{CompressionMode::SwingingDoor, 2.0};
+    storage.compression.signals[1] = SignalCompression{CompressionMode::Deadband, 0.0};
+    storage.compression.signals[2] = SignalCompression{CompressionMode::Deadband, 0.0};
+    storage.compression.signals[3] = SignalCompression{CompressionMode::Deadband, 0.0};
+    storage.compression.max_silence_ms = 0;
+    std::vector<EngineSnapshot> samples;
+    for (int i = 0; i < 2000; ++i) {
+        EngineSnapshot snapshot;
+        snapshot.values = EngineSample{steadyValue(i), 90, 40, 100};
+        snapshot.timestamp_ms = 1000 + 10 * i;
+        samples.push_back(snapshot);
+    }
+    {
+        EngineImpl engine(storage);
+        for (const EngineSnapshot& s : samples)
+            engine.storeSample(s);
+        EXPECT_EQ(engine.valuesOffered(), 8000u);
+        EXPECT_LT(engine.valuesStored() * 10, engine.valuesOffered());
+    }
+
+    // One row per stored sample time, chunked so reads resume between chunks.
+    HistoryCursor cursor;
+    ASSERT_TRUE(cursor.open(path, 0, std::numeric_limits<int64_t>::max(), ExportFormat::Csv, 10));
+    std::string csv;
+    while (cursor.next(csv, 7)) {
+    }
+    ASSERT_FALSE(cursor.failed());
+    EXPECT_EQ(cursor.rowsExported(), samples.size());
+
+    std::istringstream lines(csv);
+    std::string line;
+    std::getline(lines, line);
+    size_t row = 0;
+    while (std::getline(lines, line)) {
+        ASSERT_LT(row, samples.size());
+        long long id, timestamp;
+        int rpm, temperature, oil_pressure, speed;
+        ASSERT_EQ(std::sscanf(line.c_str(), "%lld,%lld,%d,%d,%d,%d", &id, &timestamp, &rpm, &temperature,
+                              &oil_pressure, &speed), 6) << line;
+        EXPECT_EQ(id, static_cast<long long>(row + 1));
+        EXPECT_EQ(timestamp, samples[row].timestamp_ms);
+        // 2.0 from the compression plus rounding to an integer.
+        EXPECT_LE(std::abs(rpm - samples[row].values.rpm), 2) << line;
+        EXPECT_EQ(temperature, 90);
+        EXPECT_EQ(speed, 100);
+        ++row;
+    }
+    EXPECT_EQ(row, samples.size());
+    std::filesystem::remove(path);
+}
+
+TEST(CompressionTest, InterpolatedExportFillsMultiRateNulls) {
+    const std::string path = "/tmp/test_interpolate_nulls.db";
+    std::filesystem::remove(path);
+    {
+        EngineImpl engine(path);
+        EngineSnapshot snapshot;
+        snapshot.values = EngineSample{1000, 80, 40, 0};
+        snapshot.timestamp_ms = 1000;
+        snapshot.fresh = 0b0111;
+        engine.storeSample(snapshot);
+        snapshot.values = EngineSample{2000, 0, 0, 50};
+        snapshot.timestamp_ms = 1100;
+        snapshot.fresh = 0b1001;
+        engine.storeSample(snapshot);
+        snapshot.values = EngineSample{0, 100, 60, 0};
+        snapshot.timestamp_ms = 1200;
+        snapshot.fresh = 0b0110;
+        engine.storeSample(snapshot);
+    }
+    HistoryCursor cursor;
+    ASSERT_TRUE(cursor.open(path, 0, std::numeric_limits<int64_t>::max(), ExportFormat::Csv, 50));
+    std::string csv;
+    while (cursor.next(csv)) {
+    }
+    EXPECT_EQ(csv,
+              "id,timestamp_ms,rpm,temperature,oil_pressure,speed\n"
+              "1,1000,1000,80,40,\n"
+              "2,1050,1500,85,45,\n"
+              "3,1100,2000,90,50,50\n"
+              "4,1150,2000,95,55,50\n"
+              "5,1200,2000,100,60,50\n");
+    std::filesystem::remove(path);
+}
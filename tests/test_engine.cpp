@@ -37,6 +37,22 @@ TEST(EngineTest, GetSpeedReturnsValueInRange) {
     std::filesystem::remove("/tmp/test_engine_speed.db");
 }
 
+TEST(EngineTest, SampleReturnsAllValuesInRange) {
+    EngineImpl engine("/tmp/test_engine_sample.db");
+    for (int i = 0; i < 50; ++i) {
+        EngineSample s = engine.sample();
+        EXPECT_GE(s.rpm, 0);
+        EXPECT_LE(s.rpm, 8000);
+        EXPECT_GE(s.temperature, -50);
+        EXPECT_LE(s.temperature, 500);
+        EXPECT_GE(s.oil_pressure, 0);
+        EXPECT_LE(s.oil_pressure, 200);
+        EXPECT_GE(s.speed, 0);
+        EXPECT_LE(s.speed, 500);
+    }
+    std::filesystem::remove("/tmp/test_engine_sample.db");
+}
+
 TEST(EngineTest, DatabaseIsCreated) {
     const std::string db_path = "/tmp/test_engine_db_created.db";
     std::filesystem::remove(db_path);
@@ -188,3 +204,79 @@ TEST(EngineTest, StoredValuesAreInCorrectRange) {
     sqlite3_close(db);
     std::filesystem::remove(db_path);
 }
+
+TEST(EngineTest, StoreAlertEventPersistsRow) {
+    const std::string db_path = "/tmp/test_engine_alerts.db";
+    std::filesystem::remove(db_path);
+    {
+        EngineImpl engine(db_path);
+        engine.storeAlertEvent("low_oil", true, 1234, EngineSample{5000, 95, 7, 120});
+    }
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(db_path.c_str(), &db), SQLITE_OK);
+    sqlite3_stmt* stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT rule, raised, rpm, oil_pressure, timestamp FROM alert_events;", -1, &stmt, nullptr), SQLITE_OK);
+    ASSERT_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    EXPECT_STREQ(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)), "low_oil");
+    EXPECT_EQ(sqlite3_column_int(stmt, 1), 1);
+    EXPECT_EQ(sqlite3_column_int(stmt, 2), 5000);
+    EXPECT_EQ(sqlite3_column_int(stmt, 3), 7);
+    EXPECT_EQ(sqlite3_column_int64(stmt, 4), 1234);
+    EXPECT_EQ(sqlite3_step(stmt), SQLITE_DONE);
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    std::filesystem::remove(db_path);
+}
+
+TEST(EngineTest, StoreSampleWritesOnlyFreshSignals) {
+    const std::string db_path = "/tmp/test_engine_sparse.db";
+    std::filesystem::remove(db_path);
+    {
+        EngineImpl engine(db_path);
+        EngineSnapshot snapshot;
+        snapshot.values = EngineSample{3000, 90, 40, 100};
+        snapshot.timestamp_ms = 777;
+        snapshot.fresh = 1u << 0; // rpm only
+        engine.storeSample(snapshot);
+    }
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(db_path.c_str(), &db), SQLITE_OK);
+    sqlite3_stmt* stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT rpm, temperature, speed, timestamp FROM engine_values;", -1, &stmt, nullptr), SQLITE_OK);
+    ASSERT_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    EXPECT_EQ(sqlite3_column_int(stmt, 0), 3000);
+    EXPECT_EQ(sqlite3_column_type(stmt, 1), SQLITE_NULL);
+    EXPECT_EQ(sqlite3_column_type(stmt, 2), SQLITE_NULL);
+    EXPECT_EQ(sqlite3_column_int64(stmt, 3), 777);
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    std::filesystem::remove(db_path);
+}
+
+TEST(EngineTest, StoreSampleRepeatsValuesInLegacyNotNullDatabase) {
+    const std::string db_path = "/tmp/test_engine_legacy.db";
+    std::filesystem::remove(db_path);
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(db_path.c_str(), &db), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(db, "CREATE TABLE engine_values (id INTEGER PRIMARY KEY AUTOINCREMENT, rpm INTEGER NOT NULL, "
+                               "temperature INTEGER NOT NULL, oil_pressure INTEGER NOT NULL, speed INTEGER NOT NULL, "
+                               "timestamp INTEGER NOT NULL);", nullptr, nullptr, nullptr), SQLITE_OK);
+    sqlite3_close(db);
+    {
+        EngineImpl engine(db_path);
+        EngineSnapshot snapshot;
+        snapshot.values = EngineSample{3000, 90, 40, 100};
+        snapshot.timestamp_ms = 777;
+        snapshot.fresh = 1u << 0;
+        engine.storeSample(snapshot);
+    }
+    ASSERT_EQ(sqlite3_open(db_path.c_str(), &db), SQLITE_OK);
+    sqlite3_stmt* stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT rpm, temperature FROM engine_values;", -1, &stmt, nullptr), SQLITE_OK);
+    ASSERT_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    EXPECT_EQ(sqlite3_column_int(stmt, 0), 3000);
+    EXPECT_EQ(sqlite3_column_int(stmt, 1), 90);
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    std::filesystem::remove(db_path);
+}
@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "EngineClient.h"
+#include "Server.hpp"
+#include "TestDoubles.h"
+
+namespace {
+
+using SocketServer = BasicServer<FakeEngine, PosixTransport>;
+
+const char* kSocketPath = "/tmp/middlewaresw_client_test.sock";
+
+ServerConfig serverConfig() {
+    ServerConfig config;
+    // Keep the TCP listener off the default port other tests use.
+    config.socket.port = 15561;
+    config.unix_socket.enabled = true;
+    config.unix_socket.path = kSocketPath;
+    return config;
+}
+
+ClientConfig clientConfig() {
+    ClientConfig config;
+    config.unix_path = kSocketPath;
+    config.reconnect_min = std::chrono::milliseconds(10);
+    config.reconnect_max = std::chrono::milliseconds(40);
+    return config;
+}
+
+ClientTask pollThrice(EngineClient& client, std::vector<ClientResponse>& out, std::atomic<bool>& done) {
+    for (int i = 0; i < 3; ++i)
+        out.push_back(co_await client.asyncPoll());
+    Request request;
+    request.set_include_stats(true);
+    out.push_back(co_await client.asyncRequest(request));
+    done = true;
+}
+
+// Long polls chained on the sequence of the previous answer.
+ClientTask followSamples(EngineClient& client, int count, std::vector<uint64_t>& sequences, std::atomic<bool>& done) {
+    uint64_t last = 0;
+    for (int i = 0; i < count; ++i) {
+        Request request;
+        request.set_after_sequence(last);
+        ClientResponse r = co_await client.asyncRequest(request);
+        if (r.status != ClientStatus::Ok)
+            break;
+        last = r.data.sequence();
+        sequences.push_back(last);
+    }
+    done = true;
+}
+
+} // namespace
+
+TEST(EngineClientTest, PipelinedPollsAreAnsweredInOrder) {
+    SocketServer server(serverConfig());
+    server.start(5);
+    ClientConfig config = clientConfig();
+    config.pool_size = 2;
+    config.max_in_flight = 8;
+    EngineClient client(config);
+    ASSERT_TRUE(client.start());
+
+    constexpr int kRequests = 500;
+    std::atomic<int> ok{0}, failed{0};
+    for (int i = 0; i < kRequests; ++i) {
+        ASSERT_TRUE(client.poll([&](ClientStatus status, const EngineData& data) {
+            if (status == ClientStatus::Ok && data.rpm() == 1200)
+                ++ok;
+            else
+                ++failed;
+        }));
+    }
+    EXPECT_TRUE(waitFor([&] { return ok.load() + failed.load() == kRequests; }));
+    EXPECT_EQ(ok.load(), kRequests);
+    const EngineClientCounters counters = client.getCounters();
+    EXPECT_EQ(counters.requests, static_cast<uint64_t>(kRequests));
+    EXPECT_EQ(counters.frames, static_cast<uint64_t>(kRequests));
+    EXPECT_EQ(counters.connected, 2u);
+    client.stop();
+    server.stop();
+}
+
+TEST(EngineClientTest, CoroutinesAwaitResponses) {
+    SocketServer server(serverConfig());
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return !server.getLatestStats().empty(); }));
+    EngineClient client(clientConfig());
+    ASSERT_TRUE(client.start());
+
+    std::vector<ClientResponse> responses;
+    std::atomic<bool> done{false};
+    pollThrice(client, responses, done);
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    ASSERT_EQ(responses.size(), 4u);
+    for (const ClientResponse& r : responses) {
+        EXPECT_EQ(r.status, ClientStatus::Ok);
+        EXPECT_EQ(r.data.speed(), 80);
+    }
+    EXPECT_EQ(responses[0].data.windows_size(), 0);
+    EXPECT_EQ(responses[3].data.windows_size(), 3);
+    client.stop();
+    server.stop();
+}
+
+TEST(EngineClientTest, QueuedRequestsWaitForReconnect) {
+    ::unlink(kSocketPath);
+    EngineClient client(clientConfig());
+    ASSERT_TRUE(client.start());
+    // No server yet: the request waits while the client retries.
+    std::atomic<int> first{-1};
+    ASSERT_TRUE(client.poll([&](ClientStatus status, const EngineData&) { first = static_cast<int>(status); }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_EQ(first.load(), -1);
+    EXPECT_GT(client.getCounters().disconnects, 0u);
+
+    {
+        SocketServer server(serverConfig());
+        server.start(5);
+        ASSERT_TRUE(waitFor([&] { return first.load() != -1; }));
+        EXPECT_EQ(first.load(), static_cast<int>(ClientStatus::Ok));
+        server.stop();
+    }
+    ASSERT_TRUE(waitFor([&] { return client.getCounters().connected == 0; }));
+
+    SocketServer restarted(serverConfig());
+    restarted.start(5);
+    std::atomic<int> second{-1};
+    ASSERT_TRUE(client.poll([&](ClientStatus status, const EngineData&) { second = static_cast<int>(status); }));
+    ASSERT_TRUE(waitFor([&] { return second.load() != -1; }));
+    EXPECT_EQ(second.load(), static_cast<int>(ClientStatus::Ok));
+    client.stop();
+    restarted.stop();
+}
+
+TEST(EngineClientTest, StopCompletesOutstandingRequests) {
+    ::unlink(kSocketPath);
+    EngineClient client(clientConfig());
+    EXPECT_FALSE(client.poll([](ClientStatus, const EngineData&) {}));
+    ASSERT_TRUE(client.start());
+    std::atomic<int> closed{0};
+    for (int i = 0; i < 3; ++i)
+        client.poll([&](ClientStatus status, const EngineData&) { closed += status == ClientStatus::Closed; });
+    client.stop();
+    EXPECT_EQ(closed.load(), 3);
+    EXPECT_FALSE(client.poll([](ClientStatus, const EngineData&) {}));
+}
+
+TEST(EngineClientTest, TooManyQueuedRequestsAreRejected) {
+    ::unlink(kSocketPath);
+    ClientConfig config = clientConfig();
+    config.max_queued = 4;
+    EngineClient client(config);
+    ASSERT_TRUE(client.start());
+    int accepted = 0;
+    for (int i = 0; i < 10; ++i)
+        accepted += client.poll([](ClientStatus, const EngineData&) {});
+    EXPECT_EQ(accepted, 4);
+    client.stop();
+}
+
+TEST(EngineClientTest, AlertSubscriptionStreamsFrames) {
+    ServerConfig server_config = serverConfig();
+    server_config.alerts.rules = {"hot: temperature > 100"};
+    SocketServer server(server_config);
+    server.start(5);
+    EngineClient client(clientConfig());
+    ASSERT_TRUE(client.start());
+
+    std::mutex m;
+    std::vector<std::string> alerts;
+    std::atomic<int> acks{0};
+    const uint64_t id = client.subscribeAlerts([&](ClientStatus status, const EngineData& data) {
+        if (status != ClientStatus::Ok)
+            return;
+        if (data.alerts_size() == 0) {
+            ++acks;
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m);
+        for (const Alert& alert : data.alerts())
+            alerts.push_back(alert.rule() + (alert.raised() ? "+" : "-"));
+    });
+    ASSERT_NE(id, 0u);
+    ASSERT_TRUE(waitFor([&] { return acks.load() == 1; }));
+    server.engine().setNext({1200, 130, 45, 80});
+    ASSERT_TRUE(waitFor([&] {
+        std::lock_guard<std::mutex> lock(m);
+        return !alerts.empty();
+    }));
+    {
+        std::lock_guard<std::mutex> lock(m);
+        EXPECT_EQ(alerts[0], "hot+");
+    }
+    client.unsubscribe(id);
+    ASSERT_TRUE(waitFor([&] { return client.getCounters().connected == 1; }));
+    client.stop();
+    server.stop();
+}
+
+TEST(EngineClientTest, ChainedLongPollsSeeEverySample) {
+    SocketServer server(serverConfig());
+    server.start(20);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 1; }));
+    EngineClient client(clientConfig());
+    ASSERT_TRUE(client.start());
+
+    std::vector<uint64_t> sequences;
+    std::atomic<bool> done{false};
+    followSamples(client, 6, sequences, done);
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    ASSERT_EQ(sequences.size(), 6u);
+    // The first answer is immediate; each later one is the next sample.
+    for (size_t i = 1; i < sequences.size(); ++i)
+        EXPECT_EQ(sequences[i], sequences[i - 1] + 1);
+    client.stop();
+    server.stop();
+}
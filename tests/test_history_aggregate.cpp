@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <sqlite3.h>
+#include "Engine.h"
+#include "HistoryAggregate.h"
+#include "PartitionedStore.h"
+#include "TestStorage.h"
+
+namespace {
+
+constexpr int64_t kHourMs = 3600 * 1000;
+// 2024-01-01T00:00:00Z
+constexpr int64_t kBaseMs = 1704067200000LL;
+
+// Random samples at 1000, 1010, ...; about one value in five is NULL (unsampled)
+// and a few lie outside the signal ranges.
+void fillRandom(const std::string& path, int rows) {
+    std::mt19937 rng(7);
+    fillDatabase(path, static_cast<size_t>(rows), [&](size_t i) {
+        StoredSample row;
+        row.timestamp_ms = 1000 + 10 * static_cast<int64_t>(i);
+        for (size_t s = 0; s < kSignalCount; ++s) {
+            const SignalField& field = kSignalFields[s];
+            const int value = std::uniform_int_distribution<int>(field.min - 20, field.max + 20)(rng);
+            if (rng() % 5 != 0) {
+                signalValue(row.values, s) = value;
+                row.present |= static_cast<uint8_t>(1u << s);
+            }
+        }
+        return row;
+    });
+}
+
+// Checks `result` against SQLite's own aggregates over `table` (a table or view).
+void expectMatchesSqlite(sqlite3* db, const std::string& table, int64_t from_ms, int64_t to_ms,
+                         const AggregateResult& result) {
+    const std::string range =
+        " WHERE timestamp >= " + std::to_string(from_ms) + " AND timestamp < " + std::to_string(to_ms);
+    EXPECT_EQ(result.rows, static_cast<uint64_t>(queryInt(db, "SELECT COUNT(*) FROM " + table + range)));
+    for (size_t s = 0; s < kSignalCount; ++s) {
+        const std::string name = kSignalFields[s].name;
+        const std::string where = range + " AND " + name + " IS NOT NULL";
+        const SignalAggregate& a = result.signals[s];
+        SCOPED_TRACE(name);
+        const int64_t count = queryInt(db, "SELECT COUNT(" + name + ") FROM " + table + range);
+        ASSERT_EQ(a.count, static_cast<uint64_t>(count));
+        ASSERT_GT(count, 0);
+        EXPECT_EQ(a.sum, queryInt(db, "SELECT SUM(" + name + ") FROM " + table + range));
+        EXPECT_EQ(a.min, queryInt(db, "SELECT MIN(" + name + ") FROM " + table + range));
+        EXPECT_EQ(a.max, queryInt(db, "SELECT MAX(" + name + ") FROM " + table + range));
+        EXPECT_DOUBLE_EQ(a.mean, static_cast<double>(a.sum) / static_cast<double>(count));
+        const std::pair<double, int> quantiles[] = {{0.50, a.p50}, {0.90, a.p90}, {0.99, a.p99}};
+        for (const auto& [q, value] : quantiles) {
+            const int64_t rank = std::max<int64_t>(1, static_cast<int64_t>(std::ceil(q * static_cast<double>(count))));
+            EXPECT_EQ(value, queryInt(db, "SELECT " + name + " FROM " + table + where + " ORDER BY " + name +
+                                              " LIMIT 1 OFFSET " + std::to_string(rank - 1)))
+                << "q=" << q;
+        }
+    }
+}
+
+} // namespace
+
+TEST(HistoryAggregateTest, KernelsAgree) {
+    std::mt19937 rng(3);
+    std::vector<int32_t> values(1000);
+    for (int32_t& v : values)
+        v = static_cast<int32_t>(rng());
+    values[17] = std::numeric_limits<int32_t>::min();
+    values[500] = std::numeric_limits<int32_t>::max();
+    // Every length up to a few vectors, so all tail lengths are covered.
+    for (size_t n : {0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 1000}) {
+        const aggregate::BlockStats scalar = aggregate::scanScalar(values.data(), n);
+        const aggregate::BlockStats simd =
+            aggregate::avx2Available() ? aggregate::scanAvx2(values.data(), n) : aggregate::scanScalar(values.data(), n);
+        EXPECT_EQ(simd.sum, scalar.sum) << n;
+        EXPECT_EQ(simd.min, scalar.min) << n;
+        EXPECT_EQ(simd.max, scalar.max) << n;
+    }
+    const aggregate::BlockStats all = aggregate::scanScalar(values.data(), values.size());
+    EXPECT_EQ(all.min, std::numeric_limits<int32_t>::min());
+    EXPECT_EQ(all.max, std::numeric_limits<int32_t>::max());
+}
+
+TEST(HistoryAggregateTest, MatchesSqliteForEveryThreadCountAndKernel) {
+    const std::string path = "/tmp/test_aggregate.db";
+    fillRandom(path, 20000);
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    // The whole table, then a window starting and ending between rows.
+    const std::pair<int64_t, int64_t> ranges[] = {{0, std::numeric_limits<int64_t>::max()}, {51005, 143333}};
+    for (const auto& [from_ms, to_ms] : ranges) {
+        for (size_t threads : {1, 3, 8}) {
+            for (bool simd : {true, false}) {
+                SCOPED_TRACE(::testing::Message() << from_ms << ".." << to_ms << " threads=" << threads << " simd=" << simd);
+                AggregateOptions options;
+                options.threads = threads;
+                options.simd = simd;
+                options.block_rows = 1000;
+                AggregateResult result;
+                ASSERT_TRUE(aggregateHistory(path, from_ms, to_ms, result, options));
+                EXPECT_EQ(result.threads, threads);
+                EXPECT_EQ(result.simd, simd && aggregate::avx2Available());
+                expectMatchesSqlite(db, "engine_values", from_ms, to_ms, result);
+            }
+        }
+    }
+    sqlite3_close(db);
+    std::filesystem::remove(path);
+}
+
+TEST(HistoryAggregateTest, PartitionDirectoriesAreSlicedPerPartition) {
+    const std::string dir = "/tmp/test_aggregate_partitions";
+    std::filesystem::remove_all(dir);
+    {
+        PartitionedStore store;
+        ASSERT_TRUE(store.open(dir, Partitioning::Hour));
+        for (int h = 0; h < 3; ++h)
+            for (int i = 0; i < 500; ++i)
+                ASSERT_TRUE(store.insert(kBaseMs + h * kHourMs + i * 1000, h * 1000 + i, 90 + i % 7, 40, i % 300));
+    }
+    const int64_t from_ms = kBaseMs + 100 * 1000;
+    const int64_t to_ms = kBaseMs + 2 * kHourMs + 50 * 1000;
+    AggregateOptions options;
+    options.threads = 4;
+    AggregateResult result;
+    ASSERT_TRUE(aggregateHistory(dir, from_ms, to_ms, result, options));
+    EXPECT_EQ(result.rows, 400u + 500u + 50u);
+    const SignalAggregate& rpm = result.signals[signals::rpm];
+    EXPECT_EQ(rpm.min, 100);
+    EXPECT_EQ(rpm.max, 2049);
+    EXPECT_EQ(result.signals[signals::temperature].min, 90);
+    EXPECT_EQ(result.signals[signals::temperature].max, 96);
+
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(":memory:", &db), SQLITE_OK);
+    ASSERT_EQ(PartitionedStore::attach(db, dir, from_ms, to_ms), 3);
+    expectMatchesSqlite(db, "engine_values_all", from_ms, to_ms, result);
+    sqlite3_close(db);
+    std::filesystem::remove_all(dir);
+}
+
+TEST(HistoryAggregateTest, EmptyRangeAndMissingDatabase) {
+    const std::string path = "/tmp/test_aggregate_empty.db";
+    fillRandom(path, 10);
+    AggregateResult result;
+    ASSERT_TRUE(aggregateHistory(path, 5000, 6000, result));
+    EXPECT_EQ(result.rows, 0u);
+    EXPECT_EQ(result.signals[signals::speed].count, 0u);
+    EXPECT_EQ(result.signals[signals::speed].max, 0);
+    std::filesystem::remove(path);
+
+    EXPECT_FALSE(aggregateHistory("/nonexistent/dir/engine.db", 0, 1000, result));
+}
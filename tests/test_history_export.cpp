@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <sqlite3.h>
+#include "Engine.h"
+#include "HistoryExport.h"
+#include "TestStorage.h"
+
+// Creates a database with the EngineImpl schema holding `rows` samples at
+// timestamps 1000, 1010, 1020, ... with rpm = row index.
+static void fillDatabase(const std::string& path, int rows) {
+    fillDatabase(path, static_cast<size_t>(rows), [](size_t i) {
+        const int n = static_cast<int>(i);
+        return StoredSample{0, 1000 + 10 * n, EngineSample{n, 90, 40, n % 300}, kAllSignals};
+    });
+}
+
+static std::string exportAll(const std::string& path, int64_t from, int64_t to, ExportFormat format, size_t chunk_rows) {
+    HistoryCursor cursor;
+    EXPECT_TRUE(cursor.open(path, from, to, format));
+    std::string out;
+    while (cursor.next(out, chunk_rows)) {
+    }
+    EXPECT_TRUE(cursor.done());
+    EXPECT_FALSE(cursor.failed());
+    return out;
+}
+
+TEST(HistoryExportTest, CsvRangeIsHalfOpenAndChunkingInvariant) {
+    const std::string path = "/tmp/test_export_csv.db";
+    fillDatabase(path, 100);
+    // Rows 10..19 have timestamps 1100..1190.
+    std::string csv = exportAll(path, 1100, 1200, ExportFormat::Csv, 3);
+    std::vector<std::string> lines;
+    size_t pos = 0;
+    while (pos < csv.size()) {
+        size_t nl = csv.find('\n', pos);
+        lines.push_back(csv.substr(pos, nl - pos));
+        pos = nl + 1;
+    }
+    ASSERT_EQ(lines.size(), 11u);
+    EXPECT_EQ(lines[0], "id,timestamp_ms,rpm,temperature,oil_pressure,speed");
+    EXPECT_EQ(lines[1], "11,1100,10,90,40,10");
+    EXPECT_EQ(lines[10], "20,1190,19,90,40,19");
+    EXPECT_EQ(csv, exportAll(path, 1100, 1200, ExportFormat::Csv, 1000));
+    std::filesystem::remove(path);
+}
+
+TEST(HistoryExportTest, BinaryColumnsRoundTrip) {
+    const std::string path = "/tmp/test_export_binary.db";
+    fillDatabase(path, 250);
+    std::string bin = exportAll(path, 0, std::numeric_limits<int64_t>::max(), ExportFormat::Binary, 100);
+    ASSERT_GE(bin.size(), 8u);
+    EXPECT_EQ(bin.substr(0, 4), "MWCB");
+    size_t offset = 8;
+    std::vector<int64_t> ids, timestamps;
+    std::vector<int32_t> rpm, speed;
+    int blocks = 0;
+    for (;;) {
+        uint32_t rows;
+        ASSERT_LE(offset + 4, bin.size());
+        std::memcpy(&rows, bin.data() + offset, 4);
+        offset += 4;
+        if (rows == 0)
+            break;
+        ++blocks;
+        auto read64 = [&](std::vector<int64_t>& out) {
+            for (uint32_t i = 0; i < rows; ++i) {
+                int64_t v;
+                std::memcpy(&v, bin.data() + offset + 8 * i, 8);
+                out.push_back(v);
+            }
+            offset += 8 * rows;
+        };
+        auto read32 = [&](std::vector<int32_t>* out) {
+            for (uint32_t i = 0; out && i < rows; ++i) {
+                int32_t v;
+                std::memcpy(&v, bin.data() + offset + 4 * i, 4);
+                out->push_back(v);
+            }
+            offset += 4 * rows;
+        };
+        read64(ids);
+        read64(timestamps);
+        read32(&rpm);
+        read32(nullptr);
+        read32(nullptr);
+        read32(&speed);
+    }
+    EXPECT_EQ(offset, bin.size());
+    EXPECT_EQ(blocks, 3);
+    ASSERT_EQ(rpm.size(), 250u);
+    EXPECT_EQ(ids[249], 250);
+    EXPECT_EQ(timestamps[42], 1420);
+    EXPECT_EQ(rpm[249], 249);
+    EXPECT_EQ(speed[249], 249);
+    std::filesystem::remove(path);
+}
+
+TEST(HistoryExportTest, ChunksStayBoundedAndWriterIsNotBlocked) {
+    const std::string path = "/tmp/test_export_bounded.db";
+    fillDatabase(path, 5000);
+    EngineImpl writer(path);
+    HistoryCursor cursor;
+    ASSERT_TRUE(cursor.open(path, 0, 1000 + 10 * 5000, ExportFormat::Csv));
+    std::string chunk;
+    size_t largest = 0;
+    int chunks = 0;
+    for (;;) {
+        chunk.clear();
+        if (!cursor.next(chunk, 256))
+            break;
+        largest = std::max(largest, chunk.size());
+        // The live writer keeps inserting between (and during) export chunks.
+        writer.storeCurrentValues(1, 2, 3, 4);
+        ++chunks;
+    }
+    EXPECT_EQ(cursor.rowsExported(), 5000u);
+    EXPECT_LT(largest, 256u * 64);
+    EXPECT_EQ(queryInt(path, "SELECT COUNT(*) FROM engine_values;"), 5000 + chunks);
+    std::filesystem::remove(path);
+}
+
+TEST(HistoryExportTest, MissingDatabaseFailsToOpen) {
+    HistoryCursor cursor;
+    EXPECT_FALSE(cursor.open("/nonexistent/dir/engine.db"));
+    std::string out;
+    EXPECT_FALSE(cursor.next(out));
+}
+
+TEST(HistoryExportTest, UnsampledSignalsAreEmptyInCsvAndRepeatedInBinary) {
+    const std::string path = "/tmp/test_export_sparse.db";
+    fillDatabase(path, 2, [](size_t i) {
+        return i == 0 ? StoredSample{0, 1, EngineSample{1000, 90, 40, 50}, kAllSignals}
+                      : StoredSample{0, 2, EngineSample{1100, 0, 0, 0}, 1u << signals::rpm};
+    });
+
+    std::string csv = exportAll(path, 0, 100, ExportFormat::Csv, 10);
+    EXPECT_NE(csv.find("\n2,2,1100,,,\n"), std::string::npos);
+
+    std::string bin = exportAll(path, 0, 100, ExportFormat::Binary, 10);
+    // Header, row count, 2 ids, 2 timestamps, then the temperature column at 8+4+32+8.
+    ASSERT_GE(bin.size(), 60u);
+    int32_t temperature[2];
+    std::memcpy(temperature, bin.data() + 8 + 4 + 32 + 8, sizeof(temperature));
+    EXPECT_EQ(temperature[0], 90);
+    EXPECT_EQ(temperature[1], 90);
+    std::filesystem::remove(path);
+}
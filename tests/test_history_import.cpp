@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <sqlite3.h>
+#include "Engine.h"
+#include "HistoryExport.h"
+#include "HistoryImport.h"
+#include "TestStorage.h"
+
+TEST(HistoryImportTest, CsvColumnsAreMappedByHeader) {
+    const std::string db_path = "/tmp/test_import_csv.db";
+    const std::string csv_path = "/tmp/test_import.csv";
+    std::filesystem::remove(db_path);
+    {
+        std::ofstream csv(csv_path);
+        csv << "speed,rpm,source,timestamp,oil_pressure,temperature\n"
+            << "100,3000,a,5000,40,90\n"
+            << "not,a,valid,row,at,all\n"
+            << "110,3100,b,5010,41,91\r\n"
+            << "\n"
+            << "120,3200,c,5020,42,92";
+    }
+    ImportStats stats;
+    ASSERT_TRUE(importHistory(db_path, csv_path, stats));
+    EXPECT_EQ(stats.rows, 3u);
+    EXPECT_EQ(stats.skipped, 1u);
+    EXPECT_EQ(queryInt(db_path, "SELECT COUNT(*) FROM engine_values;"), 3);
+    EXPECT_EQ(queryInt(db_path, "SELECT rpm FROM engine_values WHERE timestamp = 5010;"), 3100);
+    EXPECT_EQ(queryInt(db_path, "SELECT speed FROM engine_values WHERE timestamp = 5020;"), 120);
+    EXPECT_EQ(queryInt(db_path, "SELECT SUM(temperature) FROM engine_values;"), 273);
+    std::filesystem::remove(db_path);
+    std::filesystem::remove(csv_path);
+}
+
+TEST(HistoryImportTest, EmptyCsvSignalFieldsAreStoredAsNull) {
+    const std::string db_path = "/tmp/test_import_sparse.db";
+    const std::string csv_path = "/tmp/test_import_sparse.csv";
+    std::filesystem::remove(db_path);
+    {
+        std::ofstream csv(csv_path);
+        csv << "id,timestamp_ms,rpm,temperature,oil_pressure,speed\n"
+            << "1,5000,3000,90,40,100\n"
+            << "2,5001,3100,,,\n";
+    }
+    ImportStats stats;
+    ASSERT_TRUE(importHistory(db_path, csv_path, stats));
+    EXPECT_EQ(stats.rows, 2u);
+    EXPECT_EQ(queryInt(db_path, "SELECT COUNT(*) FROM engine_values WHERE temperature IS NULL AND speed IS NULL;"), 1);
+    EXPECT_EQ(queryInt(db_path, "SELECT rpm FROM engine_values WHERE timestamp = 5001;"), 3100);
+    std::filesystem::remove(db_path);
+    std::filesystem::remove(csv_path);
+}
+
+TEST(HistoryImportTest, CsvHeaderMissingColumnsIsRejected) {
+    const std::string db_path = "/tmp/test_import_badheader.db";
+    const std::string csv_path = "/tmp/test_import_badheader.csv";
+    std::filesystem::remove(db_path);
+    {
+        std::ofstream csv(csv_path);
+        csv << "rpm,speed\n1,2\n";
+    }
+    ImportStats stats;
+    EXPECT_FALSE(importHistory(db_path, csv_path, stats));
+    EXPECT_EQ(stats.rows, 0u);
+    std::filesystem::remove(db_path);
+    std::filesystem::remove(csv_path);
+}
+
+TEST(HistoryImportTest, ExportImportRoundTripInBothFormats) {
+    const std::string source = "/tmp/test_import_source.db";
+    std::filesystem::remove(source);
+    {
+        EngineImpl engine(source);
+        for (int i = 0; i < 300; ++i)
+            engine.storeCurrentValues(i, i % 100, i % 50, i % 200);
+    }
+    const int64_t sum = queryInt(source, "SELECT SUM(rpm + temperature + oil_pressure + speed) FROM engine_values;");
+    for (ExportFormat format : {ExportFormat::Csv, ExportFormat::Binary}) {
+        const std::string file = "/tmp/test_import_roundtrip.out";
+        const std::string target = "/tmp/test_import_target.db";
+        std::filesystem::remove(target);
+        {
+            HistoryCursor cursor;
+            ASSERT_TRUE(cursor.open(source, 0, std::numeric_limits<int64_t>::max(), format));
+            std::ofstream out(file, std::ios::binary);
+            std::string chunk;
+            while (cursor.next(chunk, 64)) {
+                out << chunk;
+                chunk.clear();
+            }
+        }
+        ImportStats stats;
+        ImportOptions options;
+        options.chunk_rows = 100;
+        ASSERT_TRUE(importHistory(target, file, stats, options));
+        EXPECT_EQ(stats.rows, 300u);
+        EXPECT_EQ(queryInt(target, "SELECT COUNT(*) FROM engine_values;"), 300);
+        EXPECT_EQ(queryInt(target, "SELECT SUM(rpm + temperature + oil_pressure + speed) FROM engine_values;"), sum);
+        std::filesystem::remove(target);
+        std::filesystem::remove(file);
+    }
+    std::filesystem::remove(source);
+}
+
+TEST(HistoryImportTest, SecondaryIndexesAreRebuiltAfterLoad) {
+    const std::string db_path = "/tmp/test_import_index.db";
+    const std::string csv_path = "/tmp/test_import_index.csv";
+    std::filesystem::remove(db_path);
+    { EngineImpl engine(db_path); }
+    sqlite3* db = nullptr;
+    sqlite3_open(db_path.c_str(), &db);
+    sqlite3_exec(db, "CREATE INDEX idx_engine_values_timestamp ON engine_values(timestamp);", nullptr, nullptr, nullptr);
+    sqlite3_close(db);
+    {
+        std::ofstream csv(csv_path);
+        csv << "timestamp_ms,rpm,temperature,oil_pressure,speed\n";
+        for (int i = 0; i < 1000; ++i)
+            csv << 1000 + i << ",1,2,3,4\n";
+    }
+    ImportStats stats;
+    ASSERT_TRUE(importHistory(db_path, csv_path, stats));
+    EXPECT_EQ(stats.rows, 1000u);
+    EXPECT_EQ(queryInt(db_path, "SELECT COUNT(*) FROM sqlite_master WHERE name = 'idx_engine_values_timestamp';"), 1);
+    EXPECT_EQ(queryInt(db_path, "SELECT COUNT(*) FROM engine_values INDEXED BY idx_engine_values_timestamp WHERE timestamp >= 1500;"), 500);
+    std::filesystem::remove(db_path);
+    std::filesystem::remove(csv_path);
+}
+
+TEST(HistoryImportTest, MissingFileFails) {
+    ImportStats stats;
+    EXPECT_FALSE(importHistory("/tmp/test_import_missing.db", "/nonexistent/history.csv", stats));
+}
+
+TEST(HistoryImportTest, DatabaseInUseOrPartitionedIsRefused) {
+    const std::string db_path = "/tmp/test_import_in_use.db";
+    const std::string csv_path = "/tmp/test_import_in_use.csv";
+    std::filesystem::remove(db_path);
+    {
+        std::ofstream csv(csv_path);
+        csv << "timestamp_ms,rpm,temperature,oil_pressure,speed\n1000,1,2,3,4\n";
+    }
+    ImportStats stats;
+    {
+        // As the server holds it while storing.
+        StorageConfig storage;
+        storage.path = db_path;
+        EngineImpl engine(storage);
+        EXPECT_FALSE(importHistory(db_path, csv_path, stats));
+        EXPECT_EQ(queryInt(db_path, "SELECT COUNT(*) FROM engine_values;"), 0);
+    }
+    EXPECT_TRUE(importHistory(db_path, csv_path, stats));
+    EXPECT_EQ(queryInt(db_path, "SELECT COUNT(*) FROM engine_values;"), 1);
+
+    const std::string dir = "/tmp/test_import_partitions";
+    std::filesystem::create_directories(dir);
+    EXPECT_FALSE(importHistory(dir, csv_path, stats));
+    std::filesystem::remove_all(dir);
+    std::filesystem::remove(db_path);
+    std::filesystem::remove(db_path + "-lock");
+    std::filesystem::remove(csv_path);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include "HttpGateway.h"
+#include "TestDoubles.h"
+
+TEST(HttpGatewayTest, WebSocketAcceptMatchesRfcExample) {
+    // RFC 6455 section 1.3.
+    EXPECT_EQ(http::websocketAccept("dGhlIHNhbXBsZSBub25jZQ=="), "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=");
+}
+
+TEST(HttpGatewayTest, ParsesRequestHeads) {
+    const std::string request = "GET /latest?pretty=1 HTTP/1.1\r\nHost: engine\r\nAccept: */*\r\n\r\nGET /next";
+    http::RequestHead head;
+    ASSERT_EQ(http::parseRequestHead(request, head), http::ParseStatus::Ok);
+    EXPECT_EQ(head.method, "GET");
+    EXPECT_EQ(head.path, "/latest");
+    EXPECT_EQ(head.length, request.find("GET /next"));
+    EXPECT_TRUE(head.keep_alive);
+    EXPECT_FALSE(head.upgrade_websocket);
+    EXPECT_FALSE(head.has_body);
+
+    ASSERT_EQ(http::parseRequestHead("GET / HTTP/1.1\r\nConnection: close\r\n\r\n", head), http::ParseStatus::Ok);
+    EXPECT_FALSE(head.keep_alive);
+    ASSERT_EQ(http::parseRequestHead("GET / HTTP/1.0\r\n\r\n", head), http::ParseStatus::Ok);
+    EXPECT_FALSE(head.keep_alive);
+    ASSERT_EQ(http::parseRequestHead("GET / HTTP/1.0\r\nconnection: Keep-Alive\r\n\r\n", head), http::ParseStatus::Ok);
+    EXPECT_TRUE(head.keep_alive);
+    ASSERT_EQ(http::parseRequestHead("POST / HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello", head), http::ParseStatus::Ok);
+    EXPECT_TRUE(head.has_body);
+}
+
+TEST(HttpGatewayTest, ParsesWebSocketHandshake) {
+    http::RequestHead head;
+    const std::string request =
+        "GET /stream HTTP/1.1\r\nHost: engine\r\nUpgrade: WebSocket\r\nConnection: keep-alive, Upgrade\r\n"
+        "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+    ASSERT_EQ(http::parseRequestHead(request, head), http::ParseStatus::Ok);
+    EXPECT_TRUE(head.upgrade_websocket);
+    EXPECT_EQ(head.websocket_key, "dGhlIHNhbXBsZSBub25jZQ==");
+    EXPECT_EQ(head.websocket_version, 13);
+
+    std::string response;
+    http::appendUpgradeResponse(response, head.websocket_key);
+    EXPECT_EQ(response.rfind("HTTP/1.1 101 Switching Protocols\r\n", 0), 0u);
+    EXPECT_NE(response.find("Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n"), std::string::npos);
+}
+
+TEST(HttpGatewayTest, IncompleteAndMalformedHeads) {
+    http::RequestHead head;
+    EXPECT_EQ(http::parseRequestHead("GET /latest HTTP/1.1\r\nHost: x\r\n", head), http::ParseStatus::Incomplete);
+    EXPECT_EQ(http::parseRequestHead("GET\r\n\r\n", head), http::ParseStatus::Malformed);
+    EXPECT_EQ(http::parseRequestHead("GET latest HTTP/1.1\r\n\r\n", head), http::ParseStatus::Malformed);
+    EXPECT_EQ(http::parseRequestHead("GET / HTTP/2\r\n\r\n", head), http::ParseStatus::Malformed);
+    EXPECT_EQ(http::parseRequestHead("GET / HTTP/1.1\r\nno colon\r\n\r\n", head), http::ParseStatus::Malformed);
+    EXPECT_EQ(http::parseRequestHead("GET / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n", head), http::ParseStatus::Malformed);
+}
+
+TEST(HttpGatewayTest, ResponsesCarryLengthAndConnection) {
+    std::string out;
+    http::appendResponse(out, 200, "application/json", "{}", true);
+    EXPECT_EQ(out.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+    EXPECT_NE(out.find("Content-Type: application/json\r\n"), std::string::npos);
+    EXPECT_NE(out.find("Content-Length: 2\r\n"), std::string::npos);
+    EXPECT_EQ(out.find("Connection: close"), std::string::npos);
+    EXPECT_EQ(out.substr(out.size() - 6), "\r\n\r\n{}");
+
+    out.clear();
+    http::appendResponse(out, 404, "text/plain", "", false);
+    EXPECT_EQ(out.rfind("HTTP/1.1 404 Not Found\r\n", 0), 0u);
+    EXPECT_NE(out.find("Connection: close\r\n"), std::string::npos);
+}
+
+TEST(HttpGatewayTest, SnapshotJson) {
+    EngineSnapshot snapshot;
+    snapshot.values = {1200, 90, -3, 80};
+    snapshot.sequence = 42;
+    snapshot.timestamp_ms = 1700000000123;
+    snapshot.field_timestamp_ms = {1, 2, 3, 4};
+    std::string out;
+    http::appendSnapshotJson(out, snapshot, false);
+    EXPECT_EQ(out, "{\"sequence\":42,\"timestamp_ms\":1700000000123,\"rpm\":1200,\"temperature\":90,"
+                   "\"oil_pressure\":-3,\"speed\":80}");
+    out.clear();
+    http::appendSnapshotJson(out, snapshot, true);
+    EXPECT_NE(out.find(",\"field_timestamp_ms\":[1,2,3,4]}"), std::string::npos);
+}
+
+TEST(HttpGatewayTest, ServerFramesUseTheShortestLength) {
+    std::string out;
+    http::appendWebSocketFrame(out, http::kText, "hi");
+    EXPECT_EQ(out, std::string("\x81\x02hi", 4));
+    out.clear();
+    http::appendWebSocketFrame(out, http::kText, std::string(300, 'a'));
+    ASSERT_EQ(out.size(), 4u + 300u);
+    EXPECT_EQ(static_cast<uint8_t>(out[1]), 126);
+    EXPECT_EQ((static_cast<uint8_t>(out[2]) << 8) | static_cast<uint8_t>(out[3]), 300);
+}
+
+TEST(HttpGatewayTest, ClientFramesAreUnmasked) {
+    std::string bytes =
+        webSocketClientFrame(http::kPing, "are you there") + webSocketClientFrame(http::kText, std::string(200, 'z'));
+    http::WebSocketFrame frame;
+    ASSERT_EQ(http::parseWebSocketFrame(bytes.data(), bytes.size(), 4096, frame), http::ParseStatus::Ok);
+    EXPECT_EQ(frame.opcode, http::kPing);
+    EXPECT_TRUE(frame.fin);
+    EXPECT_EQ(frame.payload, "are you there");
+    ASSERT_EQ(http::parseWebSocketFrame(bytes.data() + frame.length, bytes.size() - frame.length, 4096, frame),
+              http::ParseStatus::Ok);
+    EXPECT_EQ(frame.opcode, http::kText);
+    EXPECT_EQ(frame.payload, std::string(200, 'z'));
+
+    // Every prefix of a frame is incomplete.
+    std::string close = webSocketClientFrame(http::kClose, "\x03\xe8");
+    for (size_t size = 0; size < close.size(); ++size)
+        EXPECT_EQ(http::parseWebSocketFrame(close.data(), size, 4096, frame), http::ParseStatus::Incomplete);
+}
+
+TEST(HttpGatewayTest, InvalidClientFramesAreRejected) {
+    http::WebSocketFrame frame;
+    std::string unmasked = "\x81\x02hi";
+    EXPECT_EQ(http::parseWebSocketFrame(unmasked.data(), unmasked.size(), 4096, frame), http::ParseStatus::Malformed);
+    std::string big_ping = webSocketClientFrame(http::kPing, std::string(126, 'p'));
+    EXPECT_EQ(http::parseWebSocketFrame(big_ping.data(), big_ping.size(), 4096, frame), http::ParseStatus::Malformed);
+    std::string fragmented_close = webSocketClientFrame(http::kClose, "", false);
+    EXPECT_EQ(http::parseWebSocketFrame(fragmented_close.data(), fragmented_close.size(), 4096, frame),
+              http::ParseStatus::Malformed);
+    std::string too_long = webSocketClientFrame(http::kBinary, std::string(300, 'b'));
+    EXPECT_EQ(http::parseWebSocketFrame(too_long.data(), too_long.size(), 256, frame), http::ParseStatus::Malformed);
+    std::string reserved_opcode = webSocketClientFrame(0x3, "");
+    EXPECT_EQ(http::parseWebSocketFrame(reserved_opcode.data(), reserved_opcode.size(), 4096, frame),
+              http::ParseStatus::Malformed);
+}
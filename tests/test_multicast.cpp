@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "MulticastPublisher.hpp"
+#include "Server.hpp"
+#include "TestDoubles.h"
+
+static EngineSnapshot makeSnapshot(uint64_t sequence) {
+    EngineSnapshot s;
+    s.values = {static_cast<int>(1000 + sequence), 90, 40, 100};
+    s.sequence = sequence;
+    s.timestamp_ms = 1700000000000 + static_cast<int64_t>(sequence);
+    return s;
+}
+
+TEST(MulticastPublisherTest, RejectsNonMulticastGroup) {
+    InMemoryTransport transport;
+    MulticastPublisher<InMemoryTransport> publisher(transport);
+    EXPECT_FALSE(publisher.open("10.0.0.1", 5556, "", 1, true));
+    EXPECT_FALSE(publisher.open("not-an-address", 5556, "", 1, true));
+    EXPECT_FALSE(publisher.open("239.255.0.1", 5556, "bad-interface", 1, true));
+    EXPECT_FALSE(publisher.isOpen());
+    EXPECT_TRUE(transport.socketsCreated().empty());
+}
+
+TEST(MulticastPublisherTest, PublishBeforeOpenIsNoop) {
+    InMemoryTransport transport;
+    MulticastPublisher<InMemoryTransport> publisher(transport);
+    publisher.publish(makeSnapshot(1));
+    EXPECT_TRUE(transport.datagrams().empty());
+}
+
+TEST(MulticastPublisherTest, SendsOneDatagramPerSnapshot) {
+    InMemoryTransport transport;
+    MulticastPublisher<InMemoryTransport> publisher(transport);
+    ASSERT_TRUE(publisher.open("239.255.0.1", 5556, "127.0.0.1", 1, true));
+    auto sockets = transport.socketsCreated();
+    ASSERT_EQ(sockets.size(), 1u);
+    EXPECT_EQ(sockets[0], std::make_pair(AF_INET, static_cast<int>(SOCK_DGRAM)));
+
+    for (uint64_t seq = 1; seq <= 3; ++seq)
+        publisher.publish(makeSnapshot(seq));
+    auto datagrams = transport.datagrams();
+    ASSERT_EQ(datagrams.size(), 3u);
+    for (uint64_t i = 0; i < 3; ++i) {
+        EngineData msg;
+        ASSERT_TRUE(msg.ParseFromString(datagrams[i]));
+        EXPECT_EQ(msg.sequence(), i + 1);
+        EXPECT_EQ(msg.timestamp_ms(), 1700000000000 + static_cast<int64_t>(i + 1));
+        EXPECT_EQ(msg.rpm(), static_cast<int>(1001 + i));
+        EXPECT_EQ(msg.speed(), 100);
+    }
+    publisher.close();
+    EXPECT_FALSE(publisher.isOpen());
+}
+
+TEST(MulticastPublisherTest, ServerPublishesConsecutiveSequences) {
+    ServerConfig config;
+    config.multicast.enabled = true;
+    config.multicast.interface_address = "127.0.0.1";
+    BasicServer<FakeEngine, InMemoryTransport> server(config);
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.transport().datagrams().size() >= 5; }));
+    server.stop();
+
+    uint64_t previous = 0;
+    for (const std::string& datagram : server.transport().datagrams()) {
+        EngineData msg;
+        ASSERT_TRUE(msg.ParseFromString(datagram));
+        EXPECT_EQ(msg.rpm(), 1200);
+        EXPECT_EQ(msg.sequence(), previous + 1);
+        previous = msg.sequence();
+    }
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <sqlite3.h>
+#include "Engine.h"
+#include "HistoryExport.h"
+#include "PartitionedStore.h"
+
+namespace {
+
+constexpr int64_t kHourMs = 3600 * 1000;
+// 2024-01-01T00:00:00Z
+constexpr int64_t kBaseMs = 1704067200000LL;
+
+std::string freshDirectory(const std::string& name) {
+    const std::string dir = "/tmp/" + name;
+    std::filesystem::remove_all(dir);
+    return dir;
+}
+
+// Writes `per_hour` samples into each of `hours` consecutive hours starting at kBaseMs.
+void fillHours(PartitionedStore& store, int hours, int per_hour) {
+    for (int h = 0; h < hours; ++h)
+        for (int i = 0; i < per_hour; ++i)
+            ASSERT_TRUE(store.insert(kBaseMs + h * kHourMs + i * 1000, h * 100 + i, 90, 40, 50));
+}
+
+int64_t countRows(sqlite3* db, const std::string& sql) {
+    sqlite3_stmt* stmt = nullptr;
+    EXPECT_EQ(sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr), SQLITE_OK);
+    int64_t count = -1;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+        count = sqlite3_column_int64(stmt, 0);
+    sqlite3_finalize(stmt);
+    return count;
+}
+
+} // namespace
+
+TEST(PartitionedStoreTest, RollsOverIntoOneFilePerHour) {
+    const std::string dir = freshDirectory("test_partitions_hourly");
+    PartitionedStore store;
+    ASSERT_TRUE(store.open(dir, Partitioning::Hour));
+    fillHours(store, 3, 5);
+    EXPECT_EQ(std::filesystem::path(store.livePath()).filename(), "engine_values_2024010102.db");
+
+    const auto partitions = PartitionedStore::list(dir);
+    ASSERT_EQ(partitions.size(), 3u);
+    for (int h = 0; h < 3; ++h) {
+        EXPECT_EQ(partitions[h].start_ms, kBaseMs + h * kHourMs);
+        EXPECT_EQ(partitions[h].end_ms, kBaseMs + (h + 1) * kHourMs);
+    }
+    EXPECT_EQ(std::filesystem::path(partitions[0].path).filename(), "engine_values_2024010100.db");
+    store.close();
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PartitionedStoreTest, DropBeforeUnlinksWholePartitionsButNotTheLiveOne) {
+    const std::string dir = freshDirectory("test_partitions_retention");
+    PartitionedStore store;
+    ASSERT_TRUE(store.open(dir, Partitioning::Hour));
+    fillHours(store, 4, 2);
+
+    // The first two hours end at or before the cutoff; the third only partly.
+    EXPECT_EQ(store.dropBefore(kBaseMs + 2 * kHourMs + 1), 2u);
+    auto partitions = PartitionedStore::list(dir);
+    ASSERT_EQ(partitions.size(), 2u);
+    EXPECT_EQ(partitions[0].start_ms, kBaseMs + 2 * kHourMs);
+    EXPECT_FALSE(std::filesystem::exists(dir + "/engine_values_2024010100.db-wal"));
+
+    // A cutoff past everything still keeps the partition being written.
+    EXPECT_EQ(store.dropBefore(kBaseMs + 100 * kHourMs), 1u);
+    partitions = PartitionedStore::list(dir);
+    ASSERT_EQ(partitions.size(), 1u);
+    EXPECT_EQ(partitions[0].path, store.livePath());
+    EXPECT_TRUE(store.insert(kBaseMs + 3 * kHourMs + 5000, 1, 2, 3, 4));
+    store.close();
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PartitionedStoreTest, CursorSpansOnlyOverlappingPartitions) {
+    const std::string dir = freshDirectory("test_partitions_export");
+    {
+        PartitionedStore store;
+        ASSERT_TRUE(store.open(dir, Partitioning::Hour));
+        fillHours(store, 3, 4);
+    }
+    // From the last two samples of hour 0 up to, but excluding, hour 2.
+    HistoryCursor cursor;
+    ASSERT_TRUE(cursor.open(dir, kBaseMs + 2000, kBaseMs + 2 * kHourMs, ExportFormat::Csv));
+    std::string csv;
+    while (cursor.next(csv, 3)) {
+    }
+    EXPECT_TRUE(cursor.done());
+    EXPECT_FALSE(cursor.failed());
+    EXPECT_EQ(cursor.rowsExported(), 6u);
+    EXPECT_NE(csv.find(",2,90,40,50\n"), std::string::npos);
+    EXPECT_NE(csv.find(",103,90,40,50\n"), std::string::npos);
+    EXPECT_EQ(csv.find(",200,90,40,50\n"), std::string::npos);
+
+    // A range without partitions is an empty, successful export.
+    std::string empty;
+    ASSERT_TRUE(cursor.open(dir, 0, 1000, ExportFormat::Csv));
+    while (cursor.next(empty)) {
+    }
+    EXPECT_EQ(empty, "id,timestamp_ms,rpm,temperature,oil_pressure,speed\n");
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PartitionedStoreTest, AttachCombinesPartitionsInOneView) {
+    const std::string dir = freshDirectory("test_partitions_attach");
+    {
+        PartitionedStore store;
+        ASSERT_TRUE(store.open(dir, Partitioning::Hour));
+        fillHours(store, 3, 4);
+    }
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(":memory:", &db), SQLITE_OK);
+    EXPECT_EQ(PartitionedStore::attach(db, dir, kBaseMs + kHourMs, kBaseMs + 3 * kHourMs), 2);
+    EXPECT_EQ(countRows(db, "SELECT COUNT(*) FROM engine_values_all;"), 8);
+    EXPECT_EQ(countRows(db, "SELECT MIN(rpm) FROM engine_values_all;"), 100);
+    sqlite3_close(db);
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PartitionedStoreTest, EngineWritesDailyPartitions) {
+    const std::string dir = freshDirectory("test_partitions_engine");
+    StorageConfig config;
+    config.path = dir;
+    config.partitioning = Partitioning::Day;
+    {
+        EngineImpl engine(config);
+        engine.storeCurrentValues(1000, 90, 40, 50);
+        engine.storeAlertEvent("hot", true, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::system_clock::now().time_since_epoch()).count(), EngineSample{});
+    }
+    EXPECT_FALSE(std::filesystem::exists(dir + "/engine_data.db"));
+    const auto partitions = PartitionedStore::list(dir);
+    ASSERT_EQ(partitions.size(), 1u);
+    EXPECT_EQ(partitions[0].end_ms - partitions[0].start_ms, 24 * kHourMs);
+
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(partitions[0].path.c_str(), &db), SQLITE_OK);
+    EXPECT_EQ(countRows(db, "SELECT COUNT(*) FROM engine_values WHERE rpm = 1000;"), 1);
+    EXPECT_EQ(countRows(db, "SELECT COUNT(*) FROM alert_events WHERE rule = 'hot';"), 1);
+    sqlite3_close(db);
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PartitionedStoreTest, EngineAppliesRetentionWhenAPartitionStarts) {
+    const std::string dir = freshDirectory("test_partitions_engine_retention");
+    StorageConfig config;
+    config.path = dir;
+    config.partitioning = Partitioning::Hour;
+    config.retention_ms = 2 * kHourMs;
+    {
+        EngineImpl engine(config);
+        for (int h = 0; h < 5; ++h) {
+            for (int i = 0; i < 3; ++i) {
+                EngineSnapshot snapshot;
+                snapshot.values = EngineSample{h * 100 + i, 90, 40, 50};
+                snapshot.timestamp_ms = kBaseMs + h * kHourMs + i * 1000;
+                engine.storeSample(snapshot);
+            }
+        }
+    }
+    // Starting hour 4 dropped the partitions that ended 2 hours before it.
+    const auto partitions = PartitionedStore::list(dir);
+    ASSERT_EQ(partitions.size(), 3u);
+    EXPECT_EQ(partitions.front().start_ms, kBaseMs + 2 * kHourMs);
+    std::filesystem::remove_all(dir);
+}
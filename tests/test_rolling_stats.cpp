@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "RollingStats.h"
+
+static EngineSample uniform(int v) {
+    return EngineSample{v, v, v, v};
+}
+
+TEST(RollingStatsTest, EmptyWindowHasZeroCount) {
+    RollingWindow window(1000);
+    WindowSummary s = window.summary();
+    EXPECT_EQ(s.window_ms, 1000);
+    EXPECT_EQ(s.count, 0u);
+}
+
+TEST(RollingStatsTest, MeanMinMaxOverWindow) {
+    RollingWindow window(1000);
+    window.add(0, uniform(10));
+    window.add(100, uniform(30));
+    window.add(200, uniform(20));
+    WindowSummary s = window.summary();
+    ASSERT_EQ(s.count, 3u);
+    EXPECT_DOUBLE_EQ(s.signals[0].mean, 20.0);
+    EXPECT_EQ(s.signals[0].min, 10);
+    EXPECT_EQ(s.signals[0].max, 30);
+}
+
+TEST(RollingStatsTest, OldSamplesAreEvicted) {
+    RollingWindow window(1000);
+    window.add(0, uniform(100));   // evicted once t >= 1000
+    window.add(500, uniform(5));
+    window.add(1000, uniform(7));
+    WindowSummary s = window.summary();
+    ASSERT_EQ(s.count, 2u);
+    EXPECT_EQ(s.signals[1].max, 7);
+    EXPECT_EQ(s.signals[1].min, 5);
+    EXPECT_DOUBLE_EQ(s.signals[1].mean, 6.0);
+}
+
+TEST(RollingStatsTest, RateOfChangePerSecond) {
+    RollingWindow window(10000);
+    window.add(0, EngineSample{1000, 20, 50, 0});
+    window.add(2000, EngineSample{3000, 30, 40, 100});
+    WindowSummary s = window.summary();
+    EXPECT_DOUBLE_EQ(s.signals[0].rate_per_s, 1000.0);
+    EXPECT_DOUBLE_EQ(s.signals[1].rate_per_s, 5.0);
+    EXPECT_DOUBLE_EQ(s.signals[2].rate_per_s, -5.0);
+    EXPECT_DOUBLE_EQ(s.signals[3].rate_per_s, 50.0);
+}
+
+TEST(RollingStatsTest, EwmaMovesTowardsNewValues) {
+    RollingWindow window(1000);
+    window.add(0, uniform(0));
+    EXPECT_DOUBLE_EQ(window.summary().signals[2].ewma, 0.0);
+    window.add(1000, uniform(100));
+    // alpha = 1 - e^-1 for a step of one time constant.
+    EXPECT_NEAR(window.summary().signals[2].ewma, 100.0 * (1.0 - std::exp(-1.0)), 1e-9);
+}
+
+// Checks min/max/mean/quantiles against a brute-force recomputation over random data.
+TEST(RollingStatsTest, MatchesBruteForceReference) {
+    RollingWindow window(500);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> rpm(0, 8000);
+    std::vector<std::pair<int64_t, int>> history;
+    for (int64_t t = 0; t < 5000; t += 7) {
+        int v = rpm(rng);
+        window.add(t, EngineSample{v, 0, 0, 0});
+        history.emplace_back(t, v);
+
+        std::vector<int> in_window;
+        for (auto& [ts, value] : history)
+            if (ts > t - 500)
+                in_window.push_back(value);
+        WindowSummary s = window.summary();
+        ASSERT_EQ(s.count, in_window.size());
+        std::sort(in_window.begin(), in_window.end());
+        EXPECT_EQ(s.signals[0].min, in_window.front());
+        EXPECT_EQ(s.signals[0].max, in_window.back());
+        double sum = 0;
+        for (int v2 : in_window)
+            sum += v2;
+        EXPECT_NEAR(s.signals[0].mean, sum / in_window.size(), 1e-6);
+        // Histogram quantiles are approximate: within one bin of the order statistics
+        // around the requested rank.
+        const double bin = 8000.0 / RollingWindow::kHistogramBins;
+        for (auto [q, value] : {std::pair{0.5, s.signals[0].p50}, std::pair{0.9, s.signals[0].p90}}) {
+            const size_t rank = static_cast<size_t>(q * in_window.size());
+            const int below = in_window[rank == 0 ? 0 : rank - 1];
+            const int above = in_window[std::min(rank, in_window.size() - 1)];
+            EXPECT_GE(value, below - bin);
+            EXPECT_LE(value, above + bin);
+        }
+    }
+}
+
+TEST(RollingStatsTest, QuantilesOfConstantSignalAreExact) {
+    RollingWindow window(1000);
+    for (int t = 0; t < 100; ++t)
+        window.add(t, uniform(42));
+    SignalSummary s = window.summary().signals[0];
+    EXPECT_DOUBLE_EQ(s.p50, 42.0);
+    EXPECT_DOUBLE_EQ(s.p90, 42.0);
+    EXPECT_DOUBLE_EQ(s.p99, 42.0);
+}
+
+TEST(RollingStatsTest, StatsSetKeepsOneSummaryPerWindow) {
+    RollingStats stats({1000, 10000, 0, -5});
+    ASSERT_FALSE(stats.empty());
+    stats.add(0, uniform(1));
+    stats.add(5000, uniform(3));
+    auto summary = stats.summary();
+    ASSERT_EQ(summary.size(), 2u);
+    EXPECT_EQ(summary[0].window_ms, 1000);
+    EXPECT_EQ(summary[0].count, 1u);
+    EXPECT_EQ(summary[1].window_ms, 10000);
+    EXPECT_EQ(summary[1].count, 2u);
+    EXPECT_TRUE(RollingStats({}).empty());
+}
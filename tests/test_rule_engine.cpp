@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "RuleEngine.h"
+
+// A snapshot in which the signals in `fresh` were sampled at timestamp_ms and the
+// others at `stale_ms`.
+static EngineSnapshot snapshotAt(int64_t timestamp_ms, EngineSample values, uint8_t fresh = kAllSignals,
+                                 int64_t stale_ms = 0) {
+    static uint64_t sequence = 0;
+    EngineSnapshot snapshot{values, ++sequence, timestamp_ms, fresh};
+    for (size_t i = 0; i < kSignalCount; ++i)
+        snapshot.field_timestamp_ms[i] = fresh & (1u << i) ? timestamp_ms : stale_ms;
+    return snapshot;
+}
+
+TEST(RuleEngineTest, RejectsMalformedRules) {
+    RuleEngine engine;
+    std::string error;
+    EXPECT_FALSE(engine.addRule("rpm > 4000", &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(engine.addRule("x: torque > 10", &error));
+    EXPECT_NE(error.find("torque"), std::string::npos);
+    EXPECT_FALSE(engine.addRule("x: rpm > ", &error));
+    EXPECT_FALSE(engine.addRule("x: (rpm > 1", &error));
+    EXPECT_FALSE(engine.addRule("x: rpm > 1 for 5 minutes", &error));
+    EXPECT_FALSE(engine.addRule("x: rate(42) > 1", &error));
+    EXPECT_FALSE(engine.addRule("x: rpm > 1 $", &error));
+    EXPECT_EQ(engine.size(), 0u);
+}
+
+TEST(RuleEngineTest, RejectsExpressionsDeeperThanStack) {
+    RuleEngine engine;
+    std::string text = "deep: ";
+    for (size_t i = 0; i < RuleEngine::kMaxStackDepth; ++i)
+        text += "1 + (";
+    text += "1";
+    for (size_t i = 0; i < RuleEngine::kMaxStackDepth; ++i)
+        text += ")";
+    std::string error;
+    EXPECT_FALSE(engine.addRule(text + " > 0", &error));
+    EXPECT_EQ(engine.size(), 0u);
+}
+
+TEST(RuleEngineTest, ThresholdRaisesAndClears) {
+    RuleEngine engine;
+    ASSERT_TRUE(engine.addRule("hot: temperature >= 120"));
+    std::vector<AlertEvent> events;
+    engine.evaluate(snapshotAt(0, {1000, 100, 50, 10}), events);
+    EXPECT_TRUE(events.empty());
+    engine.evaluate(snapshotAt(100, {1000, 120, 50, 10}), events);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].rule, "hot");
+    EXPECT_TRUE(events[0].raised);
+    EXPECT_EQ(events[0].timestamp_ms, 100);
+    EXPECT_EQ(events[0].values.temperature, 120);
+    // Still holding: no repeated event.
+    engine.evaluate(snapshotAt(200, {1000, 130, 50, 10}), events);
+    EXPECT_EQ(events.size(), 1u);
+    engine.evaluate(snapshotAt(300, {1000, 90, 50, 10}), events);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_FALSE(events[1].raised);
+}
+
+TEST(RuleEngineTest, CombinedConditionMustHoldForDuration) {
+    RuleEngine engine;
+    ASSERT_TRUE(engine.addRule("low_oil_under_load: oil_pressure < 10 while rpm > 4000 for 500 ms"));
+    std::vector<AlertEvent> events;
+    engine.evaluate(snapshotAt(0, {5000, 90, 5, 100}), events);
+    engine.evaluate(snapshotAt(400, {5000, 90, 5, 100}), events);
+    EXPECT_TRUE(events.empty());
+    // Interrupted before the hold time: the timer restarts.
+    engine.evaluate(snapshotAt(450, {3000, 90, 5, 100}), events);
+    engine.evaluate(snapshotAt(500, {5000, 90, 5, 100}), events);
+    engine.evaluate(snapshotAt(900, {5000, 90, 5, 100}), events);
+    EXPECT_TRUE(events.empty());
+    engine.evaluate(snapshotAt(1000, {5000, 90, 5, 100}), events);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_TRUE(events[0].raised);
+    EXPECT_EQ(events[0].timestamp_ms, 1000);
+}
+
+TEST(RuleEngineTest, RateIsChangePerSecond) {
+    RuleEngine engine;
+    ASSERT_TRUE(engine.addRule("heating_fast: rate(temperature) > 5"));
+    std::vector<AlertEvent> events;
+    engine.evaluate(snapshotAt(0, {0, 100, 0, 0}), events);
+    engine.evaluate(snapshotAt(1000, {0, 104, 0, 0}), events);
+    EXPECT_TRUE(events.empty());
+    // +3 degrees in 200 ms = 15 degrees/s.
+    engine.evaluate(snapshotAt(1200, {0, 107, 0, 0}), events);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].rule, "heating_fast");
+}
+
+TEST(RuleEngineTest, RateOfSlowSignalSpansItsOwnSamples) {
+    RuleEngine engine;
+    ASSERT_TRUE(engine.addRule("heating_fast: rate(temperature) > 5"));
+    ASSERT_TRUE(engine.addRule("revving: rate(rpm) > 1000"));
+    constexpr uint8_t kRpmOnly = 1u << signals::rpm;
+    std::vector<AlertEvent> events;
+    // Temperature is sampled once a second, rpm every 100 ms.
+    engine.evaluate(snapshotAt(0, {1000, 100, 0, 0}), events);
+    for (int64_t t = 100; t < 1000; t += 100)
+        engine.evaluate(snapshotAt(t, {1000, 100, 0, 0}, kRpmOnly, 0), events);
+    // +4 degrees over the second since its last sample, not over the last 100 ms.
+    engine.evaluate(snapshotAt(1000, {1000, 104, 0, 0}), events);
+    EXPECT_TRUE(events.empty());
+    // Between temperature samples the last rate holds instead of dropping to 0.
+    engine.evaluate(snapshotAt(2000, {1000, 110, 0, 0}), events);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].rule, "heating_fast");
+    EXPECT_TRUE(events[0].raised);
+    for (int64_t t = 2100; t < 3000; t += 100)
+        engine.evaluate(snapshotAt(t, {1000, 110, 0, 0}, kRpmOnly, 2000), events);
+    EXPECT_EQ(events.size(), 1u);
+
+    // rpm keeps its own previous sample: +200 in 100 ms.
+    engine.evaluate(snapshotAt(3000, {1200, 111, 0, 0}, kRpmOnly, 2000), events);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[1].rule, "revving");
+}
+
+TEST(RuleEngineTest, ArithmeticPrecedenceAndKeywords) {
+    RuleEngine engine;
+    ASSERT_TRUE(engine.addRule("a: speed * 2 + 10 == 30"));
+    ASSERT_TRUE(engine.addRule("b: !(rpm > 100) and speed == 10"));
+    ASSERT_TRUE(engine.addRule("c: rpm > 100 or -speed < -5"));
+    ASSERT_TRUE(engine.addRule("d: speed / 0 == 0 && speed - 4 * 2 == 2"));
+    std::vector<AlertEvent> events;
+    engine.evaluate(snapshotAt(0, {50, 0, 0, 10}), events);
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_EQ(events[0].rule, "a");
+    EXPECT_EQ(events[1].rule, "b");
+    EXPECT_EQ(events[2].rule, "c");
+    EXPECT_EQ(events[3].rule, "d");
+}
+
+TEST(RuleEngineTest, HundredsOfRulesStayCheap) {
+    RuleEngine engine;
+    for (int i = 0; i < 500; ++i) {
+        ASSERT_TRUE(engine.addRule("r" + std::to_string(i) + ": oil_pressure < " + std::to_string(i % 50) +
+                                   " while rpm > 4000 or rate(temperature) > " + std::to_string(i) + " for 500ms"));
+    }
+    std::vector<AlertEvent> events;
+    events.reserve(1024);
+    constexpr int kSamples = 2000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSamples; ++i) {
+        events.clear();
+        engine.evaluate(snapshotAt(i * 10, {3000 + i % 2000, 90 + i % 7, 20 + i % 40, 100}), events);
+    }
+    const double ns_per_rule = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+                               (static_cast<double>(kSamples) * engine.size());
+    // Generous bound so unoptimized and instrumented builds pass; optimized builds
+    // run in the tens of nanoseconds.
+    EXPECT_LT(ns_per_rule, 2000.0);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include "SampleScheduler.h"
+
+using namespace std::chrono_literals;
+using Clock = SampleScheduler::Clock;
+
+TEST(SampleSchedulerTest, EachSignalRunsAtItsOwnRate) {
+    const Clock::time_point t0{};
+    SampleScheduler scheduler({1ms, 4ms, 2ms, 4ms}, t0);
+    EXPECT_TRUE(scheduler.multiRate());
+    EXPECT_EQ(scheduler.due(t0), kAllSignals);
+    EXPECT_EQ(scheduler.nextDeadline(), t0 + 1ms);
+    EXPECT_EQ(scheduler.due(t0 + 1ms), 0b0001);
+    EXPECT_EQ(scheduler.due(t0 + 2ms), 0b0101);
+    EXPECT_EQ(scheduler.due(t0 + 3ms), 0b0001);
+    EXPECT_EQ(scheduler.due(t0 + 4ms), 0b1111);
+    // Not due yet: nothing is sampled and deadlines stay put.
+    EXPECT_EQ(scheduler.due(t0 + 4ms + 500us), 0);
+    EXPECT_EQ(scheduler.nextDeadline(), t0 + 5ms);
+}
+
+TEST(SampleSchedulerTest, LateTickSkipsMissedSamplesWithoutDrift) {
+    const Clock::time_point t0{};
+    SampleScheduler scheduler({10ms, 10ms, 10ms, 10ms}, t0);
+    EXPECT_FALSE(scheduler.multiRate());
+    scheduler.due(t0);
+    // 35 ms late: one sample, and the next deadline stays on the 10 ms grid.
+    EXPECT_EQ(scheduler.due(t0 + 45ms), kAllSignals);
+    EXPECT_EQ(scheduler.nextDeadline(), t0 + 50ms);
+    EXPECT_EQ(scheduler.due(t0 + 49ms), 0);
+}
+
+TEST(SampleSchedulerTest, PeriodForRate) {
+    EXPECT_EQ(SampleScheduler::periodFor(1000.0, 200ms), std::chrono::duration_cast<Clock::duration>(1ms));
+    EXPECT_EQ(SampleScheduler::periodFor(0.0, 200ms), std::chrono::duration_cast<Clock::duration>(200ms));
+    EXPECT_EQ(SampleScheduler::periodFor(-1.0, 200ms), std::chrono::duration_cast<Clock::duration>(200ms));
+}
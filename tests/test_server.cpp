@@ -1,6 +1,7 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <unistd.h>
 
 // Mocks for system calls used by Server. Behavior can be toggled via the globals below.
@@ -30,12 +31,38 @@ extern "C" {
     ssize_t send(int, const void*, size_t count, int) { return (ssize_t)count; }
     int close(int) { return 0; }
     int setsockopt(int, int, int, const void*, socklen_t) { return mock_setsockopt_fail ? -1 : 0; }
-    int fcntl(int fd, int cmd, int arg) { (void)fd; (void)arg; if (mock_fcntl_fail) return -1; return 0; }
+    // Variadic to match <fcntl.h>, which Server.hpp pulls in transitively via spdlog.
+    int fcntl(int fd, int cmd, ...) { (void)fd; (void)cmd; if (mock_fcntl_fail) return -1; return 0; }
 }
 #include <gtest/gtest.h>
+#include <netinet/tcp.h>
 #include "Server.hpp"
+#include "Trace.h"
+#include "TestDoubles.h"
+#include "AllocationHook.h"
+#include <arpa/inet.h>
 #include <thread>
 #include <chrono>
+#include <filesystem>
+#include <map>
+#include <sqlite3.h>
+
+// Decodes one length-prefixed EngineData frame starting at `offset`.
+static bool decodeFrame(const std::string& bytes, size_t& offset, EngineData& msg) {
+    if (bytes.size() < offset + sizeof(uint32_t))
+        return false;
+    uint32_t size;
+    std::memcpy(&size, bytes.data() + offset, sizeof(size));
+    size = ntohl(size);
+    offset += sizeof(uint32_t);
+    if (bytes.size() < offset + size)
+        return false;
+    bool ok = msg.ParseFromArray(bytes.data() + offset, static_cast<int>(size));
+    offset += size;
+    return ok;
+}
+
+using FakeServer = BasicServer<FakeEngine, InMemoryTransport>;
 
 TEST(ServerTest, InitialValuesAreZero) {
     Server server;
@@ -118,6 +145,944 @@ TEST(ServerErrorTest, ListenFailureHandled) {
     mock_listen_fail = 0;
 }
 
+TEST(ServerPolicyTest, GetLatestSampleReturnsWholeTuple) {
+    FakeServer server;
+    server.engine().next = {4321, 95, 60, 120};
+    server.start(10);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestRpm() == 4321; }));
+    EngineSample latest = server.getLatestSample();
+    server.stop();
+    EXPECT_EQ(latest.rpm, 4321);
+    EXPECT_EQ(latest.temperature, 95);
+    EXPECT_EQ(latest.oil_pressure, 60);
+    EXPECT_EQ(latest.speed, 120);
+    EXPECT_GT(server.engine().samples.load(), 0);
+    EXPECT_GT(server.engine().stores.load(), 0);
+}
+
+TEST(ServerPolicyTest, SnapshotSequenceIncreasesWithEachSample) {
+    FakeServer server;
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 2; }));
+    EngineSnapshot first = server.getLatestSnapshot();
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence > first.sequence; }));
+    EngineSnapshot second = server.getLatestSnapshot();
+    server.stop();
+    EXPECT_GT(first.timestamp_ms, 0);
+    EXPECT_GE(second.timestamp_ms, first.timestamp_ms);
+}
+
+TEST(ServerPolicyTest, InMemoryClientReceivesOneFramePerRequest) {
+    FakeServer server;
+    server.engine().next = {3000, 100, 50, 200};
+    server.start(10);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestRpm() == 3000; }));
+    int client = server.transport().connectClient({"a", "b"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+
+    std::string bytes = server.transport().sent(client);
+    size_t offset = 0;
+    for (int i = 0; i < 2; ++i) {
+        EngineData msg;
+        ASSERT_TRUE(decodeFrame(bytes, offset, msg));
+        EXPECT_EQ(msg.rpm(), 3000);
+        EXPECT_EQ(msg.temperature(), 100);
+        EXPECT_EQ(msg.oil_pressure(), 50);
+        EXPECT_EQ(msg.speed(), 200);
+        EXPECT_GT(msg.sequence(), 0u);
+        EXPECT_GT(msg.timestamp_ms(), 0);
+    }
+    EXPECT_EQ(offset, bytes.size());
+}
+
+// Builds a structured request frame: marker, 4-byte big-endian size, Request.
+static std::string requestFrame(const Request& request) {
+    std::string body = request.SerializeAsString();
+    std::string frame(1, static_cast<char>(0xA5));
+    uint32_t size = htonl(static_cast<uint32_t>(body.size()));
+    frame.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    return frame + body;
+}
+
+TEST(ServerPolicyTest, StructuredRequestReturnsRollingStats) {
+    FakeServer server;
+    server.engine().next = {2000, 80, 40, 60};
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return !server.getLatestStats().empty() && server.getLatestStats()[0].count >= 2; }));
+    Request request;
+    request.set_include_stats(true);
+    std::string frame = requestFrame(request);
+    // Split across reads to exercise reassembly; a plain poll follows.
+    int client = server.transport().connectClient({frame.substr(0, 3), frame.substr(3), "x"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+
+    std::string bytes = server.transport().sent(client);
+    size_t offset = 0;
+    EngineData with_stats;
+    ASSERT_TRUE(decodeFrame(bytes, offset, with_stats));
+    ASSERT_EQ(with_stats.windows_size(), 3);
+    EXPECT_EQ(with_stats.windows(0).window_ms(), 1000u);
+    EXPECT_EQ(with_stats.windows(2).window_ms(), 60000u);
+    EXPECT_GE(with_stats.windows(0).count(), 2u);
+    EXPECT_DOUBLE_EQ(with_stats.windows(0).rpm().mean(), 2000.0);
+    EXPECT_EQ(with_stats.windows(0).speed().max(), 60);
+    EngineData plain;
+    ASSERT_TRUE(decodeFrame(bytes, offset, plain));
+    EXPECT_EQ(plain.windows_size(), 0);
+    EXPECT_EQ(offset, bytes.size());
+}
+
+static std::vector<EngineData> decodeFrames(const std::string& bytes) {
+    std::vector<EngineData> frames;
+    size_t offset = 0;
+    EngineData msg;
+    while (decodeFrame(bytes, offset, msg))
+        frames.push_back(msg);
+    return frames;
+}
+
+TEST(ServerPolicyTest, LongPollIsAnsweredAtOnceWhenNewerDataExists) {
+    FakeServer server;
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 2; }));
+    Request request;
+    request.set_after_sequence(1);
+    int client = server.transport().connectClient({requestFrame(request)});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+    const std::vector<EngineData> frames = decodeFrames(server.transport().sent(client));
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_GT(frames[0].sequence(), 1u);
+}
+
+TEST(ServerPolicyTest, LongPollWaitsForTheNextSample) {
+    FakeServer server;
+    // Samples arrive only when released, so none can answer the poll early.
+    server.engine().gate();
+    server.engine().release();
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence == 1; }));
+    const uint64_t seen = server.getLatestSnapshot().sequence;
+    Request request;
+    request.set_after_sequence(seen);
+    request.set_include_stats(true);
+    // The plain poll behind the long poll is answered after it, in order.
+    int client = server.transport().connectClient({requestFrame(request), "x"}, true);
+    ASSERT_TRUE(waitFor([&] { return server.getCounters().waiting == 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(server.transport().sent(client).empty());
+
+    server.engine().release();
+    ASSERT_TRUE(waitFor([&] { return decodeFrames(server.transport().sent(client)).size() == 2; }, 1000));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    server.engine().ungate();
+    server.stop();
+    const std::vector<EngineData> frames = decodeFrames(server.transport().sent(client));
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0].sequence(), seen + 1);
+    EXPECT_EQ(frames[0].windows_size(), 3);
+    EXPECT_EQ(frames[1].windows_size(), 0);
+    EXPECT_EQ(server.getCounters().waiting, 0u);
+}
+
+TEST(ServerPolicyTest, LongPollTimesOutWithTheUnchangedSnapshot) {
+    ServerConfig config;
+    config.limits.max_wait_ms = 40;
+    FakeServer server(config);
+    server.start(1000);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence == 1; }));
+    Request request;
+    request.set_after_sequence(1);
+    request.set_wait_ms(60000); // capped at max_wait_ms
+    const auto begin = std::chrono::steady_clock::now();
+    int client = server.transport().connectClient({requestFrame(request)}, true);
+    ASSERT_TRUE(waitFor([&] { return !server.transport().sent(client).empty(); }, 1000));
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    server.stop();
+    EXPECT_GE(elapsed, std::chrono::milliseconds(40));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+    const std::vector<EngineData> frames = decodeFrames(server.transport().sent(client));
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0].sequence(), 1u);
+}
+
+TEST(ServerPolicyTest, OversizedRequestClosesClient) {
+    FakeServer server;
+    server.start(10);
+    std::string frame(1, static_cast<char>(0xA5));
+    uint32_t size = htonl(1u << 20);
+    frame.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    int client = server.transport().connectClient({frame, "x"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+    EXPECT_TRUE(server.transport().sent(client).empty());
+}
+
+TEST(ServerPolicyTest, StatsDisabledWithNoWindows) {
+    ServerConfig config;
+    config.stats.windows_ms.clear();
+    FakeServer server(config);
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 2; }));
+    server.stop();
+    EXPECT_TRUE(server.getLatestStats().empty());
+}
+
+TEST(ServerPolicyTest, ClientsAreServedConcurrently) {
+    FakeServer server;
+    server.start(10);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestRpm() == 1200; }));
+    int first = server.transport().connectClient({"a", "b", "c"});
+    int second = server.transport().connectClient({"a", "b"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(first) && server.transport().closed(second); }));
+    server.stop();
+
+    for (auto [fd, frames] : {std::pair{first, 3}, std::pair{second, 2}}) {
+        std::string bytes = server.transport().sent(fd);
+        size_t offset = 0;
+        for (int i = 0; i < frames; ++i) {
+            EngineData msg;
+            ASSERT_TRUE(decodeFrame(bytes, offset, msg));
+            EXPECT_EQ(msg.rpm(), 1200);
+        }
+        EXPECT_EQ(offset, bytes.size());
+    }
+}
+
+TEST(ServerPolicyTest, UnixListenerOpenedAlongsideTcp) {
+    ServerConfig config;
+    config.unix_socket.enabled = true;
+    config.unix_socket.path = "/tmp/middlewaresw_test.sock";
+    config.unix_socket.seqpacket = true;
+    FakeServer server(config);
+    server.start(10);
+    ASSERT_TRUE(waitFor([&] { return server.transport().socketsCreated().size() == 2; }));
+    int client = server.transport().connectClient({"x"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+
+    auto sockets = server.transport().socketsCreated();
+    EXPECT_EQ(sockets[0], std::make_pair(AF_INET, static_cast<int>(SOCK_STREAM)));
+    EXPECT_EQ(sockets[1], std::make_pair(AF_UNIX, static_cast<int>(SOCK_SEQPACKET)));
+    size_t offset = 0;
+    EngineData msg;
+    EXPECT_TRUE(decodeFrame(server.transport().sent(client), offset, msg));
+}
+
+TEST(ServerPolicyTest, UnixListenerRejectsOverlongPath) {
+    ServerConfig config;
+    config.unix_socket.enabled = true;
+    config.unix_socket.path = std::string(200, 'p');
+    FakeServer server(config);
+    server.start(10);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    server.stop();
+    EXPECT_EQ(server.transport().socketsCreated().size(), 1u);
+}
+
+TEST(ServerPolicyTest, SocketProfileAppliedToListenerAndClients) {
+    ServerConfig config;
+    config.socket.backlog = 4096;
+    config.socket.receive_buffer_bytes = 1 << 20;
+    config.socket.keepalive = true;
+    config.socket.keepalive_idle_s = 30;
+    config.socket.user_timeout_ms = 5000;
+    config.socket.tcp_quickack = true;
+    FakeServer server(config);
+    server.start(10);
+    ASSERT_TRUE(waitFor([&] { return !server.transport().listenBacklogs().empty(); }));
+    int client = server.transport().connectClient({"x"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+
+    EXPECT_EQ(server.transport().listenBacklogs()[0], 4096);
+    auto value = [&](int fd, int level, int name) {
+        for (const auto& o : server.transport().socketOptions())
+            if (o.fd == fd && o.level == level && o.name == name)
+                return o.value;
+        return -1;
+    };
+    int listener = -1;
+    for (const auto& o : server.transport().socketOptions())
+        if (o.level == SOL_SOCKET && o.name == SO_REUSEADDR)
+            listener = o.fd;
+    ASSERT_NE(listener, -1);
+    EXPECT_EQ(value(listener, SOL_SOCKET, SO_REUSEPORT), 1);
+    EXPECT_EQ(value(listener, SOL_SOCKET, SO_RCVBUF), 1 << 20);
+    EXPECT_EQ(value(listener, IPPROTO_TCP, TCP_NODELAY), 1);
+    EXPECT_EQ(value(listener, SOL_SOCKET, SO_KEEPALIVE), 1);
+    EXPECT_EQ(value(listener, IPPROTO_TCP, TCP_KEEPIDLE), 30);
+    EXPECT_EQ(value(listener, IPPROTO_TCP, TCP_USER_TIMEOUT), 5000);
+    // Unset options keep the kernel defaults.
+    EXPECT_EQ(value(listener, SOL_SOCKET, SO_SNDBUF), -1);
+    EXPECT_EQ(value(listener, SOL_SOCKET, SO_BUSY_POLL), -1);
+    // QUICKACK is re-armed on the client after its read.
+    EXPECT_EQ(value(client, IPPROTO_TCP, TCP_QUICKACK), 1);
+}
+
+TEST(ServerPolicyTest, SignalsAreSampledAtTheirOwnRates) {
+    ServerConfig config;
+    config.sampling.rate_hz = {200.0, 5.0, 0.0, 0.0}; // rpm 5 ms, temperature 200 ms, others 50 ms
+    config.multicast.enabled = true;
+    config.stats.windows_ms.clear();
+    FakeServer server(config);
+    server.start(50);
+    ASSERT_TRUE(waitFor([&] { return server.engine().signal_reads[0].load() >= 60; }));
+    int client = server.transport().connectClient({"x"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+
+    const int rpm_reads = server.engine().signal_reads[0].load();
+    EXPECT_GT(rpm_reads, 5 * server.engine().signal_reads[2].load());
+    EXPECT_GT(server.engine().signal_reads[2].load(), server.engine().signal_reads[1].load());
+
+    // Responses carry every value plus when each signal was last sampled.
+    size_t offset = 0;
+    EngineData msg;
+    ASSERT_TRUE(decodeFrame(server.transport().sent(client), offset, msg));
+    EXPECT_EQ(msg.rpm(), 1200);
+    EXPECT_EQ(msg.temperature(), 90);
+    ASSERT_EQ(msg.field_timestamp_ms_size(), 4);
+    EXPECT_EQ(msg.field_timestamp_ms(0), msg.timestamp_ms());
+    EXPECT_LE(msg.field_timestamp_ms(1), msg.timestamp_ms());
+
+    // Multicast datagrams only carry the signals sampled for them.
+    int rpm_only = 0;
+    for (const std::string& datagram : server.transport().datagrams()) {
+        EngineData d;
+        ASSERT_TRUE(d.ParseFromString(datagram));
+        EXPECT_TRUE(d.has_rpm());
+        rpm_only += !d.has_temperature() && !d.has_speed();
+    }
+    EXPECT_GT(rpm_only, 0);
+}
+
+TEST(ServerPolicyTest, TracingRecordsSamplingAndRequestSpans) {
+    Trace::clear();
+    Trace::enable();
+    FakeServer server;
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 3; }));
+    int client = server.transport().connectClient({"x"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+    Trace::disable();
+
+    const std::string json = Trace::chromeJson();
+    for (const char* span : {"sample", "store", "publish", "request", "serialize", "send", "wait data_mutex"})
+        EXPECT_NE(json.find("\"name\":\"" + std::string(span) + "\",\"ph\":\"X\""), std::string::npos) << span;
+    for (const char* thread : {"data", "transform", "publish", "persist", "server"})
+        EXPECT_NE(json.find("\"args\":{\"name\":\"" + std::string(thread) + "\"}"), std::string::npos) << thread;
+    Trace::clear();
+}
+
+TEST(ServerPolicyTest, SlowStorageDoesNotDelaySampling) {
+    ServerConfig config;
+    config.pipeline.persist.capacity = 8;
+    FakeServer server(config);
+    server.engine().store_delay_ms = 50;
+    server.start(2);
+    const auto begin = std::chrono::steady_clock::now();
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 100; }));
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    // Storing 100 samples inline would take 5 s.
+    EXPECT_LT(elapsed, std::chrono::milliseconds(2000));
+    EXPECT_LT(server.engine().stores.load(), 20);
+    server.stop();
+
+    const std::vector<StageStats> stages = server.getPipelineStats();
+    ASSERT_EQ(stages.size(), 4u);
+    EXPECT_STREQ(stages[3].name, "persist");
+    EXPECT_EQ(stages[3].capacity, 8u);
+    EXPECT_EQ(stages[3].high_water, 8u);
+    EXPECT_GT(stages[3].dropped, 0u);
+    EXPECT_EQ(stages[3].processed + stages[3].dropped, stages[2].processed);
+    EXPECT_EQ(stages[2].processed, stages[0].processed);
+    EXPECT_GE(stages[3].max_latency_us, 50000.0);
+}
+
+// FakeEngine sampling with real storage behind a slow disk. Records when each
+// sample was read; the snapshot timestamp is taken right after.
+struct SlowDiskEngine : FakeEngine {
+    explicit SlowDiskEngine(const StorageConfig& config) : storage(config) {}
+    EngineSample sample() { return sample(kAllSignals); }
+    EngineSample sample(uint8_t signals) {
+        sampled_ms.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        return FakeEngine::sample(signals);
+    }
+    void storeSample(const EngineSnapshot& snapshot) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        storage.storeSample(snapshot);
+    }
+    EngineImpl storage;
+    std::vector<int64_t> sampled_ms; // sampling thread only
+};
+
+TEST(ServerPolicyTest, QueuedSamplesAreStoredWithTheirAcquisitionTime) {
+    const std::string path = "/tmp/test_server_persist_time.db";
+    std::filesystem::remove(path);
+    ServerConfig config;
+    config.storage.path = path;
+    config.pipeline.transform.overflow = OverflowPolicy::Block;
+    config.pipeline.publish.overflow = OverflowPolicy::Block;
+    std::vector<int64_t> sampled_ms;
+    {
+        BasicServer<SlowDiskEngine, InMemoryTransport> server(config);
+        server.start(2);
+        // Samples queue up in front of the 20 ms stores.
+        ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 40; }));
+        server.stop();
+        sampled_ms = server.engine().sampled_ms;
+    }
+
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    sqlite3_stmt* stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT timestamp FROM engine_values ORDER BY id;", -1, &stmt, nullptr), SQLITE_OK);
+    std::vector<int64_t> stored_ms;
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+        stored_ms.push_back(sqlite3_column_int64(stmt, 0));
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    std::filesystem::remove(path);
+
+    // Every sample is stored, stamped between its read and the next one.
+    ASSERT_EQ(stored_ms.size(), sampled_ms.size());
+    for (size_t i = 0; i < stored_ms.size(); ++i) {
+        SCOPED_TRACE(i);
+        EXPECT_GE(stored_ms[i], sampled_ms[i]);
+        if (i + 1 < sampled_ms.size()) {
+            EXPECT_LE(stored_ms[i], sampled_ms[i + 1]);
+        }
+    }
+}
+
+TEST(ServerPolicyTest, StatsRequestReportsPipelineStages) {
+    FakeServer server;
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.getPipelineStats()[3].processed >= 2; }));
+    Request request;
+    request.set_include_stats(true);
+    int client = server.transport().connectClient({requestFrame(request), "x"});
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+
+    std::string bytes = server.transport().sent(client);
+    size_t offset = 0;
+    EngineData with_stats;
+    ASSERT_TRUE(decodeFrame(bytes, offset, with_stats));
+    ASSERT_EQ(with_stats.pipeline_size(), 4);
+    EXPECT_EQ(with_stats.pipeline(0).name(), "acquire");
+    EXPECT_EQ(with_stats.pipeline(0).capacity(), 0u);
+    EXPECT_EQ(with_stats.pipeline(1).name(), "transform");
+    EXPECT_EQ(with_stats.pipeline(1).capacity(), 4096u);
+    EXPECT_EQ(with_stats.pipeline(3).name(), "persist");
+    EXPECT_GE(with_stats.pipeline(3).processed(), 2u);
+    EXPECT_GT(with_stats.pipeline(3).mean_latency_us(), 0.0);
+    EngineData plain;
+    ASSERT_TRUE(decodeFrame(bytes, offset, plain));
+    EXPECT_EQ(plain.pipeline_size(), 0);
+}
+
+TEST(ServerPolicyTest, AlertsArePushedToSubscribers) {
+    ServerConfig config;
+    config.alerts.rules = {"hot: temperature > 100", "bogus: torque > 1"};
+    FakeServer server(config);
+    server.start(5);
+    Request subscribe;
+    subscribe.set_subscribe_alerts(true);
+    int subscriber = server.transport().connectClient({requestFrame(subscribe)}, true);
+    int poller = server.transport().connectClient({"x"}, true);
+    // The subscription is acknowledged with a snapshot frame.
+    ASSERT_TRUE(waitFor([&] { return !server.transport().sent(subscriber).empty(); }));
+    ASSERT_TRUE(waitFor([&] { return !server.transport().sent(poller).empty(); }));
+
+    server.engine().setNext({1200, 130, 45, 80});
+    ASSERT_TRUE(waitFor([&] { return server.engine().alerts_stored.load() >= 1; }));
+    server.engine().setNext({1200, 90, 45, 80});
+    ASSERT_TRUE(waitFor([&] { return server.engine().alerts_stored.load() >= 2; }));
+    std::string bytes;
+    ASSERT_TRUE(waitFor([&] {
+        bytes = server.transport().sent(subscriber);
+        size_t offset = 0;
+        EngineData msg;
+        int alert_frames = 0;
+        while (decodeFrame(bytes, offset, msg))
+            alert_frames += msg.alerts_size() > 0;
+        return alert_frames == 2;
+    }));
+    std::string polled = server.transport().sent(poller);
+    server.stop();
+
+    size_t offset = 0;
+    EngineData ack;
+    ASSERT_TRUE(decodeFrame(bytes, offset, ack));
+    EXPECT_EQ(ack.alerts_size(), 0);
+    EngineData raised, cleared;
+    ASSERT_TRUE(decodeFrame(bytes, offset, raised));
+    ASSERT_TRUE(decodeFrame(bytes, offset, cleared));
+    ASSERT_EQ(raised.alerts_size(), 1);
+    EXPECT_EQ(raised.alerts(0).rule(), "hot");
+    EXPECT_TRUE(raised.alerts(0).raised());
+    EXPECT_EQ(raised.temperature(), 130);
+    ASSERT_EQ(cleared.alerts_size(), 1);
+    EXPECT_FALSE(cleared.alerts(0).raised());
+    EXPECT_GT(cleared.sequence(), raised.sequence());
+    // Clients that did not subscribe only get their polled snapshot.
+    offset = 0;
+    EngineData only;
+    ASSERT_TRUE(decodeFrame(polled, offset, only));
+    EXPECT_EQ(offset, polled.size());
+}
+
+// InMemoryTransport that tracks allocations on the server thread and leaves its own
+// (which stand in for the kernel) out of the count.
+struct CountingTransport : InMemoryTransport {
+    int accept(int fd, sockaddr* addr, socklen_t* len) {
+        alloc_hook::Pause pause;
+        return InMemoryTransport::accept(fd, addr, len);
+    }
+    ssize_t read(int fd, void* buf, size_t count) {
+        alloc_hook::Pause pause;
+        return InMemoryTransport::read(fd, buf, count);
+    }
+    ssize_t send(int fd, const void* buf, size_t len, int flags) {
+        alloc_hook::Pause pause;
+        return InMemoryTransport::send(fd, buf, len, flags);
+    }
+    int poll(pollfd* fds, nfds_t nfds, int timeout) {
+        alloc_hook::trackThisThread();
+        alloc_hook::Pause pause;
+        return InMemoryTransport::poll(fds, nfds, timeout);
+    }
+};
+
+TEST(ServerPolicyTest, WarmRequestPathDoesNotAllocate) {
+    BasicServer<FakeEngine, CountingTransport> server;
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return !server.getLatestStats().empty(); }));
+    Request request;
+    request.set_include_stats(true);
+    const std::string stats_request = requestFrame(request);
+    constexpr size_t kRequests = 2000;
+    std::vector<std::string> chunks;
+    for (size_t i = 0; i < kRequests; ++i)
+        chunks.push_back(i % 2 ? stats_request : "x");
+    int client = server.transport().connectClient(chunks, true);
+
+    auto frames = [&] {
+        std::string bytes = server.transport().sent(client);
+        size_t offset = 0, n = 0;
+        EngineData msg;
+        while (decodeFrame(bytes, offset, msg))
+            ++n;
+        return n;
+    };
+    ASSERT_TRUE(waitFor([&] { return frames() >= 200; }));
+    const size_t warm = alloc_hook::count();
+    const size_t warm_frames = frames();
+    ASSERT_TRUE(waitFor([&] { return frames() == kRequests; }, 5000));
+    const size_t after = alloc_hook::count();
+    server.stop();
+    ASSERT_LT(warm_frames, kRequests);
+    EXPECT_EQ(after - warm, 0u) << "allocations while serving " << kRequests - warm_frames << " requests";
+}
+
+TEST(ServerPolicyTest, ConnectionChurnReusesPooledMemory) {
+    BasicServer<FakeEngine, CountingTransport> server;
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return !server.getLatestStats().empty(); }));
+    Request request;
+    request.set_include_stats(true);
+    const std::string stats_request = requestFrame(request);
+    // Each client sends a structured request and hangs up after the answer.
+    auto churn = [&](int clients) {
+        std::vector<int> fds;
+        for (int i = 0; i < clients; ++i)
+            fds.push_back(server.transport().connectClient({stats_request}));
+        return waitFor([&] {
+            for (int fd : fds) {
+                if (!server.transport().closed(fd))
+                    return false;
+            }
+            return true;
+        }, 5000);
+    };
+    ASSERT_TRUE(churn(200));
+    const size_t warm = alloc_hook::count();
+    ASSERT_TRUE(churn(200));
+    ASSERT_TRUE(churn(200));
+    const size_t after = alloc_hook::count();
+    ASSERT_TRUE(waitFor([&] { return server.getMemoryStats()[0].allocations == 600; }));
+    const std::vector<SlabStats> pools = server.getMemoryStats();
+    server.stop();
+
+    EXPECT_EQ(after - warm, 0u) << "allocations while serving 400 short-lived clients";
+    ASSERT_EQ(pools.size(), 3u);
+    EXPECT_STREQ(pools[0].name, "connections");
+    EXPECT_EQ(pools[0].capacity, 1024u);
+    EXPECT_LE(pools[0].high_water, 200u);
+    EXPECT_EQ(pools[0].in_use, 0u);
+    EXPECT_EQ(pools[0].fallbacks, 0u);
+    // An output and an input buffer per client.
+    EXPECT_EQ(pools[1].allocations, 1200u);
+    EXPECT_EQ(pools[1].in_use, 0u);
+    EXPECT_EQ(pools[1].fallbacks, 0u);
+    EXPECT_EQ(pools[2].allocations, 0u);
+}
+
+TEST(ServerPolicyTest, ConnectionCapRefusesExtraClients) {
+    ServerConfig config;
+    config.limits.max_connections = 2;
+    FakeServer server(config);
+    server.start(10);
+    int first = server.transport().connectClient({}, true);
+    int second = server.transport().connectClient({}, true);
+    int third = server.transport().connectClient({}, true);
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(third); }));
+    ASSERT_TRUE(waitFor([&] { return server.getCounters().active == 2; }));
+    ServerCounters counters = server.getCounters();
+    server.stop();
+    EXPECT_EQ(counters.accepted, 2u);
+    EXPECT_EQ(counters.refused, 1u);
+    EXPECT_TRUE(server.transport().sent(third).empty());
+    (void)first;
+    (void)second;
+}
+
+TEST(ServerPolicyTest, RateLimitThrottlesAbusiveClientOnly) {
+    ServerConfig config;
+    config.limits.requests_per_second = 50.0;
+    config.limits.burst = 5.0;
+    FakeServer server(config);
+    server.start(10);
+    auto frameCount = [&](int fd) {
+        std::string bytes = server.transport().sent(fd);
+        size_t offset = 0, n = 0;
+        EngineData msg;
+        while (decodeFrame(bytes, offset, msg))
+            ++n;
+        return n;
+    };
+    auto started = std::chrono::steady_clock::now();
+    int abusive = server.transport().connectClient(std::vector<std::string>(1000, "x"), true);
+    int dashboard = server.transport().connectClient({"x", "x", "x"}, true);
+    // The dashboard stays within its burst and is answered right away.
+    ASSERT_TRUE(waitFor([&] { return frameCount(dashboard) == 3; }, 500));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    const size_t abusive_frames = frameCount(abusive);
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    ASSERT_TRUE(waitFor([&] { return server.getClientCounters().size() == 2; }));
+    std::vector<ClientCounters> clients = server.getClientCounters();
+    server.stop();
+
+    EXPECT_GE(abusive_frames, 5u);
+    EXPECT_LE(abusive_frames, static_cast<size_t>(5 + 50 * elapsed_s + 1));
+    EXPECT_GT(server.getCounters().throttled, 0u);
+    const ClientCounters& a = clients[0].fd == abusive ? clients[0] : clients[1];
+    const ClientCounters& d = clients[0].fd == dashboard ? clients[0] : clients[1];
+    EXPECT_GT(a.throttled, 0u);
+    EXPECT_GE(a.requests, 5u);
+    EXPECT_GT(a.bytes_sent, 0u);
+    EXPECT_EQ(d.throttled, 0u);
+    EXPECT_EQ(d.requests, 3u);
+    EXPECT_EQ(d.bytes_received, 3u);
+}
+
+TEST(ServerPolicyTest, ExportRequestStreamsHistoryInChunks) {
+    const std::string path = "/tmp/test_server_export.db";
+    std::filesystem::remove(path);
+    {
+        EngineImpl engine(path);
+        for (int i = 0; i < 25; ++i)
+            engine.storeCurrentValues(i, 90, 40, 100);
+    }
+    ServerConfig config;
+    config.history.db_path = path;
+    config.history.export_chunk_rows = 10;
+    FakeServer server(config);
+    server.start(10);
+    Request request;
+    request.mutable_export_history()->set_format(ExportRequest::CSV);
+    int client = server.transport().connectClient({requestFrame(request)}, true);
+    std::string csv;
+    int frames = 0;
+    ASSERT_TRUE(waitFor([&] {
+        std::string bytes = server.transport().sent(client);
+        size_t offset = 0;
+        EngineData msg;
+        csv.clear();
+        frames = 0;
+        bool last = false;
+        while (decodeFrame(bytes, offset, msg)) {
+            ++frames;
+            csv += msg.export_chunk().data();
+            last = msg.export_chunk().last();
+        }
+        return last;
+    }));
+    server.stop();
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(frames, 3);
+    EXPECT_EQ(std::count(csv.begin(), csv.end(), '\n'), 26);
+    EXPECT_EQ(csv.rfind("id,timestamp_ms,rpm", 0), 0u);
+    EXPECT_NE(csv.find("\n25,"), std::string::npos);
+}
+
+TEST(ServerPolicyTest, ExportOfMissingDatabaseReportsFailure) {
+    ServerConfig config;
+    config.history.db_path = "/nonexistent/dir/engine.db";
+    FakeServer server(config);
+    server.start(10);
+    Request request;
+    request.mutable_export_history();
+    int client = server.transport().connectClient({requestFrame(request)}, true);
+    ASSERT_TRUE(waitFor([&] { return !server.transport().sent(client).empty(); }));
+    server.stop();
+    size_t offset = 0;
+    EngineData msg;
+    ASSERT_TRUE(decodeFrame(server.transport().sent(client), offset, msg));
+    EXPECT_TRUE(msg.export_chunk().last());
+    EXPECT_TRUE(msg.export_chunk().failed());
+}
+
+static int exportFrames(const std::string& bytes, bool* last = nullptr) {
+    size_t offset = 0;
+    int frames = 0;
+    EngineData msg;
+    while (decodeFrame(bytes, offset, msg)) {
+        ++frames;
+        if (last)
+            *last = msg.export_chunk().last();
+    }
+    return frames;
+}
+
+TEST(ServerPolicyTest, ExportsBeyondMaxJobsAreRefused) {
+    const std::string path = "/tmp/test_server_export_refused.db";
+    std::filesystem::remove(path);
+    {
+        EngineImpl engine(path);
+        for (int i = 0; i < 50; ++i)
+            engine.storeCurrentValues(i, 90, 40, 100);
+    }
+    ServerConfig config;
+    config.history.db_path = path;
+    config.history.export_chunk_rows = 1;
+    config.history.max_jobs = 1;
+    FakeServer server(config);
+    Request request;
+    request.mutable_export_history();
+    // Both are accepted and read in the same poll loop iteration.
+    int first = server.transport().connectClient({requestFrame(request)}, true);
+    int second = server.transport().connectClient({requestFrame(request)}, true);
+    server.start(10);
+    bool first_last = false;
+    ASSERT_TRUE(waitFor([&] { return exportFrames(server.transport().sent(first), &first_last) > 0 && first_last; }));
+    ServerCounters counters = server.getCounters();
+    server.stop();
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(exportFrames(server.transport().sent(first)), 51);
+    size_t offset = 0;
+    EngineData msg;
+    ASSERT_TRUE(decodeFrame(server.transport().sent(second), offset, msg));
+    EXPECT_TRUE(msg.export_chunk().last());
+    EXPECT_TRUE(msg.export_chunk().failed());
+    EXPECT_EQ(counters.exports_refused, 1u);
+    EXPECT_EQ(counters.exports, 0u);
+}
+
+TEST(ServerPolicyTest, DisconnectCancelsExport) {
+    const std::string path = "/tmp/test_server_export_cancel.db";
+    std::filesystem::remove(path);
+    {
+        EngineImpl engine(path);
+        for (int i = 0; i < 500; ++i)
+            engine.storeCurrentValues(i, 90, 40, 100);
+    }
+    ServerConfig config;
+    config.history.db_path = path;
+    config.history.export_chunk_rows = 1;
+    FakeServer server(config);
+    server.start(10);
+    Request request;
+    request.mutable_export_history();
+    // The client hangs up right after its request.
+    int client = server.transport().connectClient({requestFrame(request)});
+    ASSERT_TRUE(waitFor([&] { return server.getCounters().exports_cancelled == 1; }));
+    ASSERT_TRUE(waitFor([&] { return server.getCounters().exports == 0; }));
+    server.stop();
+    std::filesystem::remove(path);
+
+    bool last = false;
+    EXPECT_LT(exportFrames(server.transport().sent(client), &last), 501);
+    EXPECT_FALSE(last);
+}
+
+// The HTTP gateway listens after the TCP listener (no Unix listener here).
+constexpr size_t kHttpListener = 1;
+
+static ServerConfig gatewayConfig() {
+    ServerConfig config;
+    config.http.enabled = true;
+    return config;
+}
+
+static std::string streamHandshake() {
+    return "GET /stream HTTP/1.1\r\nHost: engine\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+           "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+}
+
+// Splits what a WebSocket client received after the 101 response into (opcode,
+// payload) pairs.
+static std::vector<std::pair<int, std::string>> serverFrames(const std::string& bytes) {
+    std::vector<std::pair<int, std::string>> frames;
+    size_t offset = bytes.find("\r\n\r\n");
+    if (offset == std::string::npos)
+        return frames;
+    offset += 4;
+    while (offset + 2 <= bytes.size()) {
+        const int opcode = static_cast<uint8_t>(bytes[offset]) & 0x0F;
+        size_t length = static_cast<uint8_t>(bytes[offset + 1]);
+        size_t header = 2;
+        if (length == 126) {
+            if (offset + 4 > bytes.size())
+                break;
+            length = (static_cast<uint8_t>(bytes[offset + 2]) << 8) | static_cast<uint8_t>(bytes[offset + 3]);
+            header = 4;
+        }
+        if (offset + header + length > bytes.size())
+            break;
+        frames.emplace_back(opcode, bytes.substr(offset + header, length));
+        offset += header + length;
+    }
+    return frames;
+}
+
+TEST(ServerPolicyTest, HttpLatestReturnsJsonOnKeepAliveConnections) {
+    FakeServer server(gatewayConfig());
+    server.start(5);
+    ASSERT_TRUE(waitFor([&] { return server.getLatestSnapshot().sequence >= 1; }));
+    // Two pipelined requests, the second asking to close.
+    int client = server.transport().connectClient(
+        {"GET /latest HTTP/1.1\r\nHost: engine\r\n\r\nGET /nope HTTP/1.1\r\nConnection: close\r\n\r\n"}, true,
+        kHttpListener);
+    int poster = server.transport().connectClient({"POST /latest HTTP/1.1\r\nContent-Length: 0\r\n\r\n"}, true,
+                                                  kHttpListener);
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    ASSERT_TRUE(waitFor([&] { return !server.transport().sent(poster).empty(); }));
+    const std::string bytes = server.transport().sent(client);
+    const std::string posted = server.transport().sent(poster);
+    server.stop();
+
+    EXPECT_EQ(bytes.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+    EXPECT_NE(bytes.find("Content-Type: application/json\r\n"), std::string::npos);
+    EXPECT_NE(bytes.find("{\"sequence\":"), std::string::npos);
+    EXPECT_NE(bytes.find("\"rpm\":1200,\"temperature\":90,\"oil_pressure\":45,\"speed\":80}"), std::string::npos);
+    const size_t second = bytes.find("HTTP/1.1 404 Not Found\r\n");
+    ASSERT_NE(second, std::string::npos);
+    EXPECT_NE(bytes.find("Connection: close\r\n", second), std::string::npos);
+    EXPECT_EQ(posted.rfind("HTTP/1.1 405 Method Not Allowed\r\n", 0), 0u);
+}
+
+TEST(ServerPolicyTest, OversizedHttpHeadIsRefused) {
+    FakeServer server(gatewayConfig());
+    server.start(5);
+    const std::string filler = "X-Filler: " + std::string(3000, 'a') + "\r\n";
+    int client = server.transport().connectClient({"GET /latest HTTP/1.1\r\n" + filler, filler, filler, filler}, true,
+                                                  kHttpListener);
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(client); }));
+    server.stop();
+    EXPECT_EQ(server.transport().sent(client).rfind("HTTP/1.1 431 ", 0), 0u);
+}
+
+TEST(ServerPolicyTest, WebSocketStreamEncodesEachSampleOnce) {
+    FakeServer server(gatewayConfig());
+    server.start(5);
+    std::vector<int> clients;
+    for (int i = 0; i < 3; ++i)
+        clients.push_back(server.transport().connectClient({streamHandshake()}, true, kHttpListener));
+    ASSERT_TRUE(waitFor([&] {
+        for (int fd : clients) {
+            if (serverFrames(server.transport().sent(fd)).size() < 10)
+                return false;
+        }
+        return true;
+    }));
+    EXPECT_EQ(server.getCounters().streaming, 3u);
+
+    // A ping is answered; a close is echoed and ends the stream for that client only.
+    server.transport().sendToServer(clients[0], webSocketClientFrame(http::kPing, "hb"));
+    ASSERT_TRUE(waitFor([&] {
+        for (const auto& [opcode, payload] : serverFrames(server.transport().sent(clients[0]))) {
+            if (opcode == http::kPong)
+                return payload == "hb";
+        }
+        return false;
+    }));
+    server.transport().sendToServer(clients[0], webSocketClientFrame(http::kClose, "\x03\xe8"));
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(clients[0]); }));
+    ASSERT_TRUE(waitFor([&] { return server.getCounters().streaming == 2u; }));
+    std::vector<std::string> received;
+    for (int fd : clients)
+        received.push_back(server.transport().sent(fd));
+    const ServerCounters counters = server.getCounters();
+    const uint64_t latest = server.getLatestSnapshot().sequence;
+    server.stop();
+
+    EXPECT_EQ(received[0].rfind("HTTP/1.1 101 Switching Protocols\r\n", 0), 0u);
+    EXPECT_NE(received[0].find("Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n"), std::string::npos);
+    EXPECT_EQ(serverFrames(received[0]).back(), std::make_pair(static_cast<int>(http::kClose), std::string("\x03\xe8")));
+
+    // Every client sees increasing sequences, and the same sample is the same bytes
+    // for every client.
+    std::map<uint64_t, std::string> by_sequence;
+    size_t delivered = 0;
+    for (const std::string& bytes : received) {
+        uint64_t last = 0;
+        for (const auto& [opcode, payload] : serverFrames(bytes)) {
+            if (opcode != http::kText)
+                continue;
+            const uint64_t sequence = std::stoull(payload.substr(payload.find(':') + 1));
+            EXPECT_GT(sequence, last);
+            last = sequence;
+            auto [it, inserted] = by_sequence.emplace(sequence, payload);
+            if (!inserted) {
+                EXPECT_EQ(it->second, payload);
+            }
+            ++delivered;
+        }
+    }
+    // One encoding per sample, however many clients got it.
+    EXPECT_LE(counters.stream_updates, latest + 1);
+    EXPECT_LT(counters.stream_updates, delivered);
+}
+
+TEST(ServerPolicyTest, StreamRequiresAWebSocketHandshake) {
+    FakeServer server(gatewayConfig());
+    server.start(5);
+    int plain = server.transport().connectClient({"GET /stream HTTP/1.1\r\n\r\n"}, true, kHttpListener);
+    int old_version = server.transport().connectClient(
+        {"GET /stream HTTP/1.1\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Key: a2V5\r\n"
+         "Sec-WebSocket-Version: 8\r\n\r\n"},
+        true, kHttpListener);
+    int unmasked = server.transport().connectClient({streamHandshake(), "\x81\x02hi"}, true, kHttpListener);
+    ASSERT_TRUE(waitFor([&] { return !server.transport().sent(plain).empty(); }));
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(old_version); }));
+    ASSERT_TRUE(waitFor([&] { return server.transport().closed(unmasked); }));
+    ASSERT_TRUE(waitFor([&] { return server.getCounters().streaming == 0u; }));
+    server.stop();
+    EXPECT_EQ(server.transport().sent(plain).rfind("HTTP/1.1 426 Upgrade Required\r\n", 0), 0u);
+    EXPECT_EQ(server.transport().sent(old_version).rfind("HTTP/1.1 400 ", 0), 0u);
+    // The unmasked frame closed a stream that had started.
+    EXPECT_EQ(server.transport().sent(unmasked).rfind("HTTP/1.1 101 ", 0), 0u);
+}
+
 // Note: Full socket/network tests would require integration or mocking, not pure unit tests.
 // This test only checks basic construction and thread management.
 
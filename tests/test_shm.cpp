@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "ShmPublisher.h"
+#include "SharedSnapshot.h"
+#include "Server.hpp"
+#include "TestDoubles.h"
+
+static shm::Record makeRecord(uint64_t sequence) {
+    shm::Record r;
+    r.sequence = sequence;
+    r.timestamp_ms = 1700000000000 + static_cast<int64_t>(sequence);
+    r.rpm = static_cast<int32_t>(1000 + sequence);
+    r.temperature = 90;
+    r.oil_pressure = 40;
+    r.speed = static_cast<int32_t>(sequence % 500);
+    return r;
+}
+
+TEST(ShmTest, ReaderFailsWhenSegmentMissing) {
+    shm::Reader reader;
+    EXPECT_FALSE(reader.open("/middlewaresw_test_missing"));
+    EXPECT_FALSE(reader.isOpen());
+    shm::Record r;
+    EXPECT_FALSE(reader.readLatest(r));
+}
+
+TEST(ShmTest, LatestIsEmptyBeforeFirstPublish) {
+    ShmPublisher publisher;
+    ASSERT_TRUE(publisher.open("/middlewaresw_test_empty", 0));
+    shm::Reader reader;
+    ASSERT_TRUE(reader.open("/middlewaresw_test_empty"));
+    shm::Record r;
+    EXPECT_FALSE(reader.readLatest(r));
+    EXPECT_EQ(reader.readRecent(&r, 1), 0u);
+}
+
+TEST(ShmTest, ReaderSeesLatestPublishedRecord) {
+    ShmPublisher publisher;
+    ASSERT_TRUE(publisher.open("/middlewaresw_test_latest", 0));
+    shm::Reader reader;
+    ASSERT_TRUE(reader.open("/middlewaresw_test_latest"));
+    for (uint64_t seq = 1; seq <= 3; ++seq)
+        publisher.publish(makeRecord(seq));
+    shm::Record r;
+    ASSERT_TRUE(reader.readLatest(r));
+    EXPECT_EQ(r.sequence, 3u);
+    EXPECT_EQ(r.rpm, 1003);
+    EXPECT_EQ(r.timestamp_ms, 1700000000003);
+}
+
+TEST(ShmTest, RingKeepsMostRecentSamplesOldestFirst) {
+    ShmPublisher publisher;
+    ASSERT_TRUE(publisher.open("/middlewaresw_test_ring", 4));
+    shm::Reader reader;
+    ASSERT_TRUE(reader.open("/middlewaresw_test_ring"));
+    EXPECT_EQ(reader.ringCapacity(), 4u);
+    for (uint64_t seq = 1; seq <= 10; ++seq)
+        publisher.publish(makeRecord(seq));
+
+    shm::Record recent[8];
+    ASSERT_EQ(reader.readRecent(recent, 8), 4u);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(recent[i].sequence, static_cast<uint64_t>(7 + i));
+    ASSERT_EQ(reader.readRecent(recent, 2), 2u);
+    EXPECT_EQ(recent[0].sequence, 9u);
+    EXPECT_EQ(recent[1].sequence, 10u);
+}
+
+TEST(ShmTest, CloseUnlinksSegment) {
+    ShmPublisher publisher;
+    ASSERT_TRUE(publisher.open("/middlewaresw_test_close", 0));
+    EXPECT_TRUE(publisher.isOpen());
+    publisher.close();
+    EXPECT_FALSE(publisher.isOpen());
+    shm::Reader reader;
+    EXPECT_FALSE(reader.open("/middlewaresw_test_close"));
+}
+
+TEST(ShmTest, ConcurrentReadsNeverTear) {
+    ShmPublisher publisher;
+    ASSERT_TRUE(publisher.open("/middlewaresw_test_torn", 0));
+    shm::Reader reader;
+    ASSERT_TRUE(reader.open("/middlewaresw_test_torn"));
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (uint64_t seq = 1; seq <= 200000; ++seq)
+            publisher.publish(makeRecord(seq));
+        done = true;
+    });
+    uint64_t last = 0;
+    while (!done) {
+        shm::Record r;
+        if (!reader.readLatest(r))
+            continue;
+        // Every field is derived from the sequence, so a torn read would mismatch.
+        ASSERT_EQ(r.rpm, static_cast<int32_t>(1000 + r.sequence));
+        ASSERT_EQ(r.timestamp_ms, 1700000000000 + static_cast<int64_t>(r.sequence));
+        ASSERT_GE(r.sequence, last);
+        last = r.sequence;
+    }
+    writer.join();
+}
+
+TEST(ShmTest, ServerPublishesSnapshots) {
+    ServerConfig config;
+    config.shm.enabled = true;
+    config.shm.name = "/middlewaresw_test_server";
+    config.shm.ring_capacity = 16;
+    BasicServer<FakeEngine, InMemoryTransport> server(config);
+    server.engine().next = {2500, 85, 55, 130};
+    server.start(5);
+    shm::Reader reader;
+    ASSERT_TRUE(reader.open("/middlewaresw_test_server"));
+    shm::Record r;
+    ASSERT_TRUE(waitFor([&] { return reader.readLatest(r) && r.sequence >= 3; }));
+    EXPECT_EQ(r.rpm, 2500);
+    EXPECT_EQ(r.temperature, 85);
+    EXPECT_EQ(r.oil_pressure, 55);
+    EXPECT_EQ(r.speed, 130);
+    EXPECT_GT(r.timestamp_ms, 0);
+    shm::Record recent[16];
+    EXPECT_GE(reader.readRecent(recent, 16), 3u);
+    server.stop();
+    EXPECT_GE(server.getLatestSnapshot().sequence, r.sequence);
+}
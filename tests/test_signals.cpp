@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <string>
+#include "Engine.h"
+#include "Receiver.h"
+#include "SignalProto.h"
+
+// EngineSample is the signals and nothing else, in table order.
+static_assert(sizeof(EngineSample) == kSignalCount * sizeof(int));
+static_assert(offsetof(EngineSample, speed) == signals::speed * sizeof(int));
+static_assert(signalIndex("oil_pressure") == signals::oil_pressure);
+static_assert(signalIndex("pressure") == -1);
+static_assert(kAllSignals == 0xF);
+
+TEST(SignalsTest, TableDescribesEveryField) {
+    EngineSample s{1, 2, 3, 4};
+    std::string names;
+    forEachSignal([&](auto i) {
+        EXPECT_EQ(s.*kSignalFields[i].member, static_cast<int>(i) + 1);
+        EXPECT_EQ(kSignalFields[i].json_key, ",\"" + std::string(kSignalFields[i].name) + "\":");
+        EXPECT_LT(kSignalFields[i].min, kSignalFields[i].max);
+        names += kSignalFields[i].name;
+        names += ' ';
+    });
+    EXPECT_EQ(names, "rpm temperature oil_pressure speed ");
+    EXPECT_EQ(signalNames(), "rpm, temperature, oil_pressure, speed");
+    EXPECT_EQ(signalNames(",", "p."), "p.rpm,p.temperature,p.oil_pressure,p.speed");
+    signalValue(s, signals::temperature) = 20;
+    EXPECT_EQ(s.temperature, 20);
+    const auto values = applySignals([](auto... v) { return std::array<int, kSignalCount>{v...}; }, s);
+    EXPECT_EQ(values, (std::array<int, kSignalCount>{1, 20, 3, 4}));
+}
+
+TEST(SignalsTest, ProtoMappingFollowsTheMask) {
+    EngineData msg;
+    msg.set_temperature(77);
+    setSignals(msg, EngineSample{1200, 90, 45, 80}, (1u << signals::rpm) | (1u << signals::speed));
+    EXPECT_TRUE(msg.has_rpm());
+    EXPECT_FALSE(msg.has_temperature());
+    EXPECT_FALSE(msg.has_oil_pressure());
+    EXPECT_EQ(msg.speed(), 80);
+
+    setSignals(msg, EngineSample{1200, 90, 45, 80});
+    const EngineSample back = signalsOf(msg);
+    EXPECT_EQ(back.rpm, 1200);
+    EXPECT_EQ(back.temperature, 90);
+    EXPECT_EQ(back.oil_pressure, 45);
+    EXPECT_EQ(back.speed, 80);
+
+    WindowStats stats;
+    (stats.*kSignalProtoFields[signals::oil_pressure].mutable_stats)()->set_max(200);
+    EXPECT_EQ(stats.oil_pressure().max(), 200);
+}
+
+TEST(SignalsTest, StorageStatementsListEverySignal) {
+    EXPECT_EQ(engineValuesInsertSql(),
+              "INSERT INTO engine_values (rpm, temperature, oil_pressure, speed, timestamp) VALUES (?, ?, ?, ?, ?);");
+    EXPECT_EQ(alertEventsInsertSql(),
+              "INSERT INTO alert_events (rule, raised, rpm, temperature, oil_pressure, speed, timestamp) "
+              "VALUES (?, ?, ?, ?, ?, ?, ?);");
+}
+
+TEST(SignalsTest, ReceiverUsesTheTableRanges) {
+    Receiver receiver;
+    for (size_t signal = 0; signal < kSignalCount; ++signal) {
+        for (int i = 0; i < 100; ++i) {
+            const int value = receiver.read(signal);
+            EXPECT_GE(value, kSignalFields[signal].min);
+            EXPECT_LE(value, kSignalFields[signal].max);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <vector>
+#include "SlabPool.h"
+
+namespace {
+
+struct Counted {
+    explicit Counted(int value) : value(value) { ++live; }
+    ~Counted() { --live; }
+    int value;
+    char payload[100];
+    static inline int live = 0;
+};
+
+} // namespace
+
+TEST(SlabPoolTest, BlocksAreCacheLineAlignedAndReused) {
+    SlabPool pool;
+    ASSERT_TRUE(pool.init("test", 100, 4, false));
+    EXPECT_EQ(pool.blockBytes(), 128u);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 4; ++i) {
+        void* block = pool.allocate();
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % kCacheLineBytes, 0u);
+        EXPECT_TRUE(pool.owns(block));
+        blocks.push_back(block);
+    }
+    EXPECT_EQ(std::set<void*>(blocks.begin(), blocks.end()).size(), 4u);
+    EXPECT_EQ(pool.allocate(), nullptr);
+    // The most recently freed block comes back first.
+    pool.deallocate(blocks[1]);
+    pool.deallocate(blocks[3]);
+    EXPECT_EQ(pool.allocate(), blocks[3]);
+    EXPECT_EQ(pool.allocate(), blocks[1]);
+
+    const SlabStats& stats = pool.stats();
+    EXPECT_STREQ(stats.name, "test");
+    EXPECT_EQ(stats.capacity, 4u);
+    EXPECT_EQ(stats.in_use, 4u);
+    EXPECT_EQ(stats.high_water, 4u);
+    EXPECT_EQ(stats.allocations, 6u);
+    int on_stack = 0;
+    EXPECT_FALSE(pool.owns(&on_stack));
+}
+
+TEST(SlabPoolTest, HugePagesFallBackToRegularPages) {
+    // Without reserved huge pages (the usual case) the pool still works.
+    SlabPool pool;
+    ASSERT_TRUE(pool.init("huge", 4096, 16, true));
+    void* block = pool.allocate();
+    ASSERT_NE(block, nullptr);
+    static_cast<char*>(block)[4095] = 1;
+    pool.deallocate(block);
+}
+
+TEST(SlabPoolTest, ResourceRoutesBySizeAndFallsBackToTheHeap) {
+    SlabPool small, large;
+    ASSERT_TRUE(small.init("small", 256, 2, false));
+    ASSERT_TRUE(large.init("large", 4096, 1, false));
+    SlabResource resource{&small, &large};
+    {
+        std::pmr::string a(&resource), b(&resource), c(&resource), d(&resource);
+        a.reserve(200);
+        EXPECT_TRUE(small.owns(a.data()));
+        b.reserve(1000);
+        EXPECT_TRUE(large.owns(b.data()));
+        c.reserve(200);
+        EXPECT_TRUE(small.owns(c.data()));
+        // Both small blocks and the large one are in use: the heap serves it.
+        d.reserve(200);
+        EXPECT_FALSE(small.owns(d.data()));
+        EXPECT_FALSE(large.owns(d.data()));
+        // Larger than any block.
+        std::pmr::string e(&resource);
+        e.reserve(10000);
+        EXPECT_FALSE(large.owns(e.data()));
+    }
+    EXPECT_EQ(small.stats().in_use, 0u);
+    EXPECT_EQ(large.stats().in_use, 0u);
+    EXPECT_EQ(small.stats().fallbacks, 1u);
+    EXPECT_EQ(large.stats().fallbacks, 1u);
+}
+
+TEST(SlabPoolTest, ObjectPoolConstructsInPlaceAndOverflowsToNew) {
+    SlabObjectPool<Counted> pool;
+    ASSERT_TRUE(pool.init("objects", 2, false));
+    Counted* a = pool.create(1);
+    Counted* b = pool.create(2);
+    Counted* c = pool.create(3);
+    EXPECT_EQ(Counted::live, 3);
+    EXPECT_EQ(a->value + b->value + c->value, 6);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % kCacheLineBytes, 0u);
+    EXPECT_EQ(pool.stats().in_use, 2u);
+    EXPECT_EQ(pool.stats().fallbacks, 1u);
+    pool.destroy(c);
+    pool.destroy(a);
+    Counted* d = pool.create(4);
+    EXPECT_EQ(d, a);
+    pool.destroy(b);
+    pool.destroy(d);
+    EXPECT_EQ(Counted::live, 0);
+    EXPECT_EQ(pool.stats().in_use, 0u);
+    EXPECT_EQ(pool.stats().high_water, 2u);
+}
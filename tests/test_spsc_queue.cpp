@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "SpscQueue.hpp"
+
+TEST(SpscQueueTest, CapacityRoundsUpToPowerOfTwo) {
+    EXPECT_EQ(SpscQueue<int>(5, OverflowPolicy::Block).capacity(), 8u);
+    EXPECT_EQ(SpscQueue<int>(8, OverflowPolicy::Block).capacity(), 8u);
+    EXPECT_EQ(SpscQueue<int>(0, OverflowPolicy::Block).capacity(), 1u);
+}
+
+TEST(SpscQueueTest, DeliversInOrderAcrossThreads) {
+    SpscQueue<uint64_t> queue(16, OverflowPolicy::Block);
+    constexpr uint64_t kItems = 100000;
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < kItems; ++i)
+            queue.push(i);
+        queue.close();
+    });
+    std::vector<uint64_t> received;
+    uint64_t item = 0;
+    while (queue.pop(item))
+        received.push_back(item);
+    producer.join();
+
+    ASSERT_EQ(received.size(), kItems);
+    for (uint64_t i = 0; i < kItems; ++i)
+        ASSERT_EQ(received[i], i);
+    EXPECT_EQ(queue.dropped(), 0u);
+    EXPECT_EQ(queue.highWater(), 16u);
+}
+
+TEST(SpscQueueTest, DropNewestKeepsTheQueuedItems) {
+    SpscQueue<int> queue(4, OverflowPolicy::DropNewest);
+    for (int i = 0; i < 6; ++i)
+        EXPECT_EQ(queue.push(i), i < 4);
+    EXPECT_EQ(queue.dropped(), 2u);
+    int item = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.tryPop(item));
+        EXPECT_EQ(item, i);
+    }
+    EXPECT_FALSE(queue.tryPop(item));
+}
+
+TEST(SpscQueueTest, DropOldestKeepsTheNewestItems) {
+    SpscQueue<int> queue(4, OverflowPolicy::DropOldest);
+    for (int i = 0; i < 6; ++i)
+        EXPECT_TRUE(queue.push(i));
+    EXPECT_EQ(queue.dropped(), 2u);
+    EXPECT_EQ(queue.size(), 4u);
+    int item = -1;
+    for (int i = 2; i < 6; ++i) {
+        ASSERT_TRUE(queue.tryPop(item));
+        EXPECT_EQ(item, i);
+    }
+}
+
+TEST(SpscQueueTest, DropOldestLosesNothingElseUnderContention) {
+    // Every item is either received once, in order, or counted as dropped.
+    SpscQueue<uint64_t> queue(8, OverflowPolicy::DropOldest);
+    constexpr uint64_t kItems = 200000;
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < kItems; ++i)
+            queue.push(i);
+        queue.close();
+    });
+    uint64_t received = 0;
+    uint64_t last = 0;
+    bool first = true;
+    uint64_t item = 0;
+    while (queue.pop(item)) {
+        if (!first) {
+            ASSERT_GT(item, last);
+        }
+        first = false;
+        last = item;
+        ++received;
+    }
+    producer.join();
+    EXPECT_EQ(received + queue.dropped(), kItems);
+}
+
+TEST(SpscQueueTest, BlockWaitsForTheConsumer) {
+    SpscQueue<int> queue(2, OverflowPolicy::Block);
+    queue.push(1);
+    queue.push(2);
+    std::atomic<bool> pushed{false};
+    std::thread producer([&] {
+        queue.push(3);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(pushed.load());
+    int item = 0;
+    ASSERT_TRUE(queue.pop(item));
+    producer.join();
+    EXPECT_TRUE(pushed.load());
+    EXPECT_EQ(queue.dropped(), 0u);
+}
+
+TEST(SpscQueueTest, CloseDrainsThenStopsTheConsumer) {
+    SpscQueue<int> queue(4, OverflowPolicy::Block);
+    queue.push(7);
+    std::thread closer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.close();
+    });
+    int item = 0;
+    ASSERT_TRUE(queue.pop(item));
+    EXPECT_EQ(item, 7);
+    // Blocks until close().
+    EXPECT_FALSE(queue.pop(item));
+    closer.join();
+}
+
+TEST(SpscQueueTest, CloseReleasesABlockedProducer) {
+    SpscQueue<int> queue(1, OverflowPolicy::Block);
+    queue.push(1);
+    std::thread producer([&] { EXPECT_FALSE(queue.push(2)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    producer.join();
+    EXPECT_EQ(queue.size(), 1u);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include "Trace.h"
+
+namespace {
+
+size_t count(const std::string& text, const std::string& needle) {
+    size_t n = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1))
+        ++n;
+    return n;
+}
+
+} // namespace
+
+TEST(TraceTest, DisabledScopesRecordNothing) {
+    Trace::disable();
+    Trace::clear();
+    for (int i = 0; i < 1000; ++i) {
+        TraceScope span("idle");
+    }
+    EXPECT_EQ(Trace::recorded(), 0u);
+}
+
+TEST(TraceTest, SpansAreWrittenAsChromeCompleteEvents) {
+    Trace::clear();
+    Trace::enable();
+    std::thread worker([] {
+        Trace::setThreadName("worker");
+        TraceScope outer("outer");
+        for (int i = 0; i < 3; ++i) {
+            TraceScope inner("inner \"quoted\"");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+    worker.join();
+    Trace::disable();
+    EXPECT_EQ(Trace::recorded(), 4u);
+
+    const std::string json = Trace::chromeJson();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"worker\"}"), std::string::npos);
+    EXPECT_EQ(count(json, "\"name\":\"inner \\\"quoted\\\"\",\"ph\":\"X\""), 3u);
+    EXPECT_EQ(count(json, "\"name\":\"outer\",\"ph\":\"X\""), 1u);
+
+    // Durations are converted from ticks to microseconds: each inner span slept 2 ms.
+    const size_t at = json.find("\"name\":\"inner");
+    const size_t dur = json.find("\"dur\":", at);
+    ASSERT_NE(dur, std::string::npos);
+    const double us = std::stod(json.substr(dur + 6));
+    EXPECT_GT(us, 1500.0);
+    EXPECT_LT(us, 200000.0);
+    Trace::clear();
+}
+
+TEST(TraceTest, RingKeepsTheMostRecentSpans) {
+    Trace::clear();
+    Trace::enable();
+    std::thread worker([] {
+        for (size_t i = 0; i < Trace::kRingEvents + 100; ++i) {
+            TraceScope span("span");
+        }
+    });
+    worker.join();
+    Trace::disable();
+    EXPECT_EQ(Trace::recorded(), Trace::kRingEvents + 100);
+    const std::string json = Trace::chromeJson();
+    EXPECT_EQ(count(json, "\"name\":\"span\""), Trace::kRingEvents);
+    Trace::clear();
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Engine.h"
+#include "HistoryImport.h"
+#include "PartitionedStore.h"
+#include "Server.hpp"
+#include "TestDoubles.h"
+#include "TestStorage.h"
+#include "WarmStart.h"
+
+namespace {
+
+int64_t nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Writes one row per entry of `timestamps` with rpm = its index.
+void fillDatabase(const std::string& path, const std::vector<int64_t>& timestamps) {
+    ::fillDatabase(path, timestamps.size(), [&](size_t i) {
+        return StoredSample{0, timestamps[i], EngineSample{static_cast<int>(i), 90, 40, 50}, kAllSignals};
+    });
+}
+
+} // namespace
+
+TEST(WarmStartTest, ReadsOnlyTheLookbackWindowOldestFirst) {
+    const std::string path = "/tmp/test_warm_start.db";
+    fillDatabase(path, {1000, 2000, 3000, 4000, 5000});
+    StorageConfig storage;
+    storage.path = path;
+    std::vector<EngineSnapshot> samples;
+    WarmStartStats stats;
+    ASSERT_TRUE(loadRecentSamples(storage, 3000, samples, stats));
+    ASSERT_EQ(samples.size(), 3u);
+    EXPECT_EQ(stats.rows, 3u);
+    EXPECT_FALSE(stats.truncated);
+    EXPECT_EQ(samples[0].timestamp_ms, 3000);
+    EXPECT_EQ(samples[0].values.rpm, 2);
+    EXPECT_EQ(samples[0].sequence, 1u);
+    EXPECT_EQ(samples[2].timestamp_ms, 5000);
+    EXPECT_EQ(samples[2].sequence, 3u);
+    std::filesystem::remove(path);
+}
+
+TEST(WarmStartTest, NewestSampleIsKeptHoweverOld) {
+    const std::string path = "/tmp/test_warm_start_old.db";
+    fillDatabase(path, {1000, 2000});
+    StorageConfig storage;
+    storage.path = path;
+    std::vector<EngineSnapshot> samples;
+    WarmStartStats stats;
+    ASSERT_TRUE(loadRecentSamples(storage, nowMs(), samples, stats));
+    ASSERT_EQ(samples.size(), 1u);
+    EXPECT_EQ(samples[0].timestamp_ms, 2000);
+
+    // A missing database is a cold start, not an error.
+    storage.path = "/tmp/test_warm_start_missing.db";
+    std::filesystem::remove(storage.path);
+    ASSERT_TRUE(loadRecentSamples(storage, 0, samples, stats));
+    EXPECT_TRUE(samples.empty());
+    EXPECT_FALSE(std::filesystem::exists(storage.path));
+    std::filesystem::remove(path);
+}
+
+TEST(WarmStartTest, RowCapTruncates) {
+    const std::string path = "/tmp/test_warm_start_cap.db";
+    std::vector<int64_t> timestamps;
+    for (int i = 0; i < 100; ++i)
+        timestamps.push_back(1000 + i);
+    fillDatabase(path, timestamps);
+    StorageConfig storage;
+    storage.path = path;
+    WarmStartOptions options;
+    options.max_rows = 10;
+    std::vector<EngineSnapshot> samples;
+    WarmStartStats stats;
+    ASSERT_TRUE(loadRecentSamples(storage, 0, samples, stats, options));
+    ASSERT_EQ(samples.size(), 10u);
+    EXPECT_TRUE(stats.truncated);
+    EXPECT_EQ(samples.front().timestamp_ms, 1090);
+    EXPECT_EQ(samples.back().timestamp_ms, 1099);
+    std::filesystem::remove(path);
+}
+
+TEST(WarmStartTest, ReadsAcrossPartitionsNewestFirst) {
+    const std::string dir = "/tmp/test_warm_start_partitions";
+    std::filesystem::remove_all(dir);
+    constexpr int64_t kHourMs = 3600 * 1000;
+    const int64_t base = 1704067200000LL;
+    {
+        PartitionedStore store;
+        ASSERT_TRUE(store.open(dir, Partitioning::Hour));
+        for (int h = 0; h < 3; ++h)
+            for (int i = 0; i < 3; ++i)
+                ASSERT_TRUE(store.insert(base + h * kHourMs + i * 1000, h * 10 + i, 90, 40, 50));
+    }
+    StorageConfig storage;
+    storage.path = dir;
+    storage.partitioning = Partitioning::Hour;
+    std::vector<EngineSnapshot> samples;
+    WarmStartStats stats;
+    ASSERT_TRUE(loadRecentSamples(storage, base + kHourMs + 1000, samples, stats));
+    ASSERT_EQ(samples.size(), 5u);
+    EXPECT_EQ(samples.front().values.rpm, 11);
+    EXPECT_EQ(samples.back().values.rpm, 22);
+    std::filesystem::remove_all(dir);
+}
+
+TEST(WarmStartTest, ServerStartsWithRestoredSnapshotAndWindows) {
+    const std::string path = "/tmp/test_warm_start_server.db";
+    const int64_t now = nowMs();
+    std::vector<int64_t> timestamps;
+    for (int i = 0; i < 50; ++i)
+        timestamps.push_back(now - 5000 + i * 100);
+    fillDatabase(path, timestamps);
+
+    ServerConfig config;
+    config.storage.path = path;
+    config.stats.windows_ms = {60000};
+    BasicServer<EngineImpl, InMemoryTransport> server(config);
+    EXPECT_EQ(server.getLatestSnapshot().sequence, 0u);
+    server.start(1000);
+    // Restored synchronously in start(), before the first live sample at the earliest.
+    EXPECT_GE(server.getLatestSnapshot().sequence, 50u);
+    const std::vector<WindowSummary> windows = server.getLatestStats();
+    ASSERT_EQ(windows.size(), 1u);
+    EXPECT_GE(windows[0].count, 50u);
+    server.stop();
+    std::filesystem::remove(path);
+}
+
+TEST(WarmStartTest, ImportedOldSamplesDoNotEndTheScan) {
+    const std::string path = "/tmp/test_warm_start_import.db";
+    const std::string csv_path = "/tmp/test_warm_start_import.csv";
+    {
+        std::ofstream csv(csv_path);
+        csv << "timestamp_ms,rpm,temperature,oil_pressure,speed\n";
+        for (int i = 0; i < 10; ++i)
+            csv << 1704067200000 + i * 1000 << "," << 1000 + i << ",90,40,50\n";
+    }
+    // Live samples in rows and in blocks, then a backfill of 2024 with newer ids.
+    for (size_t block_rows : {0u, 8u}) {
+        SCOPED_TRACE(block_rows);
+        std::filesystem::remove(path);
+        StorageConfig storage;
+        storage.path = path;
+        storage.block_rows = block_rows;
+        const int64_t now = nowMs();
+        {
+            EngineImpl engine(storage);
+            for (int i = 0; i < 50; ++i) {
+                EngineSnapshot snapshot;
+                snapshot.values = EngineSample{i, 90, 40, 50};
+                snapshot.timestamp_ms = now - 5000 + i * 100;
+                engine.storeSample(snapshot);
+            }
+        }
+        ImportStats import_stats;
+        ASSERT_TRUE(importHistory(path, csv_path, import_stats));
+        ASSERT_EQ(import_stats.rows, 10u);
+
+        std::vector<EngineSnapshot> samples;
+        WarmStartStats stats;
+        ASSERT_TRUE(loadRecentSamples(storage, now - 6000, samples, stats));
+        ASSERT_EQ(samples.size(), 50u);
+        EXPECT_EQ(samples.front().timestamp_ms, now - 5000);
+        EXPECT_EQ(samples.back().timestamp_ms, now - 100);
+        EXPECT_EQ(samples.back().values.rpm, 49);
+    }
+    std::filesystem::remove(path);
+    std::filesystem::remove(csv_path);
+}
@@ -0,0 +1,652 @@
+// Load generator / latency benchmark for the middlewaresw socket protocol.
+//
+// Each connection runs on its own thread and issues request/response round trips
+// (1 request byte -> one length-prefixed EngineData frame), timing every one.
+//
+//   middlewaresw_loadgen --tcp 127.0.0.1:5555 --requests 100000 --connections 4
+//   middlewaresw_loadgen --unix /tmp/middlewaresw.sock [--seqpacket]
+//
+// With --multicast it instead joins the server's multicast group, receives
+// `--requests` datagrams and reports loss (sequence gaps), reordering and the
+// one-way delay derived from each datagram's timestamp.
+//
+//   middlewaresw_loadgen --multicast 239.255.0.1:5556 --multicast-if 127.0.0.1 --requests 100
+//
+// With --storm every connection thread instead reconnects `--requests` times, all
+// threads at once: connect, one round trip, close. It reports connect() latency and
+// the time to the first response. Setups that take a second or more are SYN
+// retransmits after the server's accept queue overflowed.
+//
+//   middlewaresw_loadgen --storm --connections 256 --requests 20
+//
+// With --client the requests go through EngineClient instead: one I/O thread, the
+// connections pooled, --pipeline requests in flight per connection.
+//
+//   middlewaresw_loadgen --client --unix /tmp/middlewaresw.sock --connections 2 --pipeline 16
+//
+// With --websocket it instead plays --connections browsers on the HTTP gateway
+// (--tcp names the gateway's port), all from one thread: each upgrades /stream and
+// receives `--requests` messages. It reports the delivery delay derived from each
+// message's timestamp and the samples a subscriber never saw.
+//
+//   middlewaresw_loadgen --websocket --tcp 127.0.0.1:8080 --connections 2000 --requests 200
+//
+// With --exporters N, N further connections export the whole stored history over
+// and over while the round trips run, and the exported volume is reported. This
+// shows how bulk history requests affect live request latency.
+//
+//   middlewaresw_loadgen --tcp 127.0.0.1:5555 --requests 20000 --exporters 4
+//
+// Every mode that issues requests reports the client process's CPU time per frame.
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string>
+#include <string_view>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "EngineClient.h"
+#include "engine_data.pb.h"
+
+namespace {
+
+struct Options {
+    std::string tcp_host = "127.0.0.1";
+    int tcp_port = 5555;
+    std::string unix_path;
+    bool seqpacket = false;
+    int requests = 10000;
+    int connections = 1;
+    std::string multicast_group;
+    int multicast_port = 0;
+    std::string multicast_interface;
+    bool storm = false;
+    bool client = false;
+    int pipeline = 1;
+    bool websocket = false;
+    int exporters = 0;
+};
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0
+              << " [--tcp host:port | --unix path [--seqpacket]] [--requests N] [--connections C] [--exporters E]\n"
+              << "       " << argv0 << " --multicast group:port [--multicast-if address] [--requests N]\n"
+              << "       " << argv0 << " --storm [--tcp host:port | --unix path] [--connections C] [--requests N]\n"
+              << "       " << argv0 << " --client [--tcp host:port | --unix path] [--connections C] [--pipeline P] [--requests N]\n"
+              << "       " << argv0 << " --websocket [--tcp host:port] [--connections C] [--requests N]\n";
+}
+
+bool parseOptions(int argc, char* argv[], Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--tcp" && has_value) {
+            const std::string endpoint = argv[++i];
+            const size_t colon = endpoint.rfind(':');
+            if (colon == std::string::npos)
+                return false;
+            opt.tcp_host = endpoint.substr(0, colon);
+            opt.tcp_port = std::atoi(endpoint.c_str() + colon + 1);
+            opt.unix_path.clear();
+        } else if (arg == "--unix" && has_value) {
+            opt.unix_path = argv[++i];
+        } else if (arg == "--multicast" && has_value) {
+            const std::string endpoint = argv[++i];
+            const size_t colon = endpoint.rfind(':');
+            if (colon == std::string::npos)
+                return false;
+            opt.multicast_group = endpoint.substr(0, colon);
+            opt.multicast_port = std::atoi(endpoint.c_str() + colon + 1);
+        } else if (arg == "--multicast-if" && has_value) {
+            opt.multicast_interface = argv[++i];
+        } else if (arg == "--storm") {
+            opt.storm = true;
+        } else if (arg == "--client") {
+            opt.client = true;
+        } else if (arg == "--websocket") {
+            opt.websocket = true;
+        } else if (arg == "--pipeline" && has_value) {
+            opt.pipeline = std::atoi(argv[++i]);
+        } else if (arg == "--seqpacket") {
+            opt.seqpacket = true;
+        } else if (arg == "--requests" && has_value) {
+            opt.requests = std::atoi(argv[++i]);
+        } else if (arg == "--connections" && has_value) {
+            opt.connections = std::atoi(argv[++i]);
+        } else if (arg == "--exporters" && has_value) {
+            opt.exporters = std::atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return opt.requests > 0 && opt.connections > 0 && opt.pipeline > 0 && opt.exporters >= 0;
+}
+
+int connectTo(const Options& opt) {
+    if (!opt.unix_path.empty()) {
+        int fd = socket(AF_UNIX, opt.seqpacket ? SOCK_SEQPACKET : SOCK_STREAM, 0);
+        if (fd < 0)
+            return -1;
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, opt.unix_path.c_str(), sizeof(addr.sun_path) - 1);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+        return -1;
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(opt.tcp_port));
+    if (inet_pton(AF_INET, opt.tcp_host.c_str(), &addr.sin_addr) != 1 ||
+        connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool readExact(int fd, char* buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = read(fd, buf, len);
+        if (n <= 0)
+            return false;
+        buf += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// Reads one frame into `msg`. SOCK_SEQPACKET delivers the whole frame in one recv.
+bool readFrame(int fd, bool seqpacket, std::vector<char>& buf, EngineData& msg) {
+    uint32_t size;
+    if (seqpacket) {
+        buf.resize(64 * 1024);
+        ssize_t n = recv(fd, buf.data(), buf.size(), 0);
+        if (n < static_cast<ssize_t>(sizeof(size)))
+            return false;
+        std::memcpy(&size, buf.data(), sizeof(size));
+        size = ntohl(size);
+        return size + sizeof(size) == static_cast<size_t>(n) &&
+               msg.ParseFromArray(buf.data() + sizeof(size), static_cast<int>(size));
+    }
+    if (!readExact(fd, reinterpret_cast<char*>(&size), sizeof(size)))
+        return false;
+    size = ntohl(size);
+    buf.resize(size);
+    return readExact(fd, buf.data(), size) && msg.ParseFromArray(buf.data(), static_cast<int>(size));
+}
+
+double percentile(const std::vector<int64_t>& sorted, double p) {
+    if (sorted.empty())
+        return 0.0;
+    size_t idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+    return static_cast<double>(sorted[idx]) / 1000.0;
+}
+
+// User plus system CPU time of this process.
+double cpuSeconds() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+int64_t nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Companion receiver for the multicast publisher.
+int runMulticastReceiver(const Options& opt) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        std::cerr << "socket: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(opt.multicast_port));
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    ip_mreq mreq{};
+    if (inet_pton(AF_INET, opt.multicast_group.c_str(), &mreq.imr_multiaddr) != 1) {
+        std::cerr << "invalid multicast group " << opt.multicast_group << "\n";
+        close(fd);
+        return 1;
+    }
+    mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+    if (!opt.multicast_interface.empty())
+        inet_pton(AF_INET, opt.multicast_interface.c_str(), &mreq.imr_interface);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+        std::cerr << "join " << opt.multicast_group << ": " << std::strerror(errno) << "\n";
+        close(fd);
+        return 1;
+    }
+
+    EngineData msg;
+    char buf[2048];
+    uint64_t expected = 0;
+    int64_t received = 0, lost = 0, reordered = 0;
+    std::vector<int64_t> delays;
+    delays.reserve(opt.requests);
+    while (received < opt.requests) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n < 0) {
+            std::cerr << "recv: " << std::strerror(errno) << "\n";
+            break;
+        }
+        if (!msg.ParseFromArray(buf, static_cast<int>(n)))
+            continue;
+        ++received;
+        delays.push_back((nowMs() - msg.timestamp_ms()) * 1000);
+        const uint64_t seq = msg.sequence();
+        if (expected != 0 && seq > expected)
+            lost += static_cast<int64_t>(seq - expected);
+        else if (expected != 0 && seq < expected)
+            ++reordered;
+        if (seq >= expected)
+            expected = seq + 1;
+    }
+    close(fd);
+    std::sort(delays.begin(), delays.end());
+    std::cout << "transport:   multicast " << opt.multicast_group << ":" << opt.multicast_port << "\n"
+              << "datagrams:   " << received << " received, " << lost << " lost, " << reordered << " reordered\n"
+              << "delay ms:    p50=" << percentile(delays, 0.50) << " p99=" << percentile(delays, 0.99)
+              << " max=" << percentile(delays, 1.0) << "\n";
+    return lost == 0 ? 0 : 2;
+}
+
+// Reconnect storm: all threads connect at the same moment, as clients do after a
+// network blip, then keep reconnecting.
+int runReconnectStorm(const Options& opt) {
+    std::vector<std::vector<int64_t>> connect_ns(opt.connections), setup_ns(opt.connections);
+    std::atomic<int> failures{0};
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int c = 0; c < opt.connections; ++c) {
+        workers.emplace_back([&, c] {
+            std::vector<char> buf;
+            EngineData msg;
+            const char request = 'x';
+            connect_ns[c].reserve(opt.requests);
+            setup_ns[c].reserve(opt.requests);
+            ++ready;
+            while (!go.load())
+                std::this_thread::yield();
+            for (int i = 0; i < opt.requests; ++i) {
+                const auto t0 = std::chrono::steady_clock::now();
+                int fd = connectTo(opt);
+                const auto t1 = std::chrono::steady_clock::now();
+                if (fd < 0) {
+                    ++failures;
+                    continue;
+                }
+                // A handshake whose final ACK the server dropped looks connected here
+                // but is never answered; give up on it instead of hanging.
+                timeval timeout{3, 0};
+                setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                const bool ok = send(fd, &request, 1, MSG_NOSIGNAL) == 1 && readFrame(fd, opt.seqpacket, buf, msg);
+                const auto t2 = std::chrono::steady_clock::now();
+                close(fd);
+                if (!ok) {
+                    ++failures;
+                    continue;
+                }
+                connect_ns[c].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+                setup_ns[c].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t0).count());
+            }
+        });
+    }
+    while (ready.load() < opt.connections)
+        std::this_thread::yield();
+    const auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto& w : workers)
+        w.join();
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<int64_t> connects, setups;
+    for (int c = 0; c < opt.connections; ++c) {
+        connects.insert(connects.end(), connect_ns[c].begin(), connect_ns[c].end());
+        setups.insert(setups.end(), setup_ns[c].begin(), setup_ns[c].end());
+    }
+    std::sort(connects.begin(), connects.end());
+    std::sort(setups.begin(), setups.end());
+    const auto retransmitted = std::count_if(setups.begin(), setups.end(), [](int64_t ns) { return ns >= 1000000000; });
+    const std::string target = opt.unix_path.empty() ? "tcp " + opt.tcp_host + ":" + std::to_string(opt.tcp_port)
+                                                     : "unix " + opt.unix_path;
+    std::cout << "storm:       " << target << ", " << opt.connections << " clients x " << opt.requests << " reconnects\n"
+              << "setups:      " << setups.size() << " ok, " << failures.load() << " failed or timed out (3 s), "
+              << retransmitted << " >= 1 s (SYN retransmit)\n"
+              << "rate:        " << static_cast<int64_t>(static_cast<double>(setups.size()) / elapsed_s) << " connections/s\n"
+              << "connect us:  p50=" << percentile(connects, 0.50) << " p99=" << percentile(connects, 0.99)
+              << " max=" << percentile(connects, 1.0) << "\n"
+              << "first response us: p50=" << percentile(setups, 0.50) << " p99=" << percentile(setups, 0.99)
+              << " max=" << percentile(setups, 1.0) << "\n";
+    return failures.load() == 0 ? 0 : 2;
+}
+
+// Pipelined polls through EngineClient. Each response issues the next request from
+// the I/O thread, keeping --pipeline requests in flight per connection.
+int runAsyncClient(const Options& opt) {
+    ClientConfig config;
+    config.host = opt.tcp_host;
+    config.port = static_cast<uint16_t>(opt.tcp_port);
+    config.unix_path = opt.unix_path;
+    config.pool_size = static_cast<size_t>(opt.connections);
+    config.max_in_flight = static_cast<size_t>(opt.pipeline);
+    EngineClient client(config);
+    if (!client.start())
+        return 1;
+
+    const int64_t total = static_cast<int64_t>(opt.requests) * opt.connections;
+    const int64_t in_flight = std::min<int64_t>(total, static_cast<int64_t>(opt.pipeline) * opt.connections);
+    std::atomic<int64_t> issued{0}, completed{0}, failures{0};
+    std::vector<int64_t> latencies(static_cast<size_t>(total));
+    std::function<void()> issue = [&] {
+        const int64_t index = issued.fetch_add(1);
+        if (index >= total)
+            return;
+        const auto t0 = std::chrono::steady_clock::now();
+        const bool queued = client.poll([&, index, t0](ClientStatus status, const EngineData&) {
+            latencies[static_cast<size_t>(index)] =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+            if (status != ClientStatus::Ok)
+                ++failures;
+            ++completed;
+            issue();
+        });
+        if (!queued) {
+            ++failures;
+            ++completed;
+        }
+    };
+    const double cpu_start = cpuSeconds();
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < in_flight; ++i)
+        issue();
+    while (completed.load() < total)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double cpu_s = cpuSeconds() - cpu_start;
+    client.stop();
+
+    std::sort(latencies.begin(), latencies.end());
+    const int64_t ok = total - failures.load();
+    const std::string transport = opt.unix_path.empty()
+        ? "tcp " + opt.tcp_host + ":" + std::to_string(opt.tcp_port)
+        : "unix-stream " + opt.unix_path;
+    std::cout << "client:      EngineClient, " << transport << "\n"
+              << "connections: " << opt.connections << " pooled, pipeline " << opt.pipeline << "\n"
+              << "requests:    " << ok << " ok, " << failures.load() << " failed\n"
+              << "throughput:  " << static_cast<int64_t>(static_cast<double>(ok) / elapsed_s) << " req/s\n"
+              << "latency us:  p50=" << percentile(latencies, 0.50) << " p99=" << percentile(latencies, 0.99)
+              << " max=" << percentile(latencies, 1.0) << "\n"
+              << "cpu/frame:   " << (ok > 0 ? cpu_s * 1e6 / static_cast<double>(ok) : 0.0) << " us\n";
+    return failures.load() == 0 ? 0 : 2;
+}
+
+// Browser-like subscribers of the gateway's WebSocket stream, multiplexed on one
+// thread with poll().
+int runWebSocketSubscribers(const Options& opt) {
+    struct Subscriber {
+        int fd = -1;
+        std::string in;
+        bool upgraded = false;
+        int received = 0;
+        uint64_t last_sequence = 0;
+    };
+    // Every subscriber is a descriptor.
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+    const std::string handshake = "GET /stream HTTP/1.1\r\nHost: " + opt.tcp_host +
+        "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+        "Sec-WebSocket-Version: 13\r\n\r\n";
+    std::vector<Subscriber> subscribers(static_cast<size_t>(opt.connections));
+    int failures = 0;
+    for (Subscriber& s : subscribers) {
+        s.fd = connectTo(opt);
+        if (s.fd < 0 ||
+            send(s.fd, handshake.data(), handshake.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(handshake.size())) {
+            ++failures;
+            break;
+        }
+    }
+    if (failures > 0) {
+        std::cerr << "connect/handshake failed: " << std::strerror(errno) << "\n";
+        return 2;
+    }
+
+    std::vector<int64_t> delays_us;
+    delays_us.reserve(static_cast<size_t>(opt.connections) * static_cast<size_t>(opt.requests));
+    uint64_t missed = 0;
+    size_t done = 0;
+    std::vector<pollfd> fds(subscribers.size());
+    char buffer[64 * 1024];
+    const double cpu_start = cpuSeconds();
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::seconds(60);
+    const int64_t start_ms = nowMs();
+    while (done < subscribers.size() && std::chrono::steady_clock::now() < deadline) {
+        for (size_t i = 0; i < subscribers.size(); ++i)
+            fds[i] = {subscribers[i].received < opt.requests ? subscribers[i].fd : -1, POLLIN, 0};
+        if (poll(fds.data(), fds.size(), 1000) <= 0)
+            continue;
+        const int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        for (size_t i = 0; i < subscribers.size(); ++i) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+                continue;
+            Subscriber& s = subscribers[i];
+            const ssize_t n = read(s.fd, buffer, sizeof(buffer));
+            if (n <= 0) {
+                ++failures;
+                s.received = opt.requests;
+                ++done;
+                continue;
+            }
+            s.in.append(buffer, static_cast<size_t>(n));
+            size_t offset = 0;
+            if (!s.upgraded) {
+                const size_t end = s.in.find("\r\n\r\n");
+                if (end == std::string::npos)
+                    continue;
+                if (s.in.rfind("HTTP/1.1 101 ", 0) != 0) {
+                    ++failures;
+                    s.received = opt.requests;
+                    ++done;
+                    continue;
+                }
+                s.upgraded = true;
+                offset = end + 4;
+            }
+            // Server frames are unmasked and, for a snapshot, shorter than 64 KiB.
+            while (s.received < opt.requests && s.in.size() - offset >= 2) {
+                size_t length = static_cast<uint8_t>(s.in[offset + 1]) & 0x7F;
+                size_t header = 2;
+                if (length == 126) {
+                    if (s.in.size() - offset < 4)
+                        break;
+                    length = (static_cast<uint8_t>(s.in[offset + 2]) << 8) | static_cast<uint8_t>(s.in[offset + 3]);
+                    header = 4;
+                }
+                if (s.in.size() - offset < header + length)
+                    break;
+                const std::string_view payload(s.in.data() + offset + header, length);
+                offset += header + length;
+                const size_t seq_at = payload.find("\"sequence\":");
+                const size_t ts_at = payload.find("\"timestamp_ms\":");
+                if (seq_at == std::string_view::npos || ts_at == std::string_view::npos)
+                    continue;
+                const uint64_t sequence = std::strtoull(payload.data() + seq_at + 11, nullptr, 10);
+                const int64_t timestamp_ms = std::strtoll(payload.data() + ts_at + 15, nullptr, 10);
+                // The first message is the snapshot at subscription time, and samples
+                // taken while the other subscribers were still connecting wait in the
+                // socket buffer; neither says anything about delivery.
+                if (s.received > 0 && timestamp_ms >= start_ms) {
+                    delays_us.push_back(std::max<int64_t>(0, now_us - timestamp_ms * 1000));
+                    if (sequence > s.last_sequence + 1)
+                        missed += sequence - s.last_sequence - 1;
+                }
+                s.last_sequence = sequence;
+                if (++s.received == opt.requests)
+                    ++done;
+            }
+            s.in.erase(0, offset);
+        }
+    }
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double cpu_s = cpuSeconds() - cpu_start;
+    for (Subscriber& s : subscribers)
+        close(s.fd);
+
+    std::sort(delays_us.begin(), delays_us.end());
+    uint64_t messages = 0;
+    for (const Subscriber& s : subscribers)
+        messages += static_cast<uint64_t>(s.received);
+    std::cout << "transport:   websocket tcp " << opt.tcp_host << ":" << opt.tcp_port << "\n"
+              << "subscribers: " << opt.connections << ", " << (subscribers.size() - done) << " unfinished, "
+              << failures << " failed\n"
+              << "messages:    " << messages << " (" << static_cast<int64_t>(static_cast<double>(messages) / elapsed_s)
+              << "/s), " << missed << " samples skipped\n"
+              << "delay ms:    p50=" << percentile(delays_us, 0.50) << " p99=" << percentile(delays_us, 0.99)
+              << " max=" << percentile(delays_us, 1.0) << "\n"
+              << "cpu/frame:   " << (messages > 0 ? cpu_s * 1e6 / static_cast<double>(messages) : 0.0) << " us\n";
+    return failures == 0 && done == subscribers.size() ? 0 : 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (!opt.multicast_group.empty())
+        return runMulticastReceiver(opt);
+    if (opt.storm)
+        return runReconnectStorm(opt);
+    if (opt.client)
+        return runAsyncClient(opt);
+    if (opt.websocket)
+        return runWebSocketSubscribers(opt);
+
+    // Background exports of the whole history, repeated until the round trips end.
+    std::atomic<bool> exporting{true};
+    std::atomic<uint64_t> exports{0};
+    std::atomic<uint64_t> exported_bytes{0};
+    std::vector<std::thread> exporters;
+    for (int e = 0; e < opt.exporters; ++e) {
+        exporters.emplace_back([&] {
+            int fd = connectTo(opt);
+            if (fd < 0)
+                return;
+            Request request;
+            request.mutable_export_history()->set_format(ExportRequest::BINARY);
+            const std::string payload = request.SerializeAsString();
+            std::string frame(1, static_cast<char>(0xA5));
+            const uint32_t size = htonl(static_cast<uint32_t>(payload.size()));
+            frame.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            frame += payload;
+            std::vector<char> buf;
+            EngineData msg;
+            while (exporting) {
+                if (send(fd, frame.data(), frame.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(frame.size()))
+                    break;
+                bool ok;
+                while ((ok = readFrame(fd, opt.seqpacket, buf, msg)) && !msg.export_chunk().last())
+                    exported_bytes += msg.export_chunk().data().size();
+                if (!ok || msg.export_chunk().failed())
+                    break;
+                ++exports;
+            }
+            close(fd);
+        });
+    }
+
+    std::vector<std::vector<int64_t>> latencies(opt.connections);
+    std::atomic<int> failures{0};
+    std::vector<std::thread> workers;
+    const double cpu_start = cpuSeconds();
+    const auto start = std::chrono::steady_clock::now();
+    for (int c = 0; c < opt.connections; ++c) {
+        workers.emplace_back([&, c] {
+            int fd = connectTo(opt);
+            if (fd < 0) {
+                ++failures;
+                return;
+            }
+            std::vector<char> buf;
+            EngineData msg;
+            auto& samples = latencies[c];
+            samples.reserve(opt.requests);
+            const char request = 'x';
+            for (int i = 0; i < opt.requests; ++i) {
+                const auto t0 = std::chrono::steady_clock::now();
+                if (send(fd, &request, 1, MSG_NOSIGNAL) != 1 || !readFrame(fd, opt.seqpacket, buf, msg)) {
+                    ++failures;
+                    break;
+                }
+                const auto t1 = std::chrono::steady_clock::now();
+                samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+            }
+            close(fd);
+        });
+    }
+    for (auto& w : workers)
+        w.join();
+    exporting = false;
+    for (auto& e : exporters)
+        e.join();
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double cpu_s = cpuSeconds() - cpu_start;
+
+    std::vector<int64_t> all;
+    for (auto& v : latencies)
+        all.insert(all.end(), v.begin(), v.end());
+    std::sort(all.begin(), all.end());
+
+    const std::string transport = opt.unix_path.empty()
+        ? "tcp " + opt.tcp_host + ":" + std::to_string(opt.tcp_port)
+        : std::string(opt.seqpacket ? "unix-seqpacket " : "unix-stream ") + opt.unix_path;
+    std::cout << "transport:   " << transport << "\n"
+              << "connections: " << opt.connections << "\n"
+              << "requests:    " << all.size() << " ok, " << failures.load() << " failed\n"
+              << "throughput:  " << static_cast<int64_t>(static_cast<double>(all.size()) / elapsed_s) << " req/s\n"
+              << "latency us:  p50=" << percentile(all, 0.50) << " p99=" << percentile(all, 0.99)
+              << " p99.9=" << percentile(all, 0.999) << " max=" << percentile(all, 1.0) << "\n"
+              << "cpu/frame:   " << (all.empty() ? 0.0 : cpu_s * 1e6 / static_cast<double>(all.size())) << " us\n";
+    if (opt.exporters > 0)
+        std::cout << "exports:     " << exports.load() << " finished by " << opt.exporters << " exporters, "
+                  << exported_bytes.load() / (1024 * 1024) << " MiB\n";
+    return failures.load() == 0 ? 0 : 2;
+}